@@ -17,7 +17,12 @@
 #include <benchmark/benchmark.h>
 
 #include "lexio/lexio.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 //******************************************************************************
 
@@ -245,6 +250,24 @@ static void Bench_TryReadU32LE(benchmark::State &state)
 }
 BENCHMARK(Bench_TryReadU32LE);
 
+static void Bench_TryReadU32LEEOF(benchmark::State &state)
+{
+    uint8_t data[2] = {0};
+    LexIO::ViewStream stream{data};
+
+    for (auto _ : state)
+    {
+        uint32_t out = 0;
+        for (size_t i = 0; i < READ_ITERS; i++)
+        {
+            LexIO::Rewind(stream);
+            benchmark::DoNotOptimize(LexIO::TryReadU32LE(out, stream));
+        }
+    }
+    LexIO::ClearLastError();
+}
+BENCHMARK(Bench_TryReadU32LEEOF);
+
 static void Bench_ReadU32LE(benchmark::State &state)
 {
     LexIO::VectorStream stream;
@@ -269,4 +292,659 @@ static void Bench_ReadU32LE(benchmark::State &state)
 }
 BENCHMARK(Bench_ReadU32LE);
 
+static void Bench_ReadU32LERef(benchmark::State &state)
+{
+    LexIO::VectorStream stream;
+    for (size_t i = 0; i < READ_ITERS; i++)
+    {
+        LexIO::WriteU32LE(stream, 0xDEADBEEF);
+    }
+    const LexIO::ReaderRef reader{stream};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LexIO::Rewind(stream);
+        uint32_t data = 0;
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < READ_ITERS; i++)
+        {
+            data = LexIO::ReadU32LE(reader);
+        }
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(Bench_ReadU32LERef);
+
+static void Bench_ReadU32LEBuffered(benchmark::State &state)
+{
+    LexIO::VectorStream stream;
+    for (size_t i = 0; i < READ_ITERS; i++)
+    {
+        LexIO::WriteU32LE(stream, 0xDEADBEEF);
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LexIO::Rewind(stream);
+        LexIO::GenericBufReader<LexIO::VectorStream> bufReader{LexIO::VectorStream{stream}};
+        LexIO::FillBuffer(bufReader, sizeof(uint32_t) * READ_ITERS);
+        uint32_t data = 0;
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < READ_ITERS; i++)
+        {
+            data = LexIO::ReadU32LE(bufReader);
+        }
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(Bench_ReadU32LEBuffered);
+
+static void Bench_WriteU32LE(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<uint8_t> buffer;
+        buffer.reserve(sizeof(uint32_t) * WRITE_ITERS);
+        LexIO::VectorStream stream{std::move(buffer)};
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < WRITE_ITERS; i++)
+        {
+            LexIO::WriteU32LE(stream, 0xDEADBEEF);
+        }
+        benchmark::DoNotOptimize(stream);
+    }
+}
+BENCHMARK(Bench_WriteU32LE);
+
+//******************************************************************************
+
+static void Bench_ReadUVarint32(benchmark::State &state)
+{
+    LexIO::VectorStream stream;
+    for (size_t i = 0; i < READ_ITERS; i++)
+    {
+        LexIO::WriteUVarint32(stream, 0xDEADBEEF);
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LexIO::Rewind(stream);
+        uint32_t data = 0;
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < READ_ITERS; i++)
+        {
+            data = LexIO::ReadUVarint32(stream);
+        }
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(Bench_ReadUVarint32);
+
+static void Bench_ReadUVarint32Ref(benchmark::State &state)
+{
+    LexIO::VectorStream stream;
+    for (size_t i = 0; i < READ_ITERS; i++)
+    {
+        LexIO::WriteUVarint32(stream, 0xDEADBEEF);
+    }
+    const LexIO::ReaderRef reader{stream};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LexIO::Rewind(stream);
+        uint32_t data = 0;
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < READ_ITERS; i++)
+        {
+            data = LexIO::ReadUVarint32(reader);
+        }
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(Bench_ReadUVarint32Ref);
+
+//******************************************************************************
+
+constexpr size_t READ_TO_EOF_SIZE = 1024 * 1024;
+
+static void Bench_ReadToEOFBackInserter(benchmark::State &state)
+{
+    LexIO::VectorStream stream{std::vector<uint8_t>(READ_TO_EOF_SIZE, 'X')};
+
+    for (auto _ : state)
+    {
+        LexIO::Rewind(stream);
+        std::vector<uint8_t> data;
+        LexIO::ReadToEOF(std::back_inserter(data), LexIO::UnbufferedReaderRef{stream});
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+BENCHMARK(Bench_ReadToEOFBackInserter);
+
+static void Bench_ReadToEOFContainer(benchmark::State &state)
+{
+    LexIO::VectorStream stream{std::vector<uint8_t>(READ_TO_EOF_SIZE, 'X')};
+
+    for (auto _ : state)
+    {
+        LexIO::Rewind(stream);
+        std::vector<uint8_t> data;
+        LexIO::ReadToEOF(data, stream);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+BENCHMARK(Bench_ReadToEOFContainer);
+
+//******************************************************************************
+
+constexpr size_t CONSUME_WINDOW = 65536;
+
+static void Bench_BufReaderSmallConsume(benchmark::State &state)
+{
+    std::vector<uint8_t> data(CONSUME_WINDOW, 'X');
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        LexIO::GenericBufReader<LexIO::VectorStream> bufReader{LexIO::VectorStream{data}};
+        LexIO::FillBuffer(bufReader, CONSUME_WINDOW);
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < CONSUME_WINDOW; i += 4)
+        {
+            LexIO::BufferView view = LexIO::FillBuffer(bufReader, 4);
+            benchmark::DoNotOptimize(view.Data()[0]);
+            LexIO::ConsumeBuffer(bufReader, 4);
+        }
+    }
+}
+BENCHMARK(Bench_BufReaderSmallConsume);
+
+//******************************************************************************
+
+constexpr size_t STALL_RECORD_SIZE = 100;
+constexpr size_t STALL_RECORDS = 20000;
+
+/**
+ * @brief A writer that discards data after stalling like a slow device.
+ */
+class StallWriter
+{
+  public:
+    size_t LexWrite(const uint8_t *, size_t count)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        return count;
+    }
+
+    void LexFlush() {}
+};
+
+/**
+ * @brief Write small records through a buffered writer, and report the
+ *        slowest single write.
+ */
+template <typename BUFFERED_WRITER>
+static void WriteRecords(benchmark::State &state, BUFFERED_WRITER &writer)
+{
+    const std::vector<uint8_t> record(STALL_RECORD_SIZE, 'X');
+    double worst = 0;
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < STALL_RECORDS; i++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            LexIO::Write(writer, record.data(), record.size());
+            const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            worst = std::max(worst, elapsed.count());
+        }
+        LexIO::Flush(writer);
+    }
+    state.counters["max_write_us"] = worst;
+}
+
+static void Bench_FixedBufWriterStall(benchmark::State &state)
+{
+    LexIO::FixedBufWriter<StallWriter> writer{StallWriter{}, 65536};
+    WriteRecords(state, writer);
+}
+BENCHMARK(Bench_FixedBufWriterStall)->UseRealTime();
+
+static void Bench_AsyncBufWriterStall(benchmark::State &state)
+{
+    LexIO::AsyncBufWriter<StallWriter> writer{StallWriter{}, 65536};
+    WriteRecords(state, writer);
+}
+BENCHMARK(Bench_AsyncBufWriterStall)->UseRealTime();
+
+//******************************************************************************
+
+#if !defined(_WIN32)
+
+static void Bench_FileSeekTell(benchmark::State &state)
+{
+    char filename[] = "/tmp/lexbenchXXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd == -1)
+    {
+        state.SkipWithError("could not create temporary file");
+        return;
+    }
+    close(fd);
+
+    auto file = LexIO::FileOpen(filename, LexIO::OpenMode::writePlus);
+    file.SetOffsetCache(state.range(0) != 0);
+
+    for (auto _ : state)
+    {
+        LexIO::Seek(file, 4, LexIO::Whence::current);
+        benchmark::DoNotOptimize(LexIO::Tell(file));
+    }
+
+    unlink(filename);
+}
+BENCHMARK(Bench_FileSeekTell)->Arg(0)->Arg(1);
+
+#endif
+
+//******************************************************************************
+
+#if defined(__linux__)
+
+constexpr size_t URING_FILE_SIZE = 16 * 1024 * 1024;
+constexpr size_t URING_CHUNK_SIZE = 64 * 1024;
+
+/**
+ * @brief Creates a file to read from on tmpfs (arg 0) or disk (arg 1), and
+ *        deletes it at the end of the benchmark.
+ */
+class BenchFile
+{
+    std::string m_filename;
+
+  public:
+    BenchFile(benchmark::State &state)
+    {
+        char filename[32];
+        std::strcpy(filename, state.range(0) == 0 ? "/dev/shm/lexbenchXXXXXX" : "/var/tmp/lexbenchXXXXXX");
+        const int fd = mkstemp(filename);
+        if (fd == -1)
+        {
+            state.SkipWithError("could not create temporary file");
+            return;
+        }
+        close(fd);
+        m_filename = filename;
+
+        auto file = LexIO::FileOpen(filename, LexIO::OpenMode::write);
+        const std::vector<uint8_t> data(URING_FILE_SIZE, 'X');
+        LexIO::WriteExact(file, data.data(), data.size());
+        file.Sync();
+    }
+    ~BenchFile()
+    {
+        if (!m_filename.empty())
+        {
+            unlink(m_filename.c_str());
+        }
+    }
+    const char *Name() const { return m_filename.c_str(); }
+};
+
+static void Bench_FilePOSIXRead(benchmark::State &state)
+{
+    BenchFile bench{state};
+    auto file = LexIO::FileOpen(bench.Name(), LexIO::OpenMode::read);
+    std::vector<uint8_t> buffer(URING_CHUNK_SIZE);
+
+    for (auto _ : state)
+    {
+        LexIO::Rewind(file);
+        while (LexIO::Read(buffer.data(), file, buffer.size()) != 0)
+        {
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(URING_FILE_SIZE));
+}
+BENCHMARK(Bench_FilePOSIXRead)->Arg(0)->Arg(1);
+
+static void Bench_IoUringFileRead(benchmark::State &state)
+{
+    BenchFile bench{state};
+    auto file = LexIO::IoUringFileOpen(bench.Name(), LexIO::OpenMode::read);
+    std::vector<uint8_t> buffer(URING_CHUNK_SIZE);
+
+    for (auto _ : state)
+    {
+        LexIO::Rewind(file);
+        while (LexIO::Read(buffer.data(), file, buffer.size()) != 0)
+        {
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(URING_FILE_SIZE));
+}
+BENCHMARK(Bench_IoUringFileRead)->Arg(0)->Arg(1);
+
+static void Bench_IoUringFileBatchRead(benchmark::State &state)
+{
+    constexpr size_t QUEUE_DEPTH = 32;
+
+    BenchFile bench{state};
+    auto file = LexIO::IoUringFileOpen(bench.Name(), LexIO::OpenMode::read, QUEUE_DEPTH);
+    std::vector<uint8_t> buffer(URING_CHUNK_SIZE * QUEUE_DEPTH);
+    const LexIO::MutableBufferView registered{buffer.data(), buffer.size()};
+    file.RegisterBuffers(&registered, 1);
+
+    LexIO::IoUringCompletion completions[QUEUE_DEPTH];
+    for (auto _ : state)
+    {
+        // Keep QUEUE_DEPTH reads in flight, one per slice of the buffer.
+        size_t offset = 0, inFlight = 0;
+        for (; inFlight < QUEUE_DEPTH && offset < URING_FILE_SIZE; inFlight++, offset += URING_CHUNK_SIZE)
+        {
+            file.QueueReadFixed(&buffer[inFlight * URING_CHUNK_SIZE], URING_CHUNK_SIZE, offset, 0, inFlight);
+        }
+
+        while (inFlight != 0)
+        {
+            const size_t reaped = file.Reap(&completions[0], QUEUE_DEPTH, 1);
+            inFlight -= reaped;
+            for (size_t i = 0; i < reaped; i++, offset += URING_CHUNK_SIZE)
+            {
+                if (offset < URING_FILE_SIZE)
+                {
+                    const size_t slot = size_t(completions[i].userData);
+                    file.QueueReadFixed(&buffer[slot * URING_CHUNK_SIZE], URING_CHUNK_SIZE, offset, 0, slot);
+                    inFlight += 1;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(URING_FILE_SIZE));
+}
+BENCHMARK(Bench_IoUringFileBatchRead)->Arg(0)->Arg(1);
+
+/**
+ * @brief Stand-in for a parser, spends a few cycles on every byte.
+ */
+template <typename BUFFERED_READER>
+static uint64_t DecodeAll(BUFFERED_READER &reader)
+{
+    uint64_t hash = 0;
+    for (;;)
+    {
+        const LexIO::BufferView view = LexIO::FillBuffer(reader, 4096);
+        if (view.Size() == 0)
+        {
+            return hash;
+        }
+        for (size_t i = 0; i < view.Size(); i++)
+        {
+            hash = (hash ^ view.Data()[i]) * 0x100000001b3;
+        }
+        LexIO::ConsumeBuffer(reader, view.Size());
+    }
+}
+
+static void Bench_GenericBufReaderDecode(benchmark::State &state)
+{
+    BenchFile bench{state};
+    for (auto _ : state)
+    {
+        auto file = LexIO::FileOpen(bench.Name(), LexIO::OpenMode::read);
+        file.Advise(LexIO::AccessHint::dontNeed);
+        LexIO::GenericBufReader<LexIO::File> reader{std::move(file)};
+        benchmark::DoNotOptimize(DecodeAll(reader));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(URING_FILE_SIZE));
+}
+BENCHMARK(Bench_GenericBufReaderDecode)->Arg(0)->Arg(1)->UseRealTime();
+
+static void Bench_AsyncBufReaderDecode(benchmark::State &state)
+{
+    BenchFile bench{state};
+    for (auto _ : state)
+    {
+        auto file = LexIO::FileOpen(bench.Name(), LexIO::OpenMode::read);
+        file.Advise(LexIO::AccessHint::dontNeed);
+        LexIO::AsyncBufReader<LexIO::File> reader{std::move(file), URING_CHUNK_SIZE};
+        benchmark::DoNotOptimize(DecodeAll(reader));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(URING_FILE_SIZE));
+}
+BENCHMARK(Bench_AsyncBufReaderDecode)->Arg(0)->Arg(1)->UseRealTime();
+
+constexpr size_t COMMIT_RECORD_SIZE = 128;
+
+/**
+ * @brief Open a file on disk that syncs with fdatasync(2) on flush.
+ */
+static LexIO::File OpenCommitLog(const char *filename)
+{
+    auto file = LexIO::FileOpen(filename, LexIO::OpenMode::write);
+    LexIO::SyncPolicy policy;
+    policy.mode = LexIO::SyncMode::fdatasync;
+    file.SetSyncPolicy(policy);
+    return file;
+}
+
+/**
+ * @brief One commit per iteration per thread, each behind a shared mutex
+ *        and followed by its own sync.
+ */
+static void Bench_MutexCommit(benchmark::State &state)
+{
+    static std::mutex mutex;
+    static std::unique_ptr<LexIO::FixedBufWriter<LexIO::File>> writer;
+    if (state.thread_index() == 0)
+    {
+        writer.reset(new LexIO::FixedBufWriter<LexIO::File>{OpenCommitLog("/var/tmp/lexbench_commit")});
+    }
+
+    const std::vector<uint8_t> record(COMMIT_RECORD_SIZE, 'X');
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        LexIO::Write(*writer, record.data(), record.size());
+        LexIO::Flush(*writer);
+    }
+
+    if (state.thread_index() == 0)
+    {
+        writer.reset();
+        unlink("/var/tmp/lexbench_commit");
+    }
+}
+BENCHMARK(Bench_MutexCommit)->ThreadRange(1, 16)->UseRealTime();
+
+/**
+ * @brief One commit per iteration per thread, grouped into batches that
+ *        share a sync.
+ */
+static void Bench_GroupCommit(benchmark::State &state)
+{
+    static std::unique_ptr<LexIO::GroupCommitWriter<LexIO::File>> writer;
+    if (state.thread_index() == 0)
+    {
+        writer.reset(new LexIO::GroupCommitWriter<LexIO::File>{OpenCommitLog("/var/tmp/lexbench_commit")});
+    }
+
+    const std::vector<uint8_t> record(COMMIT_RECORD_SIZE, 'X');
+    for (auto _ : state)
+    {
+        writer->Commit(record.data(), record.size());
+    }
+
+    if (state.thread_index() == 0)
+    {
+        writer.reset();
+        unlink("/var/tmp/lexbench_commit");
+    }
+}
+BENCHMARK(Bench_GroupCommit)->ThreadRange(1, 16)->UseRealTime();
+
+constexpr size_t EXPORT_RECORD_SIZE = 256;
+constexpr size_t EXPORT_RECORDS = 4096;
+
+/**
+ * @brief Every thread writes its share of records through one buffered
+ *        writer behind a shared mutex.
+ */
+static void Bench_MutexExport(benchmark::State &state)
+{
+    static std::mutex mutex;
+    static std::unique_ptr<LexIO::FixedBufWriter<LexIO::File>> writer;
+    if (state.thread_index() == 0)
+    {
+        writer.reset(new LexIO::FixedBufWriter<LexIO::File>{
+            LexIO::FileOpen("/var/tmp/lexbench_export", LexIO::OpenMode::write), 1024 * 1024});
+    }
+
+    const std::vector<uint8_t> record(EXPORT_RECORD_SIZE, 'X');
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < EXPORT_RECORDS; i++)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            LexIO::Write(*writer, record.data(), record.size());
+        }
+    }
+    if (state.thread_index() == 0)
+    {
+        writer.reset();
+        unlink("/var/tmp/lexbench_export");
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(EXPORT_RECORDS * EXPORT_RECORD_SIZE));
+}
+BENCHMARK(Bench_MutexExport)->ThreadRange(1, 8)->Iterations(64)->UseRealTime();
+
+/**
+ * @brief Every thread writes its share of records through its own sink.
+ */
+static void Bench_ParallelExport(benchmark::State &state)
+{
+    static std::unique_ptr<LexIO::ParallelFileWriter> writer;
+    if (state.thread_index() == 0)
+    {
+        auto file = LexIO::FileOpen("/var/tmp/lexbench_export", LexIO::OpenMode::write);
+        writer.reset(new LexIO::ParallelFileWriter{std::move(file)});
+    }
+
+    const std::vector<uint8_t> record(EXPORT_RECORD_SIZE, 'X');
+    for (auto _ : state)
+    {
+        LexIO::ParallelFileSink sink = writer->Sink();
+        for (size_t i = 0; i < EXPORT_RECORDS; i++)
+        {
+            LexIO::Write(sink, record.data(), record.size());
+        }
+    }
+    if (state.thread_index() == 0)
+    {
+        writer.reset();
+        unlink("/var/tmp/lexbench_export");
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(EXPORT_RECORDS * EXPORT_RECORD_SIZE));
+}
+BENCHMARK(Bench_ParallelExport)->ThreadRange(1, 8)->Iterations(64)->UseRealTime();
+
+#endif
+
+#if defined(__linux__)
+
+constexpr size_t STAGE_CHUNK_SIZE = 64 * 1024;
+constexpr size_t STAGE_CHUNKS = 256;
+
+/**
+ * @brief Pass each chunk to the next stage as its own VectorStream through a
+ *        locked queue.
+ */
+static void Bench_VectorHandoff(benchmark::State &state)
+{
+    const std::vector<uint8_t> chunk(STAGE_CHUNK_SIZE, 'X');
+    for (auto _ : state)
+    {
+        std::mutex mutex;
+        std::condition_variable ready;
+        std::deque<LexIO::VectorStream> queue;
+
+        std::thread producer([&] {
+            for (size_t i = 0; i < STAGE_CHUNKS; i++)
+            {
+                LexIO::VectorStream stream{chunk};
+                std::lock_guard<std::mutex> lock{mutex};
+                queue.push_back(std::move(stream));
+                ready.notify_one();
+            }
+        });
+
+        size_t total = 0;
+        for (size_t i = 0; i < STAGE_CHUNKS; i++)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            ready.wait(lock, [&] { return !queue.empty(); });
+            LexIO::VectorStream stream = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+
+            total += LexIO::Length(stream);
+        }
+        producer.join();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(STAGE_CHUNKS * STAGE_CHUNK_SIZE));
+}
+BENCHMARK(Bench_VectorHandoff)->UseRealTime();
+
+/**
+ * @brief Stream the same chunks to the next stage through a pipe.
+ */
+static void Bench_PipeHandoff(benchmark::State &state)
+{
+    const std::vector<uint8_t> chunk(STAGE_CHUNK_SIZE, 'X');
+    for (auto _ : state)
+    {
+        LexIO::Pipe pipe = LexIO::PipeOpen(4 * STAGE_CHUNK_SIZE);
+
+        std::thread producer([&] {
+            for (size_t i = 0; i < STAGE_CHUNKS; i++)
+            {
+                LexIO::Write(pipe.writer, chunk.data(), chunk.size());
+            }
+            pipe.writer.Close();
+        });
+
+        size_t total = 0;
+        for (;;)
+        {
+            const size_t count = LexIO::FillBuffer(pipe.reader, 1).Size();
+            if (count == 0)
+            {
+                break;
+            }
+            LexIO::ConsumeBuffer(pipe.reader, count);
+            total += count;
+        }
+        producer.join();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(STAGE_CHUNKS * STAGE_CHUNK_SIZE));
+}
+BENCHMARK(Bench_PipeHandoff)->UseRealTime();
+
+#endif
+
 BENCHMARK_MAIN();
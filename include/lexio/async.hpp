@@ -0,0 +1,1012 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+/**
+ * @file async.hpp
+ * @brief Buffered streams that do their I/O on a background thread.
+ */
+
+#pragma once
+
+#include "./core.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LexIO
+{
+
+namespace Detail
+{
+
+/**
+ * @brief State shared between an AsyncBufReader and its I/O thread.
+ *
+ * @detail Chunks form a ring that the I/O thread fills in order and the
+ *         consumer takes in order.  Each chunk is allocated at twice its
+ *         size, and the I/O thread only fills the back half, so the
+ *         consumer can copy unconsumed bytes from the previous chunk into
+ *         the front half and present both as one contiguous buffer.
+ */
+template <typename READER>
+struct AsyncReadState
+{
+    struct Chunk
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size = 0;
+        bool eof = false;
+        std::exception_ptr error;
+    };
+
+    READER reader;
+    const size_t chunkSize;
+    std::vector<Chunk> chunks;
+
+    std::mutex mutex;
+    std::condition_variable readyCV;
+    std::condition_variable freeCV;
+    size_t next = 0;    // Chunk the consumer takes next.
+    size_t ready = 0;   // Chunks filled and not yet taken.
+    size_t holding = 0; // Chunks taken and not yet released.
+    bool stop = false;
+
+    std::thread thread;
+
+    AsyncReadState(READER &&reader, size_t chunkSize, size_t chunkCount)
+        : reader(std::move(reader)), chunkSize(chunkSize), chunks(chunkCount)
+    {
+        for (Chunk &chunk : chunks)
+        {
+            chunk.data.reset(::new uint8_t[chunkSize * 2]);
+        }
+    }
+
+    /**
+     * @brief Body of the I/O thread.  Fills chunks until the reader hits
+     *        EOF or throws, or until the consumer goes away.
+     */
+    void Run()
+    {
+        for (size_t index = 0;; index = (index + 1) % chunks.size())
+        {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                freeCV.wait(lock, [this] { return stop || ready + holding < chunks.size(); });
+                if (stop)
+                {
+                    return;
+                }
+            }
+
+            // The consumer can't see this chunk until it's published, so
+            // it's safe to fill outside the lock.
+            Chunk &chunk = chunks[index];
+            chunk.size = 0;
+            chunk.eof = false;
+            // Publish after a single read, even a short one, so bytes from a
+            // pipe or socket aren't held back waiting for more to arrive.
+            LEXIO_TRY
+            {
+                chunk.size = RawRead(chunk.data.get() + chunkSize, reader, chunkSize);
+                chunk.eof = chunk.size == 0;
+            }
+            LEXIO_CATCH_ALL
+            {
+                chunk.error = std::current_exception();
+                chunk.eof = true;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                ready += 1;
+            }
+            readyCV.notify_one();
+
+            if (chunk.eof)
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Wait for the next chunk to be filled and take it.
+     */
+    Chunk &Take()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        readyCV.wait(lock, [this] { return ready != 0; });
+
+        Chunk &chunk = chunks[next];
+        next = (next + 1) % chunks.size();
+        ready -= 1;
+        holding += 1;
+        return chunk;
+    }
+
+    /**
+     * @brief Give the oldest taken chunk back to the I/O thread.
+     */
+    void Release()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            holding -= 1;
+        }
+        freeCV.notify_one();
+    }
+
+    /**
+     * @brief Stop the I/O thread and wait for it to exit.  A read that is
+     *        already in progress is allowed to finish.
+     */
+    void Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        freeCV.notify_one();
+        thread.join();
+    }
+};
+
+/**
+ * @brief State shared between an AsyncBufWriter and its I/O thread.
+ *
+ * @detail Buffers move between three places: the one the producer is
+ *         filling, a FIFO queue of full buffers waiting to be written, and
+ *         a free list.  The buffer count bounds the queue, so a producer
+ *         that outruns the device waits for a buffer to come back.
+ */
+template <typename WRITER>
+struct AsyncWriteState
+{
+    struct Pending
+    {
+        size_t index;
+        size_t size;
+    };
+
+    WRITER writer;
+    const size_t bufferSize;
+    std::vector<std::unique_ptr<uint8_t[]>> buffers;
+
+    std::mutex mutex;
+    std::condition_variable workCV;
+    std::condition_variable doneCV;
+    std::deque<Pending> queue;
+    std::vector<size_t> freeList;
+    uint64_t flushWanted = 0;
+    uint64_t flushDone = 0;
+    bool stop = false;
+
+    // Set once a write or flush fails.  Everything queued after the
+    // failure is dropped, since writing it would leave a gap.
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    std::thread thread;
+
+    AsyncWriteState(WRITER &&writer, size_t bufferSize, size_t bufferCount)
+        : writer(std::move(writer)), bufferSize(bufferSize), buffers(bufferCount)
+    {
+        for (size_t i = 0; i < bufferCount; i++)
+        {
+            buffers[i].reset(::new uint8_t[bufferSize]);
+            if (i != 0)
+            {
+                freeList.push_back(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Body of the I/O thread.  Writes queued buffers in order and
+     *        flushes the wrapped Writer once everything before a flush
+     *        request has been written, until asked to stop with nothing
+     *        left to do.
+     */
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        for (;;)
+        {
+            workCV.wait(lock, [this] { return stop || !queue.empty() || flushDone != flushWanted; });
+            if (!queue.empty())
+            {
+                const Pending pending = queue.front();
+                queue.pop_front();
+                if (error == nullptr)
+                {
+                    lock.unlock();
+                    std::exception_ptr caught;
+                    LEXIO_TRY
+                    {
+                        WriteExact(writer, buffers[pending.index].get(), pending.size);
+                    }
+                    LEXIO_CATCH_ALL
+                    {
+                        caught = std::current_exception();
+                    }
+                    lock.lock();
+                    Fail(caught);
+                }
+                freeList.push_back(pending.index);
+                doneCV.notify_all();
+            }
+            else if (flushDone != flushWanted)
+            {
+                const uint64_t wanted = flushWanted;
+                if (error == nullptr)
+                {
+                    lock.unlock();
+                    std::exception_ptr caught;
+                    LEXIO_TRY
+                    {
+                        Flush(writer);
+                    }
+                    LEXIO_CATCH_ALL
+                    {
+                        caught = std::current_exception();
+                    }
+                    lock.lock();
+                    Fail(caught);
+                }
+                flushDone = wanted;
+                doneCV.notify_all();
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Record the first error, must be called with the lock held.
+     */
+    void Fail(const std::exception_ptr &caught)
+    {
+        if (caught != nullptr && error == nullptr)
+        {
+            error = caught;
+            failed.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Queue a full buffer, then wait for a free one to take its
+     *        place.
+     *
+     * @return Index of the free buffer.
+     */
+    size_t Swap(size_t index, size_t size)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        queue.push_back(Pending{index, size});
+        workCV.notify_one();
+        doneCV.wait(lock, [this] { return !freeList.empty(); });
+
+        const size_t next = freeList.back();
+        freeList.pop_back();
+        return next;
+    }
+
+    /**
+     * @brief Wait for everything queued so far to be written and for the
+     *        wrapped Writer to be flushed.
+     */
+    void FlushAndWait()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        const uint64_t wanted = ++flushWanted;
+        workCV.notify_one();
+        doneCV.wait(lock, [this, wanted] { return flushDone >= wanted; });
+    }
+
+    /**
+     * @brief Write everything that was queued, then stop the I/O thread and
+     *        wait for it to exit.
+     */
+    void Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        workCV.notify_one();
+        thread.join();
+    }
+};
+
+/**
+ * @brief State shared between a GroupCommitWriter, its producers, and its
+ *        flusher thread.
+ *
+ * @detail Producers append to a staging buffer under the lock, which is
+ *         held only long enough to copy a record.  The flusher swaps the
+ *         staging buffer for an empty one, so producers keep appending
+ *         while a batch is written and synced.
+ */
+template <typename WRITER>
+struct GroupCommitState
+{
+    WRITER writer;
+    const size_t maxBatch;
+
+    std::mutex mutex;
+    std::condition_variable workCV;
+    std::condition_variable durableCV;
+    std::condition_variable spaceCV;
+    std::vector<uint8_t> staging;
+    uint64_t appended = 0;
+    uint64_t durable = 0;
+    uint64_t batches = 0;
+    bool stop = false;
+    std::exception_ptr error;
+
+    std::thread thread;
+
+    GroupCommitState(WRITER &&writer, size_t maxBatch) : writer(std::move(writer)), maxBatch(maxBatch)
+    {
+        staging.reserve(maxBatch);
+    }
+
+    /**
+     * @brief Body of the flusher thread.  Writes and flushes one batch at a
+     *        time until asked to stop with nothing left to write.
+     */
+    void Run()
+    {
+        std::vector<uint8_t> batch;
+        batch.reserve(maxBatch);
+
+        std::unique_lock<std::mutex> lock{mutex};
+        for (;;)
+        {
+            workCV.wait(lock, [this] { return stop || !staging.empty(); });
+            if (staging.empty())
+            {
+                return;
+            }
+
+            // Everything staged so far goes out in this batch.
+            std::swap(batch, staging);
+            const uint64_t batchEnd = appended;
+            spaceCV.notify_all();
+
+            if (error == nullptr)
+            {
+                lock.unlock();
+                std::exception_ptr caught;
+                LEXIO_TRY
+                {
+                    WriteExact(writer, batch.data(), batch.size());
+                    Flush(writer);
+                }
+                LEXIO_CATCH_ALL
+                {
+                    caught = std::current_exception();
+                }
+                lock.lock();
+
+                if (caught != nullptr)
+                {
+                    error = caught;
+                }
+                else
+                {
+                    durable = batchEnd;
+                    batches += 1;
+                }
+            }
+
+            batch.clear();
+            durableCV.notify_all();
+        }
+    }
+
+    /**
+     * @brief Stage a record, waiting for room if the next batch is full.
+     *
+     * @return Ticket that is durable once the record is.
+     */
+    uint64_t Append(const uint8_t *src, size_t count)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        spaceCV.wait(lock, [this, count] {
+            return error != nullptr || staging.empty() || staging.size() + count <= maxBatch;
+        });
+        if (error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+
+        const bool wasEmpty = staging.empty();
+        staging.insert(staging.end(), src, src + count);
+        appended += count;
+        const uint64_t ticket = appended;
+        lock.unlock();
+
+        if (wasEmpty)
+        {
+            workCV.notify_one();
+        }
+        return ticket;
+    }
+
+    /**
+     * @brief Wait until everything up to a ticket is durable.
+     */
+    void Wait(uint64_t ticket)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        durableCV.wait(lock, [this, ticket] { return durable >= ticket || error != nullptr; });
+        if (durable < ticket)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief Write and flush everything that was staged, then stop the
+     *        flusher thread and wait for it to exit.
+     */
+    void Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+        workCV.notify_one();
+        thread.join();
+    }
+};
+
+} // namespace Detail
+
+/**
+ * @brief Add buffering to any Reader, with reads done ahead of time on a
+ *        background thread.
+ *
+ * @detail A dedicated thread fills chunks from the wrapped Reader while
+ *         the consumer works through the current one, so decoding and
+ *         waiting on the device overlap.  Each chunk is handed over after
+ *         one read, so a short read from a pipe or socket is seen right
+ *         away rather than once a whole chunk has arrived.  With two chunks
+ *         this is double buffering; more chunks let the thread run further
+ *         ahead of a bursty consumer.
+ *
+ *         The wrapped Reader belongs to the I/O thread for the lifetime of
+ *         the AsyncBufReader and can't be seeked or accessed directly.  An
+ *         exception thrown by the wrapped Reader is rethrown from the
+ *         consumer once it has consumed all data read before the failure,
+ *         after which the stream behaves as if it were at EOF.
+ *
+ * @tparam READER Reader type to wrap.
+ */
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+class AsyncBufReader
+{
+    using State = Detail::AsyncReadState<READER>;
+    using Chunk = typename State::Chunk;
+
+    std::unique_ptr<State> m_state;
+    Chunk *m_chunk = nullptr;
+    size_t m_start = 0;
+    size_t m_end = 0;
+    bool m_eof = false;
+    std::exception_ptr m_error;
+
+    /**
+     * @brief Number of unconsumed bytes in the buffer.
+     */
+    size_t BufferSize() const { return m_end - m_start; }
+
+    /**
+     * @brief Move on to the next chunk, carrying over unconsumed bytes from
+     *        the current one.
+     */
+    void NextChunk()
+    {
+        Chunk &chunk = m_state->Take();
+
+        const size_t size = BufferSize();
+        const size_t start = m_state->chunkSize - size;
+        if (m_chunk != nullptr)
+        {
+            std::memcpy(chunk.data.get() + start, m_chunk->data.get() + m_start, size);
+            m_state->Release();
+        }
+
+        m_chunk = &chunk;
+        m_start = start;
+        m_end = m_state->chunkSize + chunk.size;
+        m_eof = chunk.eof;
+        m_error = std::exchange(chunk.error, nullptr);
+    }
+
+    /**
+     * @brief Stop the I/O thread and free the chunks.
+     */
+    void Destroy()
+    {
+        if (m_state != nullptr)
+        {
+            m_state->Shutdown();
+            m_state.reset();
+        }
+        m_chunk = nullptr;
+    }
+
+  public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+    static constexpr size_t DEFAULT_CHUNK_COUNT = 2;
+
+    AsyncBufReader(const AsyncBufReader &) = delete;
+    AsyncBufReader &operator=(const AsyncBufReader &) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    AsyncBufReader(AsyncBufReader &&other) noexcept
+        : m_state(std::move(other.m_state)), m_chunk(std::exchange(other.m_chunk, nullptr)), m_start(other.m_start),
+          m_end(other.m_end), m_eof(other.m_eof), m_error(std::move(other.m_error))
+    {
+    }
+
+    /**
+     * @brief Constructor from existing Reader, which starts the I/O thread.
+     *
+     * @param reader Reader to wrap.
+     * @param chunkSize Size of each read from the wrapped Reader, and the
+     *                  largest amount LexFillBuffer can be asked for.
+     * @param chunkCount Number of chunks, at least two: one being consumed
+     *                   and one being filled.
+     */
+    AsyncBufReader(READER &&reader, size_t chunkSize = DEFAULT_CHUNK_SIZE, size_t chunkCount = DEFAULT_CHUNK_COUNT)
+    {
+        if (chunkSize == 0 || chunkCount < 2)
+        {
+            LEXIO_THROW(std::runtime_error("async reader needs at least two chunks of at least one byte"));
+        }
+
+        m_state.reset(new State{std::move(reader), chunkSize, chunkCount});
+        State *state = m_state.get();
+        state->thread = std::thread{[state] { state->Run(); }};
+    }
+
+    /**
+     * @brief Destructor, which stops the I/O thread.
+     */
+    ~AsyncBufReader() { Destroy(); }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    AsyncBufReader &operator=(AsyncBufReader &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Destroy();
+        m_state = std::move(other.m_state);
+        m_chunk = std::exchange(other.m_chunk, nullptr);
+        m_start = other.m_start;
+        m_end = other.m_end;
+        m_eof = other.m_eof;
+        m_error = std::move(other.m_error);
+        return *this;
+    }
+
+    /**
+     * @brief Return the largest number of bytes that can be buffered at
+     *        once.
+     */
+    size_t Capacity() const { return m_state->chunkSize; }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        // Take at most one new chunk, the caller will loop if it wants more.
+        BufferView data = LexFillBuffer(BufferSize() == 0 ? 1 : 0);
+        const size_t actualSize = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), actualSize);
+        LexConsumeBuffer(actualSize);
+        return actualSize;
+    }
+
+    BufferView LexFillBuffer(size_t count)
+    {
+        if (count > Capacity())
+        {
+            LEXIO_THROW(std::runtime_error("can't fill buffer past its capacity"));
+        }
+
+        // Unconsumed data is always less than what was asked for, so it
+        // fits in front of the next chunk.
+        while (BufferSize() < count && !m_eof)
+        {
+            NextChunk();
+        }
+
+        if (BufferSize() < count && m_error != nullptr)
+        {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+
+        return BufferView{m_chunk != nullptr ? m_chunk->data.get() + m_start : nullptr, BufferSize()};
+    }
+
+    void LexConsumeBuffer(size_t count)
+    {
+        if (count > BufferSize())
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        m_start += count;
+    }
+};
+
+/**
+ * @brief Add buffering to any Writer, with writes done in the background on
+ *        a dedicated thread.
+ *
+ * @detail Writes are copied into the current buffer, and a full buffer is
+ *         handed to the I/O thread in exchange for an empty one, so the
+ *         producer only waits on the device when every buffer is queued.
+ *         With enough buffers to absorb a device stall, write latency
+ *         depends on memcpy rather than the device.
+ *
+ *         The wrapped Writer belongs to the I/O thread.  An exception it
+ *         throws is rethrown from the next call to LexWrite, LexReserve or
+ *         LexFlush, and from every call after that, since anything written
+ *         after the failure was dropped.  The destructor writes whatever
+ *         is still buffered but can't report errors, so call LexFlush
+ *         first if they matter.
+ *
+ * @tparam WRITER Writer type to wrap.
+ */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+class AsyncBufWriter
+{
+    using State = Detail::AsyncWriteState<WRITER>;
+
+    std::unique_ptr<State> m_state;
+    size_t m_index = 0;
+    size_t m_size = 0;
+
+    /**
+     * @brief Rethrow the error from the I/O thread, if there was one.
+     */
+    void CheckError()
+    {
+        if (m_state->failed.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock{m_state->mutex};
+            std::rethrow_exception(m_state->error);
+        }
+    }
+
+    /**
+     * @brief Hand the current buffer to the I/O thread, if it has anything
+     *        in it.
+     */
+    void SubmitBuffer()
+    {
+        if (m_size != 0)
+        {
+            m_index = m_state->Swap(m_index, m_size);
+            m_size = 0;
+        }
+    }
+
+    /**
+     * @brief Write out what's buffered and stop the I/O thread.
+     */
+    void Destroy()
+    {
+        if (m_state != nullptr)
+        {
+            if (m_size != 0)
+            {
+                std::lock_guard<std::mutex> lock{m_state->mutex};
+                m_state->queue.push_back(typename State::Pending{m_index, m_size});
+            }
+            m_state->Shutdown();
+            m_state.reset();
+        }
+    }
+
+  public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+    static constexpr size_t DEFAULT_BUFFER_COUNT = 4;
+
+    AsyncBufWriter(const AsyncBufWriter &) = delete;
+    AsyncBufWriter &operator=(const AsyncBufWriter &) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    AsyncBufWriter(AsyncBufWriter &&other) noexcept
+        : m_state(std::move(other.m_state)), m_index(other.m_index), m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    /**
+     * @brief Constructor from existing Writer, which starts the I/O thread.
+     *
+     * @param writer Writer to wrap.
+     * @param bufferSize Size of each buffer, and the largest amount
+     *                   LexReserve can be asked for.
+     * @param bufferCount Number of buffers, at least two: one being filled
+     *                    and one being written.
+     */
+    AsyncBufWriter(WRITER &&writer, size_t bufferSize = DEFAULT_BUFFER_SIZE, size_t bufferCount = DEFAULT_BUFFER_COUNT)
+    {
+        if (bufferSize == 0 || bufferCount < 2)
+        {
+            LEXIO_THROW(std::runtime_error("async writer needs at least two buffers of at least one byte"));
+        }
+
+        m_state.reset(new State{std::move(writer), bufferSize, bufferCount});
+        State *state = m_state.get();
+        state->thread = std::thread{[state] { state->Run(); }};
+    }
+
+    /**
+     * @brief Destructor, which writes out anything still buffered and stops
+     *        the I/O thread.
+     */
+    ~AsyncBufWriter() { Destroy(); }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    AsyncBufWriter &operator=(AsyncBufWriter &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Destroy();
+        m_state = std::move(other.m_state);
+        m_index = other.m_index;
+        m_size = std::exchange(other.m_size, 0);
+        return *this;
+    }
+
+    /**
+     * @brief Return the size of each buffer in bytes.
+     */
+    size_t Capacity() const { return m_state->bufferSize; }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        CheckError();
+
+        const size_t bufferSize = m_state->bufferSize;
+        size_t offset = 0;
+        while (offset != count)
+        {
+            const size_t chunk = Detail::Min(count - offset, bufferSize - m_size);
+            std::memcpy(m_state->buffers[m_index].get() + m_size, src + offset, chunk);
+            m_size += chunk;
+            offset += chunk;
+            if (m_size == bufferSize)
+            {
+                SubmitBuffer();
+            }
+        }
+        return count;
+    }
+
+    MutableBufferView LexReserve(size_t count)
+    {
+        CheckError();
+        if (count > m_state->bufferSize)
+        {
+            LEXIO_THROW(std::runtime_error("can't reserve more bytes than buffer size"));
+        }
+
+        if (m_size + count > m_state->bufferSize)
+        {
+            SubmitBuffer();
+        }
+
+        return MutableBufferView{m_state->buffers[m_index].get() + m_size, m_state->bufferSize - m_size};
+    }
+
+    void LexCommit(size_t count)
+    {
+        if (count > m_state->bufferSize - m_size)
+        {
+            LEXIO_THROW(std::runtime_error("can't commit more bytes than were reserved"));
+        }
+
+        m_size += count;
+    }
+
+    void LexFlush()
+    {
+        CheckError();
+        SubmitBuffer();
+        m_state->FlushAndWait();
+        CheckError();
+    }
+};
+
+/**
+ * @brief A Writer that many threads can append records to at once, which
+ *        makes them durable in batches.
+ *
+ * @detail This is the group commit scheme used by write-ahead logs.  Each
+ *         call to Append or LexWrite adds one record to a staging buffer
+ *         and returns a ticket.  A flusher thread writes everything staged
+ *         as one batch and flushes the wrapped Writer once per batch, so
+ *         the more producers are waiting, the more records each flush
+ *         covers.  Records are never interleaved, and appear in the order
+ *         they were appended.
+ *
+ *         For a File, the flush is what makes a batch durable, so set a
+ *         SyncPolicy with SyncMode::fdatasync to get one fdatasync(2) per
+ *         batch.
+ *
+ *         If the wrapped Writer fails, the exception is rethrown to every
+ *         producer waiting on a record that didn't make it, and from every
+ *         call after that.
+ *
+ * @tparam WRITER Writer type to wrap.
+ */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+class GroupCommitWriter
+{
+    using State = Detail::GroupCommitState<WRITER>;
+
+    std::unique_ptr<State> m_state;
+
+  public:
+    static constexpr size_t DEFAULT_MAX_BATCH = 1024 * 1024;
+
+    /**
+     * @brief Constructor from existing Writer, which starts the flusher
+     *        thread.
+     *
+     * @param writer Writer to wrap.
+     * @param maxBatch Producers wait once this many bytes are staged for
+     *                 the next batch.  A single larger record is still
+     *                 accepted into an empty batch.
+     */
+    GroupCommitWriter(WRITER &&writer, size_t maxBatch = DEFAULT_MAX_BATCH)
+        : m_state(new State{std::move(writer), maxBatch})
+    {
+        State *state = m_state.get();
+        state->thread = std::thread{[state] { state->Run(); }};
+    }
+
+    GroupCommitWriter(const GroupCommitWriter &) = delete;
+    GroupCommitWriter &operator=(const GroupCommitWriter &) = delete;
+    GroupCommitWriter(GroupCommitWriter &&other) noexcept = default;
+
+    /**
+     * @brief Destructor, which makes everything appended durable and stops
+     *        the flusher thread.
+     */
+    ~GroupCommitWriter()
+    {
+        if (m_state != nullptr)
+        {
+            m_state->Shutdown();
+        }
+    }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    GroupCommitWriter &operator=(GroupCommitWriter &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        if (m_state != nullptr)
+        {
+            m_state->Shutdown();
+        }
+        m_state = std::move(other.m_state);
+        return *this;
+    }
+
+    /**
+     * @brief Append a record without waiting for it to be durable.  Safe to
+     *        call from any number of threads.
+     *
+     * @param src Pointer to the record.
+     * @param count Size of the record in bytes.
+     * @return Ticket to pass to WaitDurable.
+     * @throws Whatever the wrapped Writer threw, if it has failed.
+     */
+    uint64_t Append(const uint8_t *src, size_t count) { return m_state->Append(src, count); }
+
+    /**
+     * @brief Wait until the record a ticket was returned for, and every
+     *        record before it, is durable.
+     *
+     * @throws Whatever the wrapped Writer threw, if the record was lost.
+     */
+    void WaitDurable(uint64_t ticket) { m_state->Wait(ticket); }
+
+    /**
+     * @brief Append a record and wait for it to be durable.
+     */
+    void Commit(const uint8_t *src, size_t count) { WaitDurable(Append(src, count)); }
+
+    /**
+     * @brief Return the number of batches written and flushed so far.
+     */
+    uint64_t BatchCount() const
+    {
+        std::lock_guard<std::mutex> lock{m_state->mutex};
+        return m_state->batches;
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        Append(src, count);
+        return count;
+    }
+
+    void LexFlush()
+    {
+        uint64_t ticket = 0;
+        {
+            std::lock_guard<std::mutex> lock{m_state->mutex};
+            ticket = m_state->appended;
+        }
+        WaitDurable(ticket);
+    }
+};
+
+#if (LEXIO_CPLUSPLUS < 201703L)
+template <typename READER, typename ENABLE>
+constexpr size_t AsyncBufReader<READER, ENABLE>::DEFAULT_CHUNK_SIZE;
+template <typename READER, typename ENABLE>
+constexpr size_t AsyncBufReader<READER, ENABLE>::DEFAULT_CHUNK_COUNT;
+template <typename WRITER, typename ENABLE>
+constexpr size_t AsyncBufWriter<WRITER, ENABLE>::DEFAULT_BUFFER_SIZE;
+template <typename WRITER, typename ENABLE>
+constexpr size_t AsyncBufWriter<WRITER, ENABLE>::DEFAULT_BUFFER_COUNT;
+template <typename WRITER, typename ENABLE>
+constexpr size_t GroupCommitWriter<WRITER, ENABLE>::DEFAULT_MAX_BATCH;
+#endif
+
+} // namespace LexIO
@@ -32,6 +32,12 @@ namespace LexIO
  * @brief Turn any Reader into a BufferedReader, backed by a buffer allocated
  *        with ::new[] and ::delete[].
  *
+ * @detail The buffer is a sliding window with separate read and write
+ *         cursors.  Consuming data only advances the read cursor, and the
+ *         unconsumed data is only moved to the front of the buffer when a
+ *         fill request cannot be satisfied by the space that remains after
+ *         the write cursor.
+ *
  * @tparam READER Reader type to wrap
  */
 template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
@@ -40,7 +46,8 @@ class GenericBufReader
     READER m_reader;
     std::unique_ptr<uint8_t[]> m_buffer = nullptr;
     size_t m_allocSize = 0;
-    size_t m_size = 0;
+    size_t m_start = 0;
+    size_t m_end = 0;
 
     /**
      * @brief Calculate size of allocated buffer.
@@ -68,6 +75,44 @@ class GenericBufReader
         return wantSize;
     }
 
+    /**
+     * @brief Number of unconsumed bytes in the buffer.
+     */
+    size_t BufferSize() const { return m_end - m_start; }
+
+    /**
+     * @brief Ensure the buffer has space for count bytes past m_start,
+     *        growing or compacting it as needed.
+     *
+     * @param count Number of bytes that must fit in the buffer.
+     */
+    void MakeRoom(size_t count)
+    {
+        if (count <= m_allocSize - m_start)
+        {
+            return;
+        }
+
+        const size_t size = BufferSize();
+        if (count > m_allocSize)
+        {
+            // Reallocate our buffer with any existing data.
+            const size_t newAllocSize = CalcGrowth(count);
+            uint8_t *buffer = ::new uint8_t[newAllocSize];
+            std::memcpy(buffer, m_buffer.get() + m_start, size);
+            m_buffer.reset(buffer);
+            m_allocSize = newAllocSize;
+        }
+        else
+        {
+            // Compact existing data to the front of the buffer.
+            std::memmove(m_buffer.get(), m_buffer.get() + m_start, size);
+        }
+
+        m_start = 0;
+        m_end = size;
+    }
+
   public:
     /**
      * @brief Default constructor.
@@ -79,9 +124,9 @@ class GenericBufReader
      */
     GenericBufReader(const GenericBufReader &other)
         : m_reader(other.m_reader), m_buffer(::new uint8_t[other.m_allocSize]), m_allocSize(other.m_allocSize),
-          m_size(other.m_size)
+          m_end(other.BufferSize())
     {
-        std::memcpy(m_buffer.get(), other.m_buffer.get(), m_size);
+        std::memcpy(m_buffer.get(), other.m_buffer.get() + other.m_start, m_end);
     }
 
     /**
@@ -89,7 +134,7 @@ class GenericBufReader
      */
     GenericBufReader(GenericBufReader &&other) noexcept
         : m_reader(std::move(other.m_reader)), m_buffer(std::exchange(other.m_buffer, nullptr)),
-          m_allocSize(other.m_allocSize), m_size(other.m_size)
+          m_allocSize(other.m_allocSize), m_start(other.m_start), m_end(other.m_end)
     {
     }
 
@@ -119,7 +164,8 @@ class GenericBufReader
         std::swap(m_reader, copy.m_reader);
         std::swap(m_buffer, copy.m_buffer);
         std::swap(m_allocSize, copy.m_allocSize);
-        std::swap(m_size, copy.m_size);
+        std::swap(m_start, copy.m_start);
+        std::swap(m_end, copy.m_end);
         return *this;
     }
 
@@ -136,7 +182,8 @@ class GenericBufReader
         m_reader = std::move(other.m_reader);
         m_buffer = std::exchange(other.m_buffer, nullptr);
         m_allocSize = other.m_allocSize;
-        m_size = other.m_size;
+        m_start = other.m_start;
+        m_end = other.m_end;
         return *this;
     }
 
@@ -153,6 +200,13 @@ class GenericBufReader
 
     size_t LexRead(uint8_t *outDest, size_t count)
     {
+        if (BufferSize() == 0)
+        {
+            // Filling the buffer would read the same amount, so skip the copy
+            // and avoid growing the buffer to the size of large reads.
+            return Read(outDest, m_reader, count);
+        }
+
         BufferView data = LexFillBuffer(count);
         const size_t actualSize = Detail::Min(count, data.Size());
         std::memcpy(outDest, data.Data(), actualSize);
@@ -162,43 +216,411 @@ class GenericBufReader
 
     BufferView LexFillBuffer(size_t count)
     {
-        if (count <= m_size)
+        const size_t size = BufferSize();
+        if (count <= size)
+        {
+            // We already have enough data buffered.
+            return BufferView{m_buffer.get() + m_start, size};
+        }
+
+        MakeRoom(count);
+
+        // Read into the buffer.
+        const size_t wanted = count - size;
+        const size_t actual = Read(m_buffer.get() + m_end, m_reader, wanted);
+        m_end += actual;
+        return BufferView{m_buffer.get() + m_start, BufferSize()};
+    }
+
+    void LexConsumeBuffer(size_t count)
+    {
+        if (count > BufferSize())
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        m_start += count;
+        if (m_start == m_end)
+        {
+            // Buffer is empty, rewind both cursors for free.
+            m_start = 0;
+            m_end = 0;
+        }
+    }
+
+    template <typename TRY_READER = READER, typename = std::enable_if_t<IsTryReaderV<TRY_READER>>>
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+    {
+        BufferView data;
+        const Error err = LexTryFillBuffer(data, count);
+        if (err)
+        {
+            return err;
+        }
+
+        outRead = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), outRead);
+        LexConsumeBuffer(outRead);
+        return Error{};
+    }
+
+    template <typename TRY_READER = READER, typename = std::enable_if_t<IsTryReaderV<TRY_READER>>>
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+    {
+        const size_t size = BufferSize();
+        if (count > size)
+        {
+            MakeRoom(count);
+
+            // Keep whatever was read before an error, it's still valid data.
+            size_t actual = 0;
+            const Error err = Detail::TryReadLoop(actual, m_buffer.get() + m_end, m_reader, count - size);
+            m_end += actual;
+            if (err)
+            {
+                return err;
+            }
+        }
+
+        outBuffer = BufferView{m_buffer.get() + m_start, BufferSize()};
+        return Error{};
+    }
+
+    template <typename FILE_DESCRIPTOR = READER, typename = std::enable_if_t<IsFileDescriptorV<FILE_DESCRIPTOR>>>
+    int LexFileDescriptor()
+    {
+        // The descriptor is positioned past any data we've buffered.
+        return BufferSize() == 0 ? m_reader.LexFileDescriptor() : -1;
+    }
+
+    template <typename SIZE_HINT = READER, typename = std::enable_if_t<IsSizeHintV<SIZE_HINT>>>
+    size_t LexSizeHint()
+    {
+        return BufferSize() + m_reader.LexSizeHint();
+    }
+
+    template <typename WRITER = READER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        // Invalidate buffer.
+        m_start = 0;
+        m_end = 0;
+        return Write(m_reader, src, count);
+    }
+
+    template <typename WRITER = READER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+    void LexFlush()
+    {
+        Flush(m_reader);
+    }
+
+    template <typename SIZED = READER, typename = std::enable_if_t<IsSizedV<SIZED>>>
+    size_t LexLength()
+    {
+        return m_reader.LexLength();
+    }
+
+    template <typename SEEKABLE = READER, typename = std::enable_if_t<IsSeekableV<SEEKABLE>>>
+    size_t LexSeek(const SeekPos &pos)
+    {
+        // Invalidate buffer.
+        m_start = 0;
+        m_end = 0;
+        return Seek(m_reader, pos);
+    }
+};
+
+/**
+ * @brief Add buffering to any Reader, with a fixed-length buffer.
+ *
+ * @detail Fills read ahead as far as the free space in the buffer allows
+ *         using a single call to the wrapped Reader, and reads larger than
+ *         the buffer bypass it entirely when nothing is buffered.  Attempts
+ *         to fill the buffer past its capacity throw instead of growing it.
+ *
+ * @tparam READER Reader type to wrap.
+ */
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+class FixedBufReader
+{
+    static constexpr size_t DEFAULT_ALLOC_SIZE = 8192;
+
+    READER m_reader;
+    uint8_t *m_buffer = nullptr;
+    size_t m_allocSize = DEFAULT_ALLOC_SIZE;
+    size_t m_readAhead = DEFAULT_ALLOC_SIZE;
+    size_t m_start = 0;
+    size_t m_end = 0;
+
+    /**
+     * @brief Number of unconsumed bytes in the buffer.
+     */
+    size_t BufferSize() const { return m_end - m_start; }
+
+  public:
+    /**
+     * @brief Default constructor.
+     *
+     * @param bufSize Size of read buffer in bytes.
+     */
+    FixedBufReader(size_t bufSize = DEFAULT_ALLOC_SIZE)
+        : m_buffer(::new uint8_t[bufSize]), m_allocSize(bufSize), m_readAhead(bufSize)
+    {
+    }
+
+    /**
+     * @brief Copy constructor.
+     */
+    FixedBufReader(const FixedBufReader &other)
+        : m_reader(other.m_reader), m_buffer(::new uint8_t[other.m_allocSize]), m_allocSize(other.m_allocSize),
+          m_readAhead(other.m_readAhead), m_end(other.BufferSize())
+    {
+        std::memcpy(m_buffer, other.m_buffer + other.m_start, m_end);
+    }
+
+    /**
+     * @brief Move constructor.
+     */
+    FixedBufReader(FixedBufReader &&other) noexcept
+        : m_reader(std::move(other.m_reader)), m_buffer(std::exchange(other.m_buffer, nullptr)),
+          m_allocSize(other.m_allocSize), m_readAhead(other.m_readAhead), m_start(other.m_start), m_end(other.m_end)
+    {
+    }
+
+    /**
+     * @brief Constructor from existing Reader.
+     *
+     * @param reader Reader to wrap with a buffer.
+     * @param bufSize Size of read buffer in bytes.
+     * @param readAhead Number of bytes to ask the wrapped Reader for when
+     *                  the buffer needs more data, limited by the free
+     *                  space in the buffer.  Defaults to the buffer size.
+     */
+    FixedBufReader(READER &&reader, size_t bufSize = DEFAULT_ALLOC_SIZE, size_t readAhead = SIZE_MAX)
+        : m_reader(std::move(reader)), m_buffer(::new uint8_t[bufSize]), m_allocSize(bufSize),
+          m_readAhead(Detail::Min(readAhead, bufSize))
+    {
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~FixedBufReader() { ::delete[] m_buffer; }
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    FixedBufReader &operator=(const FixedBufReader &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        FixedBufReader copy{other};
+        std::swap(m_reader, copy.m_reader);
+        std::swap(m_buffer, copy.m_buffer);
+        std::swap(m_allocSize, copy.m_allocSize);
+        std::swap(m_readAhead, copy.m_readAhead);
+        std::swap(m_start, copy.m_start);
+        std::swap(m_end, copy.m_end);
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    FixedBufReader &operator=(FixedBufReader &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        ::delete[] m_buffer;
+        m_reader = std::move(other.m_reader);
+        m_buffer = std::exchange(other.m_buffer, nullptr);
+        m_allocSize = other.m_allocSize;
+        m_readAhead = other.m_readAhead;
+        m_start = other.m_start;
+        m_end = other.m_end;
+        return *this;
+    }
+
+    /**
+     * @brief Return underlying Reader.
+     */
+    const READER &Reader() const & { return m_reader; }
+
+    /**
+     * @brief Obtain the underlying wrapped Reader while moving-from the
+     *        FixedBufReader.
+     */
+    READER Reader() && { return m_reader; }
+
+    /**
+     * @brief Return the capacity of the buffer in bytes.
+     */
+    size_t Capacity() const { return m_allocSize; }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        if (m_start == m_end && count >= m_allocSize)
+        {
+            // Read is too large for buffer, pass through.
+            return RawRead(outDest, m_reader, count);
+        }
+
+        BufferView data = LexFillBuffer(Detail::Min(count, m_allocSize));
+        const size_t actualSize = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), actualSize);
+        LexConsumeBuffer(actualSize);
+        return actualSize;
+    }
+
+    BufferView LexFillBuffer(size_t count)
+    {
+        size_t size = BufferSize();
+        if (count <= size)
         {
             // We already have enough data buffered.
-            return BufferView{m_buffer.get(), m_size};
+            return BufferView{m_buffer + m_start, size};
         }
 
         if (count > m_allocSize)
         {
-            // Reallocate our buffer with any existing data.
-            const size_t newAllocSize = CalcGrowth(count);
-            uint8_t *buffer = ::new uint8_t[newAllocSize];
-            std::memcpy(buffer, m_buffer.get(), m_size);
-            m_buffer.reset(buffer);
-            m_allocSize = newAllocSize;
+            LEXIO_THROW(std::runtime_error("can't fill buffer past its capacity"));
         }
 
-        // Read into the buffer.
-        const size_t wanted = count - m_size;
-        const size_t actual = Read(&m_buffer[m_size], m_reader, wanted);
-        m_size += actual;
-        return BufferView{m_buffer.get(), m_size};
+        if (count > m_allocSize - m_start)
+        {
+            // Compact existing data to the front of the buffer.
+            std::memmove(m_buffer, m_buffer + m_start, size);
+            m_start = 0;
+            m_end = size;
+        }
+
+        while (size < count)
+        {
+            // Read ahead as much as we're allowed to in a single call.
+            const size_t wanted = Detail::Max(count - size, m_readAhead);
+            const size_t actual = RawRead(m_buffer + m_end, m_reader, Detail::Min(wanted, m_allocSize - m_end));
+            if (actual == 0)
+            {
+                break;
+            }
+
+            m_end += actual;
+            size += actual;
+        }
+
+        return BufferView{m_buffer + m_start, size};
     }
 
     void LexConsumeBuffer(size_t count)
     {
-        if (count > m_size)
+        if (count > BufferSize())
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        m_start += count;
+        if (m_start == m_end)
         {
-            throw new std::runtime_error("can't consume more bytes than buffer size");
+            // Buffer is empty, rewind both cursors for free.
+            m_start = 0;
+            m_end = 0;
         }
-        std::memcpy(m_buffer.get(), &m_buffer[count], m_size);
-        m_size -= count;
+    }
+
+    template <typename TRY_READER = READER, typename = std::enable_if_t<IsTryReaderV<TRY_READER>>>
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+    {
+        if (m_start == m_end && count >= m_allocSize)
+        {
+            // Read is too large for buffer, pass through.
+            return m_reader.LexTryRead(outRead, outDest, count);
+        }
+
+        BufferView data;
+        const Error err = LexTryFillBuffer(data, Detail::Min(count, m_allocSize));
+        if (err)
+        {
+            return err;
+        }
+
+        outRead = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), outRead);
+        LexConsumeBuffer(outRead);
+        return Error{};
+    }
+
+    template <typename TRY_READER = READER, typename = std::enable_if_t<IsTryReaderV<TRY_READER>>>
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+    {
+        size_t size = BufferSize();
+        if (count <= size)
+        {
+            // We already have enough data buffered.
+            outBuffer = BufferView{m_buffer + m_start, size};
+            return Error{};
+        }
+
+        if (count > m_allocSize)
+        {
+            return Error{"can't fill buffer past its capacity"};
+        }
+
+        if (count > m_allocSize - m_start)
+        {
+            // Compact existing data to the front of the buffer.
+            std::memmove(m_buffer, m_buffer + m_start, size);
+            m_start = 0;
+            m_end = size;
+        }
+
+        while (size < count)
+        {
+            // Read ahead as much as we're allowed to in a single call.
+            const size_t wanted = Detail::Max(count - size, m_readAhead);
+            size_t actual = 0;
+            const Error err = m_reader.LexTryRead(actual, m_buffer + m_end, Detail::Min(wanted, m_allocSize - m_end));
+            if (err)
+            {
+                return err;
+            }
+            else if (actual == 0)
+            {
+                break;
+            }
+
+            m_end += actual;
+            size += actual;
+        }
+
+        outBuffer = BufferView{m_buffer + m_start, size};
+        return Error{};
+    }
+
+    template <typename FILE_DESCRIPTOR = READER, typename = std::enable_if_t<IsFileDescriptorV<FILE_DESCRIPTOR>>>
+    int LexFileDescriptor()
+    {
+        // The descriptor is positioned past any data we've buffered.
+        return BufferSize() == 0 ? m_reader.LexFileDescriptor() : -1;
+    }
+
+    template <typename SIZE_HINT = READER, typename = std::enable_if_t<IsSizeHintV<SIZE_HINT>>>
+    size_t LexSizeHint()
+    {
+        return BufferSize() + m_reader.LexSizeHint();
     }
 
     template <typename WRITER = READER, typename = std::enable_if_t<IsWriterV<WRITER>>>
     size_t LexWrite(const uint8_t *src, size_t count)
     {
-        m_size = 0; // Invalidate buffer.
+        // Invalidate buffer.
+        m_start = 0;
+        m_end = 0;
         return Write(m_reader, src, count);
     }
 
@@ -208,10 +630,18 @@ class GenericBufReader
         Flush(m_reader);
     }
 
+    template <typename SIZED = READER, typename = std::enable_if_t<IsSizedV<SIZED>>>
+    size_t LexLength()
+    {
+        return m_reader.LexLength();
+    }
+
     template <typename SEEKABLE = READER, typename = std::enable_if_t<IsSeekableV<SEEKABLE>>>
     size_t LexSeek(const SeekPos &pos)
     {
-        m_size = 0; // Invalidate buffer.
+        // Invalidate buffer.
+        m_start = 0;
+        m_end = 0;
         return Seek(m_reader, pos);
     }
 };
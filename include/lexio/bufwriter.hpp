@@ -38,25 +38,115 @@ class FixedBufWriter
 {
     static constexpr size_t DEFAULT_ALLOC_SIZE = 8192;
 
+    // Buffers gathered into a single write to a VectoredWriter, including
+    // the contents of our own buffer.
+    static constexpr size_t MAX_GATHER = 16;
+
     WRITER m_writer;
     uint8_t *m_buffer = nullptr;
     size_t m_allocSize = DEFAULT_ALLOC_SIZE;
     size_t m_size = 0;
 
-  protected:
-    void FlushBuffer()
+    /**
+     * @brief Write the buffer followed by the passed buffers to a
+     *        VectoredWriter using a single gathered write.
+     */
+    size_t WriteThrough(const BufferView *bufs, size_t count, std::true_type)
     {
-        size_t offset = 0;
-        size_t countLeft = m_size;
-        const size_t totalSize = m_size;
-        while (offset < totalSize)
+        BufferView gather[MAX_GATHER];
+        const size_t gatherCount = count < MAX_GATHER - 1 ? count : MAX_GATHER - 1;
+        gather[0] = BufferView{m_buffer, m_size};
+        for (size_t i = 0; i < gatherCount; i++)
+        {
+            gather[i + 1] = bufs[i];
+        }
+
+        // Only one gathered call, so that if anything throws we still know
+        // how much of the buffer is out.
+        const size_t written = m_writer.LexWriteV(&gather[0], gatherCount + 1);
+        if (written < m_size)
         {
-            const size_t written = Write(m_writer, m_buffer + offset, countLeft);
-            offset += written;
-            countLeft -= written;
+            // Short write, keep what's left of the buffer so it's only ever
+            // written once, and drain it before the passed buffers.
+            DiscardWritten(written);
+            FlushBuffer();
+            return WriteV(m_writer, bufs, gatherCount);
         }
 
+        // The buffer is out, finish off the passed buffers.
+        size_t passed = written - m_size;
         m_size = 0;
+        size_t i = 1, skip = passed;
+        while (i <= gatherCount && skip >= gather[i].Size())
+        {
+            skip -= gather[i].Size();
+            i += 1;
+        }
+        if (i <= gatherCount)
+        {
+            gather[i] = BufferView{gather[i].Data() + skip, gather[i].Size() - skip};
+            passed += WriteV(m_writer, &gather[i], gatherCount + 1 - i);
+        }
+        return passed;
+    }
+
+    /**
+     * @brief Write the passed buffers one at a time, buffering the ones that
+     *        fit and draining the buffer before passing through the rest.
+     */
+    size_t WriteThrough(const BufferView *bufs, size_t count, std::false_type)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t written = 0;
+            if (bufs[i].Size() < m_allocSize)
+            {
+                written = LexWrite(bufs[i].Data(), bufs[i].Size());
+            }
+            else
+            {
+                FlushBuffer();
+                written = Write(m_writer, bufs[i].Data(), bufs[i].Size());
+            }
+
+            total += written;
+            if (written != bufs[i].Size())
+            {
+                break;
+            }
+        }
+        return total;
+    }
+
+    /**
+     * @brief Drop bytes that made it to the wrapped Writer from the front of
+     *        the buffer.
+     */
+    void DiscardWritten(size_t written) noexcept
+    {
+        std::memmove(m_buffer, m_buffer + written, m_size - written);
+        m_size -= written;
+    }
+
+    /**
+     * @brief Write the contents of the buffer to the wrapped TryWriter,
+     *        keeping anything that could not be written for a later retry.
+     */
+    Error TryFlushBuffer()
+    {
+        size_t written = 0;
+        const Error err = Detail::TryWriteLoop(written, m_writer, m_buffer, m_size);
+        DiscardWritten(written);
+        if (err)
+        {
+            return err;
+        }
+        else if (m_size != 0)
+        {
+            return Error{"could not write exact number of bytes"};
+        }
+        return Error{};
     }
 
   public:
@@ -93,7 +183,7 @@ class FixedBufWriter
      * @param bufSize Size of write buffer in bytes.
      */
     FixedBufWriter(WRITER &&writer, size_t bufSize = DEFAULT_ALLOC_SIZE)
-        : m_writer(writer), m_buffer(::new uint8_t[bufSize]), m_allocSize(bufSize)
+        : m_writer(std::move(writer)), m_buffer(::new uint8_t[bufSize]), m_allocSize(bufSize)
     {
     }
 
@@ -108,7 +198,7 @@ class FixedBufWriter
             return;
         }
 
-        LexFlush();
+        FlushBuffer();
         ::delete[] m_buffer;
     }
 
@@ -159,10 +249,47 @@ class FixedBufWriter
      */
     WRITER Writer() && { return m_writer; }
 
+    /**
+     * @brief Drain the contents of the buffer into the wrapped Writer without
+     *        flushing the wrapped Writer itself.
+     *
+     * @throws std::runtime_error if the wrapped Writer could not accept the
+     *         entire buffer.  Whatever it did accept is removed from the
+     *         buffer, so the rest can be retried without writing anything
+     *         twice.
+     */
+    void FlushBuffer()
+    {
+        size_t written = 0;
+        LEXIO_TRY
+        {
+            while (written != m_size)
+            {
+                const size_t count = m_writer.LexWrite(m_buffer + written, m_size - written);
+                if (count == 0)
+                {
+                    break;
+                }
+                written += count;
+            }
+        }
+        LEXIO_CATCH_ALL
+        {
+            DiscardWritten(written);
+            std::rethrow_exception(std::current_exception());
+        }
+
+        DiscardWritten(written);
+        if (m_size != 0)
+        {
+            LEXIO_THROW(std::runtime_error("could not write exact number of bytes"));
+        }
+    }
+
     template <typename READER = WRITER, typename = std::enable_if_t<IsReaderV<READER>>>
     size_t LexRead(uint8_t *outDest, size_t count)
     {
-        return Read(m_writer, outDest, count);
+        return Read(outDest, m_writer, count);
     }
 
     template <typename BUFFERED_READER = WRITER, typename = std::enable_if_t<IsBufferedReaderV<BUFFERED_READER>>>
@@ -180,7 +307,7 @@ class FixedBufWriter
     size_t LexWrite(const uint8_t *src, size_t count)
     {
         const size_t wantSize = m_size + count;
-        if (wantSize < m_allocSize)
+        if (wantSize <= m_allocSize)
         {
             // Fast path, just append to the buffer.
             std::memcpy(&m_buffer[m_size], src, count);
@@ -188,19 +315,95 @@ class FixedBufWriter
             return count;
         }
 
-        // Flush the current contents of the buffer.
-        LexFlush();
-
         if (count < m_allocSize)
         {
-            // Room in the buffer, write to it.
+            // Drain the current contents of the buffer, then write to it.
+            FlushBuffer();
             std::memcpy(&m_buffer[0], src, count);
             m_size = count;
             return count;
         }
 
-        // Write is too large for buffer, pass through.
-        return Write(m_writer, src, count);
+        // Write is too large for buffer, pass it through along with the
+        // current contents of the buffer.
+        const BufferView buf{src, count};
+        return WriteThrough(&buf, 1, IsVectoredWriter<WRITER>{});
+    }
+
+    template <typename TRY_WRITER = WRITER, typename = std::enable_if_t<IsTryWriterV<TRY_WRITER>>>
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count)
+    {
+        outWritten = 0;
+        if (m_size + count > m_allocSize)
+        {
+            const Error err = TryFlushBuffer();
+            if (err)
+            {
+                return err;
+            }
+
+            if (count >= m_allocSize)
+            {
+                // Write is too large for buffer, pass it through.
+                return Detail::TryWriteLoop(outWritten, m_writer, src, count);
+            }
+        }
+
+        std::memcpy(&m_buffer[m_size], src, count);
+        m_size += count;
+        outWritten = count;
+        return Error{};
+    }
+
+    size_t LexWriteV(const BufferView *bufs, size_t count)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            total += bufs[i].Size();
+        }
+
+        if (m_size + total <= m_allocSize)
+        {
+            // Fast path, just append to the buffer.
+            for (size_t i = 0; i < count; i++)
+            {
+                if (bufs[i].Size() != 0)
+                {
+                    std::memcpy(&m_buffer[m_size], bufs[i].Data(), bufs[i].Size());
+                    m_size += bufs[i].Size();
+                }
+            }
+            return total;
+        }
+
+        return WriteThrough(bufs, count, IsVectoredWriter<WRITER>{});
+    }
+
+    MutableBufferView LexReserve(size_t count)
+    {
+        if (count > m_allocSize)
+        {
+            LEXIO_THROW(std::runtime_error("can't reserve more bytes than buffer size"));
+        }
+
+        if (m_size + count > m_allocSize)
+        {
+            // Not enough room left, drain the buffer to make some.
+            FlushBuffer();
+        }
+
+        return MutableBufferView{&m_buffer[m_size], m_allocSize - m_size};
+    }
+
+    void LexCommit(size_t count)
+    {
+        if (count > m_allocSize - m_size)
+        {
+            LEXIO_THROW(std::runtime_error("can't commit more bytes than were reserved"));
+        }
+
+        m_size += count;
     }
 
     void LexFlush()
@@ -209,10 +412,26 @@ class FixedBufWriter
         Flush(m_writer);
     }
 
+    template <typename FILE_DESCRIPTOR = WRITER, typename = std::enable_if_t<IsFileDescriptorV<FILE_DESCRIPTOR>>>
+    int LexFileDescriptor()
+    {
+        // Writes made directly to the descriptor must land after ours.
+        FlushBuffer();
+        return m_writer.LexFileDescriptor();
+    }
+
+    template <typename SIZED = WRITER, typename = std::enable_if_t<IsSizedV<SIZED>>>
+    size_t LexLength()
+    {
+        // Buffered data might extend the stream, so it has to land first.
+        FlushBuffer();
+        return m_writer.LexLength();
+    }
+
     template <typename SEEKABLE = WRITER, typename = std::enable_if_t<IsSeekableV<SEEKABLE>>>
     size_t LexSeek(const SeekPos &pos)
     {
-        LexFlush();
+        FlushBuffer();
         return Seek(m_writer, pos);
     }
 };
@@ -20,7 +20,7 @@
  *
  * LexIO streams are not derived from abstract classes - any class that defines
  * specific methods can act as a LexIO stream.  There are four basic types of
- * stream.
+ * stream, plus optional traits that streams can implement in addition to them.
  *
  * ### Reader
  *
@@ -126,12 +126,119 @@
  * operation.  Otherwise, throw `std::runtime_error` or a subclass of it.
  *
  * If the class is also a BufferedReader, `LexSeek` should empty the buffer.
+ *
+ * ### Sized
+ *
+ * Sized classes are Seekables that know their total length without moving
+ * the cursor, which saves `Length` from having to seek to the end and back.
+ * Define this method in addition to the Seekable methods:
+ *
+ *     size_t LexLength()
+ *
+ * The return value is the current length of the stream in bytes, including
+ * anything written so far.  On failure, throw `std::runtime_error` or a
+ * subclass of it.
+ *
+ * ### PositionalReader and PositionalWriter
+ *
+ * Positional classes can read from or write to an absolute offset without
+ * using or modifying the cursor.  Define one or both of the following methods:
+ *
+ *     size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset)
+ *     size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset)
+ *
+ * These methods have the same return value and error constraints as `LexRead`
+ * and `LexWrite`, except the operation takes place at `offset` bytes from the
+ * start of the stream.  Reading at or past the end of the stream returns 0.
+ *
+ * Positional operations must be safe to call concurrently from multiple
+ * threads, as long as no other non-positional operation is happening at the
+ * same time.  As a result, they must not touch any buffer or cursor state.
+ *
+ * ### VectoredReader and VectoredWriter
+ *
+ * Vectored classes can scatter a single read into, or gather a single write
+ * from, multiple buffers.  Define one or both of the following methods:
+ *
+ *     size_t LexReadV(const MutableBufferView *bufs, size_t count)
+ *     size_t LexWriteV(const BufferView *bufs, size_t count)
+ *
+ * `count` is the number of buffers in the array pointed to by `bufs`.  The
+ * buffers are filled or drained in order, as if they were one contiguous
+ * buffer.  The return value is the total number of bytes read or written,
+ * which can be less than the combined size of the buffers, and otherwise has
+ * the same constraints as `LexRead` and `LexWrite`.
+ *
+ * ### BufferedWriter
+ *
+ * BufferedWriter classes are Writers that can hand out space in their internal
+ * buffer, so data can be encoded in place instead of being copied in through
+ * `LexWrite`.  Define these methods in addition to the Writer methods:
+ *
+ *     MutableBufferView LexReserve(size_t count)
+ *     void LexCommit(size_t count)
+ *
+ * `LexReserve` returns a view of writable space at the current position that
+ * is at least `count` bytes long, draining or growing the internal buffer if
+ * necessary.  If that much space can't be provided, throw `std::runtime_error`
+ * or a subclass of it.  The contents of the reserved space are unspecified.
+ *
+ * `LexCommit` appends the first `count` bytes of the most recent reservation
+ * to the stream.  Committing more bytes than were reserved is expected to
+ * throw a `std::runtime_error` or a subclass of it.  Any other operation on
+ * the stream invalidates the reservation.
+ *
+ * ### TryReader, TryBufferedReader and TryWriter
+ *
+ * Streams can additionally report ordinary errors without throwing, which
+ * lets the `Try*` functions fail without unwinding.  Define any of these
+ * methods alongside their throwing counterparts:
+ *
+ *     Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+ *     Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+ *     Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count)
+ *
+ * These behave exactly like `LexRead`, `LexFillBuffer` and `LexWrite`, except
+ * the result is stored in the first parameter and errors are returned as a
+ * `LexIO::Error` instead of being thrown.  A default-constructed `Error`
+ * means success.  Out-of-memory conditions may still throw.
+ *
+ * If LexIO is built without exceptions, errors that can't be reported through
+ * these methods call `std::abort`.
+ *
+ * ### FileDescriptor
+ *
+ * FileDescriptor classes are streams backed by a POSIX file descriptor, which
+ * lets functions like `Copy` move data between them inside the kernel.
+ * Define this method alongside the Reader or Writer methods:
+ *
+ *     int LexFileDescriptor()
+ *
+ * Return the descriptor with its offset at the logical position of the
+ * stream, or -1 if that isn't possible right now.  Wrappers that buffer
+ * writes should flush before returning a descriptor, and wrappers that buffer
+ * reads should return -1 while they hold unconsumed data.
+ *
+ * ### SizeHint
+ *
+ * SizeHint classes are Readers that can estimate how much data is left, so
+ * callers like `ReadToEOF` can allocate space up front.  Define this method
+ * alongside the Reader methods:
+ *
+ *     size_t LexSizeHint()
+ *
+ * Return the number of bytes expected to be read before hitting EOF, or 0 if
+ * that isn't known.  The value is only a hint and callers must cope with the
+ * stream ending earlier or later, so estimating is fine, but this should be
+ * cheap and must not change the position of the stream.
  */
 
 #pragma once
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <iterator>
 #include <stdexcept>
 #include <type_traits>
@@ -187,6 +294,27 @@
 #define LEXIO_INLINE_VAR
 #endif
 
+// Exceptions can be turned off with -fno-exceptions, in which case errors can
+// only be reported through the exception-free stream protocol.
+
+#if !defined(LEXIO_HAS_EXCEPTIONS)
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define LEXIO_HAS_EXCEPTIONS 1
+#else
+#define LEXIO_HAS_EXCEPTIONS 0
+#endif
+#endif
+
+#if (LEXIO_HAS_EXCEPTIONS == 1)
+#define LEXIO_TRY try
+#define LEXIO_CATCH_ALL catch (...)
+#define LEXIO_THROW(...) throw __VA_ARGS__
+#else
+#define LEXIO_TRY if (true)
+#define LEXIO_CATCH_ALL if (false)
+#define LEXIO_THROW(...) std::abort()
+#endif
+
 // C++14 does not have if constexpr
 
 #if defined(_MSC_VER) && !defined(__clang__) // MSVC only supports LE.
@@ -234,6 +362,27 @@ class BufferView
     size_t m_size = 0;
 };
 
+/**
+ * @brief View of a contiguous buffer of mutable bytes.
+ */
+class MutableBufferView
+{
+  public:
+    constexpr MutableBufferView() = default;
+    constexpr MutableBufferView(uint8_t *data, size_t size) : m_data(data), m_size(size) {}
+    constexpr uint8_t *Data() const noexcept { return m_data; }
+    constexpr size_t Size() const noexcept { return m_size; }
+
+    /**
+     * @brief Convert to an immutable view of the same buffer.
+     */
+    constexpr operator BufferView() const noexcept { return BufferView{m_data, m_size}; }
+
+  protected:
+    uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+};
+
 /**
  * @brief Possible seek directions.
  */
@@ -257,6 +406,53 @@ struct SeekPos
     SeekPos(ptrdiff_t offset_, Whence whence_) : offset(offset_), whence(whence_) {}
 };
 
+/**
+ * @brief Error returned by the exception-free stream protocol.  Holds a
+ *        pointer to a static message and an optional errno-style code, so it
+ *        can be created and copied without allocating.
+ */
+class Error
+{
+  public:
+    /**
+     * @brief Construct an Error that represents success.
+     */
+    constexpr Error() = default;
+
+    /**
+     * @brief Construct an Error.
+     *
+     * @param message Static string describing the error.
+     * @param sysError System error code, such as errno, or 0 if none.
+     */
+    constexpr Error(const char *message, int sysError = 0) : m_message(message), m_sysError(sysError) {}
+
+    /**
+     * @brief Construct an Error that signals an exception was caught and
+     *        stored as the most recent error for this thread.
+     */
+    static constexpr Error Exception() { return Error{"exception thrown by stream", 0, true}; }
+
+    /**
+     * @brief True if this is an error, false if it represents success.
+     */
+    constexpr explicit operator bool() const noexcept { return m_message != nullptr; }
+
+    constexpr const char *Message() const noexcept { return m_message; }
+    constexpr int SysError() const noexcept { return m_sysError; }
+    constexpr bool IsException() const noexcept { return m_exception; }
+
+  protected:
+    const char *m_message = nullptr;
+    int m_sysError = 0;
+    bool m_exception = false;
+
+    constexpr Error(const char *message, int sysError, bool exception)
+        : m_message(message), m_sysError(sysError), m_exception(exception)
+    {
+    }
+};
+
 namespace Detail
 {
 
@@ -357,6 +553,82 @@ using WriterType = decltype(std::declval<size_t &>() =
 template <typename T>
 using SeekableType = decltype(std::declval<size_t &>() = std::declval<T>().LexSeek(std::declval<const SeekPos &>()));
 
+/**
+ * @brief This type exists if the passed T conforms to PositionalReader.
+ */
+template <typename T>
+using PositionalReaderType = decltype(std::declval<size_t &>() = std::declval<T>().LexReadAt(
+                                          std::declval<uint8_t *>(), std::declval<size_t>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to PositionalWriter.
+ */
+template <typename T>
+using PositionalWriterType =
+    decltype(std::declval<size_t &>() = std::declval<T>().LexWriteAt(std::declval<const uint8_t *>(),
+                                                                      std::declval<size_t>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to TryReader.
+ */
+template <typename T>
+using TryReaderType = decltype(std::declval<Error &>() = std::declval<T>().LexTryRead(
+                                   std::declval<size_t &>(), std::declval<uint8_t *>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to TryBufferedReader.
+ */
+template <typename T>
+using TryBufferedReaderType = decltype(std::declval<Error &>() = std::declval<T>().LexTryFillBuffer(
+                                           std::declval<BufferView &>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to TryWriter.
+ */
+template <typename T>
+using TryWriterType = decltype(std::declval<Error &>() = std::declval<T>().LexTryWrite(
+                                   std::declval<size_t &>(), std::declval<const uint8_t *>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to FileDescriptor.
+ */
+template <typename T>
+using FileDescriptorType = decltype(std::declval<int &>() = std::declval<T>().LexFileDescriptor());
+
+/**
+ * @brief This type exists if the passed T conforms to SizeHint.
+ */
+template <typename T>
+using SizeHintType = decltype(std::declval<size_t &>() = std::declval<T>().LexSizeHint());
+
+/**
+ * @brief This type exists if the passed T conforms to Sized.
+ */
+template <typename T>
+using SizedType = decltype(std::declval<size_t &>() = std::declval<T>().LexLength());
+
+/**
+ * @brief This type exists if the passed T conforms to BufferedWriter.
+ */
+template <typename T>
+using BufferedWriterType =
+    decltype(std::declval<MutableBufferView &>() = std::declval<T>().LexReserve(std::declval<size_t>()),
+             std::declval<T>().LexCommit(std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to VectoredReader.
+ */
+template <typename T>
+using VectoredReaderType = decltype(std::declval<size_t &>() = std::declval<T>().LexReadV(
+                                        std::declval<const MutableBufferView *>(), std::declval<size_t>()));
+
+/**
+ * @brief This type exists if the passed T conforms to VectoredWriter.
+ */
+template <typename T>
+using VectoredWriterType = decltype(std::declval<size_t &>() = std::declval<T>().LexWriteV(
+                                        std::declval<const BufferView *>(), std::declval<size_t>()));
+
 /**
  * @brief Function that calls a wrapped LexRead.
  */
@@ -390,12 +662,100 @@ inline void WrapFlush(void *ptr)
     static_cast<WRITER *>(ptr)->LexFlush();
 }
 
+template <typename BUFFERED_WRITER>
+inline MutableBufferView WrapReserve(void *ptr, size_t count)
+{
+    return static_cast<BUFFERED_WRITER *>(ptr)->LexReserve(count);
+}
+
+template <typename BUFFERED_WRITER>
+inline void WrapCommit(void *ptr, size_t count)
+{
+    static_cast<BUFFERED_WRITER *>(ptr)->LexCommit(count);
+}
+
+template <typename TRY_READER>
+inline Error WrapTryRead(void *ptr, size_t &outRead, uint8_t *outDest, size_t count)
+{
+    return static_cast<TRY_READER *>(ptr)->LexTryRead(outRead, outDest, count);
+}
+
+template <typename TRY_BUFFERED_READER>
+inline Error WrapTryFillBuffer(void *ptr, BufferView &outBuffer, size_t count)
+{
+    return static_cast<TRY_BUFFERED_READER *>(ptr)->LexTryFillBuffer(outBuffer, count);
+}
+
+template <typename TRY_WRITER>
+inline Error WrapTryWrite(void *ptr, size_t &outWritten, const uint8_t *src, size_t count)
+{
+    return static_cast<TRY_WRITER *>(ptr)->LexTryWrite(outWritten, src, count);
+}
+
+template <typename FILE_DESCRIPTOR>
+inline int WrapFileDescriptor(void *ptr)
+{
+    return static_cast<FILE_DESCRIPTOR *>(ptr)->LexFileDescriptor();
+}
+
+template <typename SIZE_HINT>
+inline size_t WrapSizeHint(void *ptr)
+{
+    return static_cast<SIZE_HINT *>(ptr)->LexSizeHint();
+}
+
+template <typename SIZED>
+inline size_t WrapLength(void *ptr)
+{
+    return static_cast<SIZED *>(ptr)->LexLength();
+}
+
+/**
+ * @brief Most recent error for this thread, used by the Try* family of
+ *        functions.  Setting an Error never allocates.
+ */
+struct LastErrorState
+{
+    Error error;
+    std::exception_ptr exception;
+};
+
+inline LastErrorState &LastError() noexcept
+{
+    static thread_local LastErrorState state;
+    return state;
+}
+
 template <typename SEEKABLE>
 inline size_t WrapSeek(void *ptr, const SeekPos &pos)
 {
     return static_cast<SEEKABLE *>(ptr)->LexSeek(pos);
 }
 
+template <typename POSITIONAL_READER>
+inline size_t WrapReadAt(void *ptr, uint8_t *outDest, size_t count, size_t offset)
+{
+    return static_cast<POSITIONAL_READER *>(ptr)->LexReadAt(outDest, count, offset);
+}
+
+template <typename POSITIONAL_WRITER>
+inline size_t WrapWriteAt(void *ptr, const uint8_t *src, size_t count, size_t offset)
+{
+    return static_cast<POSITIONAL_WRITER *>(ptr)->LexWriteAt(src, count, offset);
+}
+
+template <typename VECTORED_READER>
+inline size_t WrapReadV(void *ptr, const MutableBufferView *bufs, size_t count)
+{
+    return static_cast<VECTORED_READER *>(ptr)->LexReadV(bufs, count);
+}
+
+template <typename VECTORED_WRITER>
+inline size_t WrapWriteV(void *ptr, const BufferView *bufs, size_t count)
+{
+    return static_cast<VECTORED_WRITER *>(ptr)->LexWriteV(bufs, count);
+}
+
 } // namespace Detail
 
 /**
@@ -444,148 +804,1236 @@ template <typename T>
 LEXIO_INLINE_VAR constexpr bool IsWriterV = IsWriter<T>::value;
 
 /**
- * @brief If the template parameter is a valid SeekableReader, provides a
+ * @brief If the template parameter is a valid BufferedWriter, provides a
  *        member constant "value" of true.  Otherwise, "value" is false.
  *
  * @tparam T Type to check.
  */
 template <typename T>
-using IsSeekable = Detail::IsDetected<Detail::SeekableType, T>;
+using IsBufferedWriter = Detail::IsDetected<Detail::BufferedWriterType, T>;
 
 /**
- * @brief Helper variable for IsSeekable trait.
+ * @brief Helper variable for IsBufferedWriter trait.
  */
 template <typename T>
-LEXIO_INLINE_VAR constexpr bool IsSeekableV = IsSeekable<T>::value;
+LEXIO_INLINE_VAR constexpr bool IsBufferedWriterV = IsBufferedWriter<T>::value;
 
+/**
+ * @brief If the template parameter is a valid TryReader, provides a member
+ *        constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail True for every Ref that can read.  If the wrapped stream isn't a
+ *         TryReader, the Ref catches exceptions from LexRead instead, so
+ *         the Ref is no cheaper to call than the stream itself.
+ *
+ * @tparam T Type to check.
+ */
 template <typename T>
-struct IsRef : std::false_type
-{
-};
+using IsTryReader = Detail::IsDetected<Detail::TryReaderType, T>;
 
+/**
+ * @brief Helper variable for IsTryReader trait.
+ */
 template <typename T>
-LEXIO_INLINE_VAR constexpr bool IsRefV = IsRef<T>::value;
+LEXIO_INLINE_VAR constexpr bool IsTryReaderV = IsTryReader<T>::value;
 
 /**
- * @brief A type-erased reference to a stream that implements Reader.
+ * @brief If the template parameter is a valid TryBufferedReader, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail True for BufferedReaderRef no matter what it wraps, exceptions
+ *         from LexFillBuffer are caught if the stream has no
+ *         LexTryFillBuffer.
+ *
+ * @tparam T Type to check.
  */
-class ReaderRef
-{
-    friend class UnbufferedReaderRef;
-
-  public:
-    using WrapReadFunc = size_t (*)(void *, uint8_t *, size_t);
+template <typename T>
+using IsTryBufferedReader = Detail::IsDetected<Detail::TryBufferedReaderType, T>;
 
-    template <typename READER>
-    using EnableIfWrappable = std::enable_if_t<!IsRefV<READER> && IsReaderV<READER>>;
+/**
+ * @brief Helper variable for IsTryBufferedReader trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsTryBufferedReaderV = IsTryBufferedReader<T>::value;
 
-    ReaderRef() = delete;
+/**
+ * @brief If the template parameter is a valid TryWriter, provides a member
+ *        constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail True for every Ref that can write.  Without a LexTryWrite on the
+ *         wrapped stream, the Ref catches exceptions from LexWrite.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsTryWriter = Detail::IsDetected<Detail::TryWriterType, T>;
 
-    /**
-     * @brief Copy constructor.
-     */
-    ReaderRef(const ReaderRef &other) : m_ptr(other.m_ptr), m_lexRead(other.m_lexRead) {}
+/**
+ * @brief Helper variable for IsTryWriter trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsTryWriterV = IsTryWriter<T>::value;
 
-    /**
-     * @brief Construct and wrap any Reader that isn't a Ref.
-     */
-    template <typename READER, typename = EnableIfWrappable<READER>>
-    ReaderRef(READER &reader) : m_ptr(&reader), m_lexRead(Detail::WrapRead<READER>)
-    {
-    }
+/**
+ * @brief If the template parameter is a valid FileDescriptor, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail Refs, and wrappers around them, are always FileDescriptors since
+ *         what they wrap is only known at runtime.  Their LexFileDescriptor
+ *         returns -1 if the wrapped stream has no descriptor, so check
+ *         the result as well as the trait.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsFileDescriptor = Detail::IsDetected<Detail::FileDescriptorType, T>;
 
-    /**
-     * @brief Member-wise constructor.  Useful if you want to construct a
-     *        ReaderRef from some other type of Ref.
-     */
-    ReaderRef(void *ptr, WrapReadFunc lexRead) : m_ptr(ptr), m_lexRead(lexRead) {}
+/**
+ * @brief Helper variable for IsFileDescriptor trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsFileDescriptorV = IsFileDescriptor<T>::value;
 
-    /**
-     * @brief Copy assignment operator.
-     */
-    ReaderRef &operator=(const ReaderRef &other)
-    {
-        if (this == &other)
-        {
-            return *this;
-        }
+/**
+ * @brief If the template parameter is a valid SizeHint, provides a member
+ *        constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail Refs are always SizeHints, and hint 0 for a stream that isn't
+ *         one, which is the same as having no hint.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsSizeHint = Detail::IsDetected<Detail::SizeHintType, T>;
 
-        m_ptr = other.m_ptr;
-        m_lexRead = other.m_lexRead;
-        return *this;
-    }
+/**
+ * @brief Helper variable for IsSizeHint trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsSizeHintV = IsSizeHint<T>::value;
 
-    /**
-     * @brief Copy-assign and wrap any Reader that isn't a Ref.
-     */
-    template <typename READER, typename = EnableIfWrappable<READER>>
-    ReaderRef &operator=(READER &reader)
+/**
+ * @brief If the template parameter is a valid SeekableReader, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsSeekable = Detail::IsDetected<Detail::SeekableType, T>;
+
+/**
+ * @brief Helper variable for IsSeekable trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsSeekableV = IsSeekable<T>::value;
+
+/**
+ * @brief If the template parameter is a valid Sized, provides a member
+ *        constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @detail Every Ref that can seek is Sized.  If the wrapped stream isn't,
+ *         LexLength finds the length by seeking to the end and back.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsSized = Detail::IsDetected<Detail::SizedType, T>;
+
+/**
+ * @brief Helper variable for IsSized trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsSizedV = IsSized<T>::value;
+
+/**
+ * @brief If the template parameter is a valid PositionalReader, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsPositionalReader = Detail::IsDetected<Detail::PositionalReaderType, T>;
+
+/**
+ * @brief Helper variable for IsPositionalReader trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsPositionalReaderV = IsPositionalReader<T>::value;
+
+/**
+ * @brief If the template parameter is a valid PositionalWriter, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsPositionalWriter = Detail::IsDetected<Detail::PositionalWriterType, T>;
+
+/**
+ * @brief Helper variable for IsPositionalWriter trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsPositionalWriterV = IsPositionalWriter<T>::value;
+
+/**
+ * @brief If the template parameter is a valid VectoredReader, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsVectoredReader = Detail::IsDetected<Detail::VectoredReaderType, T>;
+
+/**
+ * @brief Helper variable for IsVectoredReader trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsVectoredReaderV = IsVectoredReader<T>::value;
+
+/**
+ * @brief If the template parameter is a valid VectoredWriter, provides a
+ *        member constant "value" of true.  Otherwise, "value" is false.
+ *
+ * @tparam T Type to check.
+ */
+template <typename T>
+using IsVectoredWriter = Detail::IsDetected<Detail::VectoredWriterType, T>;
+
+/**
+ * @brief Helper variable for IsVectoredWriter trait.
+ */
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsVectoredWriterV = IsVectoredWriter<T>::value;
+
+namespace Detail
+{
+
+/**
+ * @brief Table of functions that call into a wrapped stream.  Every Ref holds
+ *        a pointer to one of these alongside a pointer to the stream, so
+ *        converting between Refs never copies more than two pointers.
+ *
+ * @detail Entries for traits that the stream doesn't implement are nullptr.
+ */
+struct VTable
+{
+    using ReadFunc = size_t (*)(void *, uint8_t *, size_t);
+    using FillBufferFunc = BufferView (*)(void *, size_t);
+    using ConsumeBufferFunc = void (*)(void *, size_t);
+    using WriteFunc = size_t (*)(void *, const uint8_t *, size_t);
+    using FlushFunc = void (*)(void *);
+    using SeekFunc = size_t (*)(void *, const SeekPos &);
+    using ReadAtFunc = size_t (*)(void *, uint8_t *, size_t, size_t);
+    using WriteAtFunc = size_t (*)(void *, const uint8_t *, size_t, size_t);
+    using ReadVFunc = size_t (*)(void *, const MutableBufferView *, size_t);
+    using WriteVFunc = size_t (*)(void *, const BufferView *, size_t);
+    using ReserveFunc = MutableBufferView (*)(void *, size_t);
+    using CommitFunc = void (*)(void *, size_t);
+    using TryReadFunc = Error (*)(void *, size_t &, uint8_t *, size_t);
+    using TryFillBufferFunc = Error (*)(void *, BufferView &, size_t);
+    using TryWriteFunc = Error (*)(void *, size_t &, const uint8_t *, size_t);
+    using FileDescriptorFunc = int (*)(void *);
+    using SizeHintFunc = size_t (*)(void *);
+    using LengthFunc = size_t (*)(void *);
+
+    ReadFunc lexRead;
+    FillBufferFunc lexFillBuffer;
+    ConsumeBufferFunc lexConsumeBuffer;
+    WriteFunc lexWrite;
+    FlushFunc lexFlush;
+    SeekFunc lexSeek;
+    ReadAtFunc lexReadAt;
+    WriteAtFunc lexWriteAt;
+    ReadVFunc lexReadV;
+    WriteVFunc lexWriteV;
+    ReserveFunc lexReserve;
+    CommitFunc lexCommit;
+    TryReadFunc lexTryRead;
+    TryFillBufferFunc lexTryFillBuffer;
+    TryWriteFunc lexTryWrite;
+    FileDescriptorFunc lexFileDescriptor;
+    SizeHintFunc lexSizeHint;
+    LengthFunc lexLength;
+};
+
+template <typename READER>
+constexpr VTable::ReadFunc VTableEntryRead(std::true_type)
+{
+    return WrapRead<READER>;
+}
+
+template <typename T>
+constexpr VTable::ReadFunc VTableEntryRead(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename BUFFERED_READER>
+constexpr VTable::FillBufferFunc VTableEntryFillBuffer(std::true_type)
+{
+    return WrapFillBuffer<BUFFERED_READER>;
+}
+
+template <typename T>
+constexpr VTable::FillBufferFunc VTableEntryFillBuffer(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename BUFFERED_READER>
+constexpr VTable::ConsumeBufferFunc VTableEntryConsumeBuffer(std::true_type)
+{
+    return WrapConsumeBuffer<BUFFERED_READER>;
+}
+
+template <typename T>
+constexpr VTable::ConsumeBufferFunc VTableEntryConsumeBuffer(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename WRITER>
+constexpr VTable::WriteFunc VTableEntryWrite(std::true_type)
+{
+    return WrapWrite<WRITER>;
+}
+
+template <typename T>
+constexpr VTable::WriteFunc VTableEntryWrite(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename WRITER>
+constexpr VTable::FlushFunc VTableEntryFlush(std::true_type)
+{
+    return WrapFlush<WRITER>;
+}
+
+template <typename T>
+constexpr VTable::FlushFunc VTableEntryFlush(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename SEEKABLE>
+constexpr VTable::SeekFunc VTableEntrySeek(std::true_type)
+{
+    return WrapSeek<SEEKABLE>;
+}
+
+template <typename T>
+constexpr VTable::SeekFunc VTableEntrySeek(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename POSITIONAL_READER>
+constexpr VTable::ReadAtFunc VTableEntryReadAt(std::true_type)
+{
+    return WrapReadAt<POSITIONAL_READER>;
+}
+
+template <typename T>
+constexpr VTable::ReadAtFunc VTableEntryReadAt(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename POSITIONAL_WRITER>
+constexpr VTable::WriteAtFunc VTableEntryWriteAt(std::true_type)
+{
+    return WrapWriteAt<POSITIONAL_WRITER>;
+}
+
+template <typename T>
+constexpr VTable::WriteAtFunc VTableEntryWriteAt(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename VECTORED_READER>
+constexpr VTable::ReadVFunc VTableEntryReadV(std::true_type)
+{
+    return WrapReadV<VECTORED_READER>;
+}
+
+template <typename T>
+constexpr VTable::ReadVFunc VTableEntryReadV(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename VECTORED_WRITER>
+constexpr VTable::WriteVFunc VTableEntryWriteV(std::true_type)
+{
+    return WrapWriteV<VECTORED_WRITER>;
+}
+
+template <typename T>
+constexpr VTable::WriteVFunc VTableEntryWriteV(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename BUFFERED_WRITER>
+constexpr VTable::ReserveFunc VTableEntryReserve(std::true_type)
+{
+    return WrapReserve<BUFFERED_WRITER>;
+}
+
+template <typename T>
+constexpr VTable::ReserveFunc VTableEntryReserve(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename BUFFERED_WRITER>
+constexpr VTable::CommitFunc VTableEntryCommit(std::true_type)
+{
+    return WrapCommit<BUFFERED_WRITER>;
+}
+
+template <typename T>
+constexpr VTable::CommitFunc VTableEntryCommit(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename TRY_READER>
+constexpr VTable::TryReadFunc VTableEntryTryRead(std::true_type)
+{
+    return WrapTryRead<TRY_READER>;
+}
+
+template <typename T>
+constexpr VTable::TryReadFunc VTableEntryTryRead(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename TRY_BUFFERED_READER>
+constexpr VTable::TryFillBufferFunc VTableEntryTryFillBuffer(std::true_type)
+{
+    return WrapTryFillBuffer<TRY_BUFFERED_READER>;
+}
+
+template <typename T>
+constexpr VTable::TryFillBufferFunc VTableEntryTryFillBuffer(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename TRY_WRITER>
+constexpr VTable::TryWriteFunc VTableEntryTryWrite(std::true_type)
+{
+    return WrapTryWrite<TRY_WRITER>;
+}
+
+template <typename T>
+constexpr VTable::TryWriteFunc VTableEntryTryWrite(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename FILE_DESCRIPTOR>
+constexpr VTable::FileDescriptorFunc VTableEntryFileDescriptor(std::true_type)
+{
+    return WrapFileDescriptor<FILE_DESCRIPTOR>;
+}
+
+template <typename T>
+constexpr VTable::FileDescriptorFunc VTableEntryFileDescriptor(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename SIZE_HINT>
+constexpr VTable::SizeHintFunc VTableEntrySizeHint(std::true_type)
+{
+    return WrapSizeHint<SIZE_HINT>;
+}
+
+template <typename T>
+constexpr VTable::SizeHintFunc VTableEntrySizeHint(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename SIZED>
+constexpr VTable::LengthFunc VTableEntryLength(std::true_type)
+{
+    return WrapLength<SIZED>;
+}
+
+template <typename T>
+constexpr VTable::LengthFunc VTableEntryLength(std::false_type)
+{
+    return nullptr;
+}
+
+/**
+ * @brief Holds the VTable for a specific stream type.
+ */
+template <typename T>
+struct VTableFor
+{
+    static constexpr VTable value = {
+        VTableEntryRead<T>(IsReader<T>{}),
+        VTableEntryFillBuffer<T>(IsBufferedReader<T>{}),
+        VTableEntryConsumeBuffer<T>(IsBufferedReader<T>{}),
+        VTableEntryWrite<T>(IsWriter<T>{}),
+        VTableEntryFlush<T>(IsWriter<T>{}),
+        VTableEntrySeek<T>(IsSeekable<T>{}),
+        VTableEntryReadAt<T>(IsPositionalReader<T>{}),
+        VTableEntryWriteAt<T>(IsPositionalWriter<T>{}),
+        VTableEntryReadV<T>(IsVectoredReader<T>{}),
+        VTableEntryWriteV<T>(IsVectoredWriter<T>{}),
+        VTableEntryReserve<T>(IsBufferedWriter<T>{}),
+        VTableEntryCommit<T>(IsBufferedWriter<T>{}),
+        VTableEntryTryRead<T>(IsTryReader<T>{}),
+        VTableEntryTryFillBuffer<T>(IsTryBufferedReader<T>{}),
+        VTableEntryTryWrite<T>(IsTryWriter<T>{}),
+        VTableEntryFileDescriptor<T>(IsFileDescriptor<T>{}),
+        VTableEntrySizeHint<T>(IsSizeHint<T>{}),
+        VTableEntryLength<T>(IsSized<T>{})
+    };
+};
+
+#if (LEXIO_CPLUSPLUS < 201703L)
+template <typename T>
+constexpr VTable VTableFor<T>::value;
+#endif
+
+/**
+ * @brief Call LexTryRead through a VTable, falling back to catching
+ *        exceptions from LexRead if the stream isn't a TryReader.
+ */
+inline Error VTableTryRead(const VTable &vtable, void *ptr, size_t &outRead, uint8_t *outDest, size_t count)
+{
+    if (vtable.lexTryRead != nullptr)
+    {
+        return vtable.lexTryRead(ptr, outRead, outDest, count);
+    }
+
+    LEXIO_TRY
+    {
+        outRead = vtable.lexRead(ptr, outDest, count);
+        return Error{};
+    }
+    LEXIO_CATCH_ALL
+    {
+        LastError().exception = std::current_exception();
+        return Error::Exception();
+    }
+}
+
+/**
+ * @brief Call LexTryFillBuffer through a VTable, falling back to catching
+ *        exceptions from LexFillBuffer if the stream isn't a
+ *        TryBufferedReader.
+ */
+inline Error VTableTryFillBuffer(const VTable &vtable, void *ptr, BufferView &outBuffer, size_t count)
+{
+    if (vtable.lexTryFillBuffer != nullptr)
+    {
+        return vtable.lexTryFillBuffer(ptr, outBuffer, count);
+    }
+
+    LEXIO_TRY
+    {
+        outBuffer = vtable.lexFillBuffer(ptr, count);
+        return Error{};
+    }
+    LEXIO_CATCH_ALL
+    {
+        LastError().exception = std::current_exception();
+        return Error::Exception();
+    }
+}
+
+/**
+ * @brief Call LexTryWrite through a VTable, falling back to catching
+ *        exceptions from LexWrite if the stream isn't a TryWriter.
+ */
+inline Error VTableTryWrite(const VTable &vtable, void *ptr, size_t &outWritten, const uint8_t *src, size_t count)
+{
+    if (vtable.lexTryWrite != nullptr)
+    {
+        return vtable.lexTryWrite(ptr, outWritten, src, count);
+    }
+
+    LEXIO_TRY
+    {
+        outWritten = vtable.lexWrite(ptr, src, count);
+        return Error{};
+    }
+    LEXIO_CATCH_ALL
+    {
+        LastError().exception = std::current_exception();
+        return Error::Exception();
+    }
+}
+
+/**
+ * @brief Call LexFileDescriptor through a VTable, returning -1 if the stream
+ *        isn't a FileDescriptor.
+ */
+inline int VTableFileDescriptor(const VTable &vtable, void *ptr)
+{
+    return vtable.lexFileDescriptor != nullptr ? vtable.lexFileDescriptor(ptr) : -1;
+}
+
+/**
+ * @brief Call LexSizeHint through a VTable, returning 0 if the stream isn't
+ *        a SizeHint.
+ */
+inline size_t VTableSizeHint(const VTable &vtable, void *ptr)
+{
+    return vtable.lexSizeHint != nullptr ? vtable.lexSizeHint(ptr) : 0;
+}
+
+/**
+ * @brief Call LexLength through a VTable, falling back to seeking to the end
+ *        and back if the stream isn't Sized.
+ */
+inline size_t VTableLength(const VTable &vtable, void *ptr)
+{
+    if (vtable.lexLength != nullptr)
+    {
+        return vtable.lexLength(ptr);
+    }
+
+    const size_t old = vtable.lexSeek(ptr, {0, Whence::current});
+    const size_t len = vtable.lexSeek(ptr, {0, Whence::end});
+    vtable.lexSeek(ptr, {ptrdiff_t(old), Whence::start});
+    return len;
+}
+
+} // namespace Detail
+
+template <typename T>
+struct IsRef : std::false_type
+{
+};
+
+template <typename T>
+LEXIO_INLINE_VAR constexpr bool IsRefV = IsRef<T>::value;
+
+/**
+ * @brief A type-erased reference to a stream that implements Reader.
+ */
+class ReaderRef
+{
+    friend class UnbufferedReaderRef;
+
+  public:
+    template <typename READER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<READER> && IsReaderV<READER>>;
+
+    ReaderRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    ReaderRef(const ReaderRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Reader that isn't a Ref.
+     */
+    template <typename READER, typename = EnableIfWrappable<READER>>
+    ReaderRef(READER &reader) : m_ptr(&reader), m_vtable(&Detail::VTableFor<READER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        ReaderRef from some other type of Ref.
+     */
+    ReaderRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    ReaderRef &operator=(const ReaderRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any Reader that isn't a Ref.
+     */
+    template <typename READER, typename = EnableIfWrappable<READER>>
+    ReaderRef &operator=(READER &reader)
+    {
+        m_ptr = &reader;
+        m_vtable = &Detail::VTableFor<READER>::value;
+        return *this;
+    }
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<ReaderRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements BufferedReader.
+ */
+class BufferedReaderRef
+{
+  public:
+    template <typename BUFFERED_READER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<BUFFERED_READER> && IsBufferedReaderV<BUFFERED_READER>>;
+
+    BufferedReaderRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    BufferedReaderRef(const BufferedReaderRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any BufferedReader that isn't a Ref.
+     */
+    template <typename BUFFERED_READER, typename = EnableIfWrappable<BUFFERED_READER>>
+    BufferedReaderRef(BUFFERED_READER &bufReader)
+        : m_ptr(&bufReader), m_vtable(&Detail::VTableFor<BUFFERED_READER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        BufferedReaderRef from some other type of Ref.
+     */
+    BufferedReaderRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    BufferedReaderRef &operator=(const BufferedReaderRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any BufferedReader that isn't a Ref.
+     */
+    template <typename BUFFERED_READER, typename = EnableIfWrappable<BUFFERED_READER>>
+    BufferedReaderRef &operator=(BUFFERED_READER &bufReader)
+    {
+        m_ptr = &bufReader;
+        m_vtable = &Detail::VTableFor<BUFFERED_READER>::value;
+        return *this;
+    }
+
+    /**
+     * @brief User-defined conversion that directly converts to a ReaderRef,
+     *        avoiding an extra indirection.
+     */
+    operator ReaderRef() const { return ReaderRef{m_ptr, m_vtable}; };
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+    BufferView LexFillBuffer(size_t size) const { return m_vtable->lexFillBuffer(m_ptr, size); }
+    void LexConsumeBuffer(size_t size) const { m_vtable->lexConsumeBuffer(m_ptr, size); }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t size) const
+    {
+        return Detail::VTableTryFillBuffer(*m_vtable, m_ptr, outBuffer, size);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<BufferedReaderRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements Reader, but not
+ *        BufferedReader.  Useful if you want to make functions that overload
+ *        based on the presence or absence of BufferedReader.
+ */
+class UnbufferedReaderRef
+{
+  public:
+    template <typename READER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<READER> && IsReaderV<READER> && !IsBufferedReaderV<READER>>;
+
+    UnbufferedReaderRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    UnbufferedReaderRef(const UnbufferedReaderRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Reader that isn't a Ref or BufferedReader.
+     */
+    template <typename READER, typename = EnableIfWrappable<READER>>
+    UnbufferedReaderRef(READER &reader) : m_ptr(&reader), m_vtable(&Detail::VTableFor<READER>::value)
+    {
+    }
+
+    /**
+     * @brief Construct from a ReaderRef.  Avoids an extra indirection.
+     */
+    UnbufferedReaderRef(const ReaderRef &reader) : m_ptr(reader.m_ptr), m_vtable(reader.m_vtable) {}
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct an
+     *        UnbufferedReaderRef from some other type of Ref.
+     */
+    UnbufferedReaderRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    UnbufferedReaderRef &operator=(const UnbufferedReaderRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any Reader that isn't a Ref or
+     *        BufferedReader.
+     */
+    template <typename READER, typename = EnableIfWrappable<READER>>
+    UnbufferedReaderRef &operator=(READER &reader)
+    {
+        m_ptr = &reader;
+        m_vtable = &Detail::VTableFor<READER>::value;
+        return *this;
+    }
+
+    /**
+     * @brief Convert to ReaderRef.
+     */
+    operator ReaderRef() const { return ReaderRef{m_ptr, m_vtable}; };
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<UnbufferedReaderRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements Writer.
+ */
+class WriterRef
+{
+  public:
+    template <typename WRITER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<WRITER> && IsWriterV<WRITER>>;
+
+    WriterRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    WriterRef(const WriterRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Writer that isn't a Ref.
+     */
+    template <typename WRITER, typename = EnableIfWrappable<WRITER>>
+    WriterRef(WRITER &writer) : m_ptr(&writer), m_vtable(&Detail::VTableFor<WRITER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        WriterRef from some other type of Ref.
+     */
+    WriterRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    WriterRef &operator=(const WriterRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any Writer that isn't a Ref.
+     */
+    template <typename WRITER, typename = EnableIfWrappable<WRITER>>
+    WriterRef &operator=(WRITER &writer)
+    {
+        m_ptr = &writer;
+        m_vtable = &Detail::VTableFor<WRITER>::value;
+        return *this;
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count) const { return m_vtable->lexWrite(m_ptr, src, count); }
+    void LexFlush() const { m_vtable->lexFlush(m_ptr); }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) const
+    {
+        return Detail::VTableTryWrite(*m_vtable, m_ptr, outWritten, src, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<WriterRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements both Writer and
+ *        BufferedWriter.
+ */
+class BufferedWriterRef
+{
+  public:
+    template <typename BUFFERED_WRITER>
+    using EnableIfWrappable =
+        std::enable_if_t<!IsRefV<BUFFERED_WRITER> && IsWriterV<BUFFERED_WRITER> && IsBufferedWriterV<BUFFERED_WRITER>>;
+
+    BufferedWriterRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    BufferedWriterRef(const BufferedWriterRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any BufferedWriter that isn't a Ref.
+     */
+    template <typename BUFFERED_WRITER, typename = EnableIfWrappable<BUFFERED_WRITER>>
+    BufferedWriterRef(BUFFERED_WRITER &bufWriter)
+        : m_ptr(&bufWriter), m_vtable(&Detail::VTableFor<BUFFERED_WRITER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        BufferedWriterRef from some other type of Ref.
+     */
+    BufferedWriterRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    BufferedWriterRef &operator=(const BufferedWriterRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any BufferedWriter that isn't a Ref.
+     */
+    template <typename BUFFERED_WRITER, typename = EnableIfWrappable<BUFFERED_WRITER>>
+    BufferedWriterRef &operator=(BUFFERED_WRITER &bufWriter)
+    {
+        m_ptr = &bufWriter;
+        m_vtable = &Detail::VTableFor<BUFFERED_WRITER>::value;
+        return *this;
+    }
+
+    /**
+     * @brief User-defined conversion that directly converts to a WriterRef,
+     *        avoiding an extra indirection.
+     */
+    operator WriterRef() const { return WriterRef{m_ptr, m_vtable}; };
+
+    size_t LexWrite(const uint8_t *src, size_t count) const { return m_vtable->lexWrite(m_ptr, src, count); }
+    void LexFlush() const { m_vtable->lexFlush(m_ptr); }
+    MutableBufferView LexReserve(size_t count) const { return m_vtable->lexReserve(m_ptr, count); }
+    void LexCommit(size_t count) const { m_vtable->lexCommit(m_ptr, count); }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) const
+    {
+        return Detail::VTableTryWrite(*m_vtable, m_ptr, outWritten, src, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<BufferedWriterRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements Seekable.
+ */
+class SeekableRef
+{
+  public:
+    template <typename SEEKABLE>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<SEEKABLE> && IsSeekableV<SEEKABLE>>;
+
+    SeekableRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    SeekableRef(const SeekableRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Seekable that isn't a Ref.
+     */
+    template <typename SEEKABLE, typename = EnableIfWrappable<SEEKABLE>>
+    SeekableRef(SEEKABLE &seekable) : m_ptr(&seekable), m_vtable(&Detail::VTableFor<SEEKABLE>::value)
     {
-        m_ptr = &reader;
-        m_lexRead = Detail::WrapRead<READER>;
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        SeekableRef from some other type of Ref.
+     */
+    SeekableRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    SeekableRef &operator=(const SeekableRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any Seekable that isn't a Ref.
+     */
+    template <typename SEEKABLE, typename = EnableIfWrappable<SEEKABLE>>
+    SeekableRef &operator=(SEEKABLE &seekable)
+    {
+        m_ptr = &seekable;
+        m_vtable = &Detail::VTableFor<SEEKABLE>::value;
         return *this;
     }
 
-    size_t LexRead(uint8_t *outDest, size_t count) const { return m_lexRead(m_ptr, outDest, count); }
+    size_t LexSeek(const SeekPos &pos) const { return m_vtable->lexSeek(m_ptr, pos); }
+    size_t LexLength() const { return Detail::VTableLength(*m_vtable, m_ptr); }
 
   protected:
     void *m_ptr;
-    WrapReadFunc m_lexRead;
+    const Detail::VTable *m_vtable;
 };
 
 template <>
-struct IsRef<ReaderRef> : std::true_type
+struct IsRef<SeekableRef> : std::true_type
 {
 };
 
 /**
- * @brief A type-erased reference to a stream that implements BufferedReader.
+ * @brief A type-erased reference to a stream that implements both Reader and
+ *        Seekable.
  */
-class BufferedReaderRef
+class ReadSeekRef
 {
   public:
-    using WrapFillBufferFunc = BufferView (*)(void *, size_t);
-    using WrapConsumeBufferFunc = void (*)(void *, size_t);
-
-    template <typename BUFFERED_READER>
-    using EnableIfWrappable = std::enable_if_t<!IsRefV<BUFFERED_READER> && IsBufferedReaderV<BUFFERED_READER>>;
+    template <typename STREAM>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<STREAM> && IsReaderV<STREAM> && IsSeekableV<STREAM>>;
 
-    BufferedReaderRef() = delete;
+    ReadSeekRef() = delete;
 
     /**
      * @brief Copy constructor.
      */
-    BufferedReaderRef(const BufferedReaderRef &other)
-        : m_ptr(other.m_ptr), m_lexRead(other.m_lexRead), m_lexFillBuffer(other.m_lexFillBuffer),
-          m_lexConsumeBuffer(other.m_lexConsumeBuffer)
+    ReadSeekRef(const ReadSeekRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Reader and Seekable that isn't a Ref.
+     */
+    template <typename STREAM, typename = EnableIfWrappable<STREAM>>
+    ReadSeekRef(STREAM &stream) : m_ptr(&stream), m_vtable(&Detail::VTableFor<STREAM>::value)
     {
     }
 
     /**
-     * @brief Construct and wrap any BufferedReader that isn't a Ref.
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        ReadSeekRef from some other type of Ref.
      */
-    template <typename BUFFERED_READER, typename = EnableIfWrappable<BUFFERED_READER>>
-    BufferedReaderRef(BUFFERED_READER &bufReader)
-        : m_ptr(&bufReader), m_lexRead(Detail::WrapRead<BUFFERED_READER>),
-          m_lexFillBuffer(Detail::WrapFillBuffer<BUFFERED_READER>),
-          m_lexConsumeBuffer(Detail::WrapConsumeBuffer<BUFFERED_READER>)
+    ReadSeekRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    ReadSeekRef &operator=(const ReadSeekRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any Reader and Seekable that isn't a Ref.
+     */
+    template <typename STREAM, typename = EnableIfWrappable<STREAM>>
+    ReadSeekRef &operator=(STREAM &stream)
     {
+        m_ptr = &stream;
+        m_vtable = &Detail::VTableFor<STREAM>::value;
+        return *this;
     }
 
     /**
-     * @brief Member-wise constructor.  Useful if you want to construct a
-     *        BufferedReaderRef from some other type of Ref.
+     * @brief Convert to ReaderRef.
+     */
+    operator ReaderRef() const { return ReaderRef{m_ptr, m_vtable}; };
+
+    /**
+     * @brief Convert to SeekableRef.
+     */
+    operator SeekableRef() const { return SeekableRef{m_ptr, m_vtable}; };
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+    size_t LexSeek(const SeekPos &pos) const { return m_vtable->lexSeek(m_ptr, pos); }
+    size_t LexLength() const { return Detail::VTableLength(*m_vtable, m_ptr); }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<ReadSeekRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements Reader, Writer
+ *        and Seekable.
+ */
+class StreamRef
+{
+  public:
+    template <typename STREAM>
+    using EnableIfWrappable =
+        std::enable_if_t<!IsRefV<STREAM> && IsReaderV<STREAM> && IsWriterV<STREAM> && IsSeekableV<STREAM>>;
+
+    StreamRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    StreamRef(const StreamRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any Reader, Writer and Seekable that isn't a Ref.
      */
-    BufferedReaderRef(void *ptr, ReaderRef::WrapReadFunc lexRead, WrapFillBufferFunc lexFillBuffer,
-                      WrapConsumeBufferFunc lexConsumeBuffer)
-        : m_ptr(ptr), m_lexRead(lexRead), m_lexFillBuffer(lexFillBuffer), m_lexConsumeBuffer(lexConsumeBuffer)
+    template <typename STREAM, typename = EnableIfWrappable<STREAM>>
+    StreamRef(STREAM &stream) : m_ptr(&stream), m_vtable(&Detail::VTableFor<STREAM>::value)
     {
     }
 
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        StreamRef from some other type of Ref.
+     */
+    StreamRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
     /**
      * @brief Copy assignment operator.
      */
-    BufferedReaderRef &operator=(const BufferedReaderRef &other)
+    StreamRef &operator=(const StreamRef &other)
     {
         if (this == &other)
         {
@@ -593,88 +2041,250 @@ class BufferedReaderRef
         }
 
         m_ptr = other.m_ptr;
-        m_lexRead = other.m_lexRead;
-        m_lexFillBuffer = other.m_lexFillBuffer;
-        m_lexConsumeBuffer = other.m_lexConsumeBuffer;
+        m_vtable = other.m_vtable;
         return *this;
     }
 
     /**
-     * @brief Copy-assign and wrap any BufferedReader that isn't a Ref.
+     * @brief Copy-assign and wrap any Reader, Writer and Seekable that isn't a Ref.
      */
-    template <typename BUFFERED_READER, typename = EnableIfWrappable<BUFFERED_READER>>
-    BufferedReaderRef &operator=(BUFFERED_READER &bufReader)
+    template <typename STREAM, typename = EnableIfWrappable<STREAM>>
+    StreamRef &operator=(STREAM &stream)
     {
-        m_ptr = &bufReader;
-        m_lexRead = Detail::WrapRead<BUFFERED_READER>;
-        m_lexFillBuffer = Detail::WrapFillBuffer<BUFFERED_READER>;
-        m_lexConsumeBuffer = Detail::WrapConsumeBuffer<BUFFERED_READER>;
+        m_ptr = &stream;
+        m_vtable = &Detail::VTableFor<STREAM>::value;
         return *this;
     }
 
     /**
-     * @brief User-defined conversion that directly converts to a ReaderRef,
-     *        avoiding an extra indirection.
+     * @brief Convert to ReaderRef.
+     */
+    operator ReaderRef() const { return ReaderRef{m_ptr, m_vtable}; };
+
+    /**
+     * @brief Convert to WriterRef.
+     */
+    operator WriterRef() const { return WriterRef{m_ptr, m_vtable}; };
+
+    /**
+     * @brief Convert to SeekableRef.
      */
-    operator ReaderRef() const { return ReaderRef{m_ptr, m_lexRead}; };
+    operator SeekableRef() const { return SeekableRef{m_ptr, m_vtable}; };
+
+    /**
+     * @brief Convert to ReadSeekRef.
+     */
+    operator ReadSeekRef() const { return ReadSeekRef{m_ptr, m_vtable}; };
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+    size_t LexWrite(const uint8_t *src, size_t count) const { return m_vtable->lexWrite(m_ptr, src, count); }
+    void LexFlush() const { m_vtable->lexFlush(m_ptr); }
+    size_t LexSeek(const SeekPos &pos) const { return m_vtable->lexSeek(m_ptr, pos); }
+    size_t LexLength() const { return Detail::VTableLength(*m_vtable, m_ptr); }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) const
+    {
+        return Detail::VTableTryWrite(*m_vtable, m_ptr, outWritten, src, count);
+    }
 
-    size_t LexRead(uint8_t *outDest, size_t count) const { return m_lexRead(m_ptr, outDest, count); }
-    BufferView LexFillBuffer(size_t size) const { return m_lexFillBuffer(m_ptr, size); }
-    void LexConsumeBuffer(size_t size) const { m_lexConsumeBuffer(m_ptr, size); }
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
 
   protected:
     void *m_ptr;
-    ReaderRef::WrapReadFunc m_lexRead;
-    WrapFillBufferFunc m_lexFillBuffer;
-    WrapConsumeBufferFunc m_lexConsumeBuffer;
+    const Detail::VTable *m_vtable;
 };
 
 template <>
-struct IsRef<BufferedReaderRef> : std::true_type
+struct IsRef<StreamRef> : std::true_type
 {
 };
 
 /**
- * @brief A type-erased reference to a stream that implements Reader, but not
- *        BufferedReader.  Useful if you want to make functions that overload
- *        based on the presence or absence of BufferedReader.
+ * @brief A type-erased reference to a stream that implements PositionalReader.
  */
-class UnbufferedReaderRef
+class PositionalReaderRef
 {
   public:
-    template <typename READER>
-    using EnableIfWrappable = std::enable_if_t<!IsRefV<READER> && IsReaderV<READER> && !IsBufferedReaderV<READER>>;
+    template <typename POSITIONAL_READER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<POSITIONAL_READER> && IsPositionalReaderV<POSITIONAL_READER>>;
 
-    UnbufferedReaderRef() = delete;
+    PositionalReaderRef() = delete;
 
     /**
      * @brief Copy constructor.
      */
-    UnbufferedReaderRef(const UnbufferedReaderRef &other) : m_ptr(other.m_ptr), m_lexRead(other.m_lexRead) {}
+    PositionalReaderRef(const PositionalReaderRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
 
     /**
-     * @brief Construct and wrap any Reader that isn't a Ref or BufferedReader.
+     * @brief Construct and wrap any PositionalReader that isn't a Ref.
      */
-    template <typename READER, typename = EnableIfWrappable<READER>>
-    UnbufferedReaderRef(READER &reader) : m_ptr(&reader), m_lexRead(Detail::WrapRead<READER>)
+    template <typename POSITIONAL_READER, typename = EnableIfWrappable<POSITIONAL_READER>>
+    PositionalReaderRef(POSITIONAL_READER &reader)
+        : m_ptr(&reader), m_vtable(&Detail::VTableFor<POSITIONAL_READER>::value)
     {
     }
 
     /**
-     * @brief Construct from a ReaderRef.  Avoids an extra indirection.
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        PositionalReaderRef from some other type of Ref.
      */
-    UnbufferedReaderRef(const ReaderRef &reader) : m_ptr(reader.m_ptr), m_lexRead(reader.m_lexRead) {}
+    PositionalReaderRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
 
     /**
-     * @brief Member-wise constructor.  Useful if you want to construct an
-     *        UnbufferedReaderRef from some other type of Ref.
+     * @brief Copy assignment operator.
+     */
+    PositionalReaderRef &operator=(const PositionalReaderRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any PositionalReader that isn't a Ref.
+     */
+    template <typename POSITIONAL_READER, typename = EnableIfWrappable<POSITIONAL_READER>>
+    PositionalReaderRef &operator=(POSITIONAL_READER &reader)
+    {
+        m_ptr = &reader;
+        m_vtable = &Detail::VTableFor<POSITIONAL_READER>::value;
+        return *this;
+    }
+
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        return m_vtable->lexReadAt(m_ptr, outDest, count, offset);
+    }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<PositionalReaderRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements PositionalWriter.
+ */
+class PositionalWriterRef
+{
+  public:
+    template <typename POSITIONAL_WRITER>
+    using EnableIfWrappable = std::enable_if_t<!IsRefV<POSITIONAL_WRITER> && IsPositionalWriterV<POSITIONAL_WRITER>>;
+
+    PositionalWriterRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    PositionalWriterRef(const PositionalWriterRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any PositionalWriter that isn't a Ref.
+     */
+    template <typename POSITIONAL_WRITER, typename = EnableIfWrappable<POSITIONAL_WRITER>>
+    PositionalWriterRef(POSITIONAL_WRITER &writer)
+        : m_ptr(&writer), m_vtable(&Detail::VTableFor<POSITIONAL_WRITER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        PositionalWriterRef from some other type of Ref.
+     */
+    PositionalWriterRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
+
+    /**
+     * @brief Copy assignment operator.
+     */
+    PositionalWriterRef &operator=(const PositionalWriterRef &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        m_ptr = other.m_ptr;
+        m_vtable = other.m_vtable;
+        return *this;
+    }
+
+    /**
+     * @brief Copy-assign and wrap any PositionalWriter that isn't a Ref.
+     */
+    template <typename POSITIONAL_WRITER, typename = EnableIfWrappable<POSITIONAL_WRITER>>
+    PositionalWriterRef &operator=(POSITIONAL_WRITER &writer)
+    {
+        m_ptr = &writer;
+        m_vtable = &Detail::VTableFor<POSITIONAL_WRITER>::value;
+        return *this;
+    }
+
+    size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset) const
+    {
+        return m_vtable->lexWriteAt(m_ptr, src, count, offset);
+    }
+
+  protected:
+    void *m_ptr;
+    const Detail::VTable *m_vtable;
+};
+
+template <>
+struct IsRef<PositionalWriterRef> : std::true_type
+{
+};
+
+/**
+ * @brief A type-erased reference to a stream that implements both Reader and
+ *        VectoredReader.
+ */
+class VectoredReaderRef
+{
+  public:
+    template <typename VECTORED_READER>
+    using EnableIfWrappable =
+        std::enable_if_t<!IsRefV<VECTORED_READER> && IsReaderV<VECTORED_READER> && IsVectoredReaderV<VECTORED_READER>>;
+
+    VectoredReaderRef() = delete;
+
+    /**
+     * @brief Copy constructor.
+     */
+    VectoredReaderRef(const VectoredReaderRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
+
+    /**
+     * @brief Construct and wrap any VectoredReader that isn't a Ref.
+     */
+    template <typename VECTORED_READER, typename = EnableIfWrappable<VECTORED_READER>>
+    VectoredReaderRef(VECTORED_READER &reader) : m_ptr(&reader), m_vtable(&Detail::VTableFor<VECTORED_READER>::value)
+    {
+    }
+
+    /**
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        VectoredReaderRef from some other type of Ref.
      */
-    UnbufferedReaderRef(void *ptr, ReaderRef::WrapReadFunc lexRead) : m_ptr(ptr), m_lexRead(lexRead) {}
+    VectoredReaderRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
 
     /**
      * @brief Copy assignment operator.
      */
-    UnbufferedReaderRef &operator=(const UnbufferedReaderRef &other)
+    VectoredReaderRef &operator=(const VectoredReaderRef &other)
     {
         if (this == &other)
         {
@@ -682,82 +2292,87 @@ class UnbufferedReaderRef
         }
 
         m_ptr = other.m_ptr;
-        m_lexRead = other.m_lexRead;
+        m_vtable = other.m_vtable;
         return *this;
     }
 
     /**
-     * @brief Copy-assign and wrap any Reader that isn't a Ref or
-     *        BufferedReader.
+     * @brief Copy-assign and wrap any VectoredReader that isn't a Ref.
      */
-    template <typename READER, typename = EnableIfWrappable<READER>>
-    UnbufferedReaderRef &operator=(READER &reader)
+    template <typename VECTORED_READER, typename = EnableIfWrappable<VECTORED_READER>>
+    VectoredReaderRef &operator=(VECTORED_READER &reader)
     {
         m_ptr = &reader;
-        m_lexRead = Detail::WrapRead<READER>;
+        m_vtable = &Detail::VTableFor<VECTORED_READER>::value;
         return *this;
     }
 
     /**
-     * @brief Convert to ReaderRef.
+     * @brief User-defined conversion that directly converts to a ReaderRef,
+     *        avoiding an extra indirection.
      */
-    operator ReaderRef() const { return ReaderRef{m_ptr, m_lexRead}; };
+    operator ReaderRef() const { return ReaderRef{m_ptr, m_vtable}; };
+
+    size_t LexRead(uint8_t *outDest, size_t count) const { return m_vtable->lexRead(m_ptr, outDest, count); }
+    size_t LexReadV(const MutableBufferView *bufs, size_t count) const
+    {
+        return m_vtable->lexReadV(m_ptr, bufs, count);
+    }
 
-    size_t LexRead(uint8_t *outDest, size_t count) const { return m_lexRead(m_ptr, outDest, count); }
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) const
+    {
+        return Detail::VTableTryRead(*m_vtable, m_ptr, outRead, outDest, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
+    size_t LexSizeHint() const { return Detail::VTableSizeHint(*m_vtable, m_ptr); }
 
   protected:
     void *m_ptr;
-    ReaderRef::WrapReadFunc m_lexRead;
+    const Detail::VTable *m_vtable;
 };
 
 template <>
-struct IsRef<UnbufferedReaderRef> : std::true_type
+struct IsRef<VectoredReaderRef> : std::true_type
 {
 };
 
 /**
- * @brief A type-erased reference to a stream that implements Writer.
+ * @brief A type-erased reference to a stream that implements both Writer and
+ *        VectoredWriter.
  */
-class WriterRef
+class VectoredWriterRef
 {
   public:
-    using WrapWriteFunc = size_t (*)(void *, const uint8_t *, size_t);
-    using WrapFlushFunc = void (*)(void *);
-
-    template <typename WRITER>
-    using EnableIfWrappable = std::enable_if_t<!IsRefV<WRITER> && IsWriterV<WRITER>>;
+    template <typename VECTORED_WRITER>
+    using EnableIfWrappable =
+        std::enable_if_t<!IsRefV<VECTORED_WRITER> && IsWriterV<VECTORED_WRITER> && IsVectoredWriterV<VECTORED_WRITER>>;
 
-    WriterRef() = delete;
+    VectoredWriterRef() = delete;
 
     /**
      * @brief Copy constructor.
      */
-    WriterRef(const WriterRef &other) : m_ptr(other.m_ptr), m_lexWrite(other.m_lexWrite), m_lexFlush(other.m_lexFlush)
-    {
-    }
+    VectoredWriterRef(const VectoredWriterRef &other) : m_ptr(other.m_ptr), m_vtable(other.m_vtable) {}
 
     /**
-     * @brief Construct and wrap any Writer that isn't a Ref.
+     * @brief Construct and wrap any VectoredWriter that isn't a Ref.
      */
-    template <typename WRITER, typename = EnableIfWrappable<WRITER>>
-    WriterRef(WRITER &writer)
-        : m_ptr(&writer), m_lexWrite(Detail::WrapWrite<WRITER>), m_lexFlush(Detail::WrapFlush<WRITER>)
+    template <typename VECTORED_WRITER, typename = EnableIfWrappable<VECTORED_WRITER>>
+    VectoredWriterRef(VECTORED_WRITER &writer) : m_ptr(&writer), m_vtable(&Detail::VTableFor<VECTORED_WRITER>::value)
     {
     }
 
     /**
-     * @brief Member-wise constructor.  Useful if you want to construct an
-     *        WriterRef from some other type of Ref.
+     * @brief Member-wise constructor.  Useful if you want to construct a
+     *        VectoredWriterRef from some other type of Ref.
      */
-    WriterRef(void *ptr, WrapWriteFunc lexWrite, WrapFlushFunc lexFlush)
-        : m_ptr(ptr), m_lexWrite(lexWrite), m_lexFlush(lexFlush)
-    {
-    }
+    VectoredWriterRef(void *ptr, const Detail::VTable *vtable) : m_ptr(ptr), m_vtable(vtable) {}
 
     /**
      * @brief Copy assignment operator.
      */
-    WriterRef &operator=(const WriterRef &other)
+    VectoredWriterRef &operator=(const VectoredWriterRef &other)
     {
         if (this == &other)
         {
@@ -765,106 +2380,291 @@ class WriterRef
         }
 
         m_ptr = other.m_ptr;
-        m_lexWrite = other.m_lexWrite;
-        m_lexFlush = other.m_lexFlush;
+        m_vtable = other.m_vtable;
         return *this;
     }
 
     /**
-     * @brief Copy-assign and wrap any Writer that isn't a Ref.
+     * @brief Copy-assign and wrap any VectoredWriter that isn't a Ref.
      */
-    template <typename WRITER, typename = EnableIfWrappable<WRITER>>
-    WriterRef &operator=(WRITER &writer)
+    template <typename VECTORED_WRITER, typename = EnableIfWrappable<VECTORED_WRITER>>
+    VectoredWriterRef &operator=(VECTORED_WRITER &writer)
     {
         m_ptr = &writer;
-        m_lexWrite = Detail::WrapWrite<WRITER>;
-        m_lexFlush = Detail::WrapFlush<WRITER>;
+        m_vtable = &Detail::VTableFor<VECTORED_WRITER>::value;
         return *this;
     }
 
-    size_t LexWrite(const uint8_t *src, size_t count) const { return m_lexWrite(m_ptr, src, count); }
-    void LexFlush() const { m_lexFlush(m_ptr); }
+    /**
+     * @brief User-defined conversion that directly converts to a WriterRef,
+     *        avoiding an extra indirection.
+     */
+    operator WriterRef() const { return WriterRef{m_ptr, m_vtable}; };
+
+    size_t LexWrite(const uint8_t *src, size_t count) const { return m_vtable->lexWrite(m_ptr, src, count); }
+    void LexFlush() const { m_vtable->lexFlush(m_ptr); }
+    size_t LexWriteV(const BufferView *bufs, size_t count) const
+    {
+        return m_vtable->lexWriteV(m_ptr, bufs, count);
+    }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) const
+    {
+        return Detail::VTableTryWrite(*m_vtable, m_ptr, outWritten, src, count);
+    }
+
+    int LexFileDescriptor() const { return Detail::VTableFileDescriptor(*m_vtable, m_ptr); }
 
   protected:
     void *m_ptr;
-    WrapWriteFunc m_lexWrite;
-    WrapFlushFunc m_lexFlush;
+    const Detail::VTable *m_vtable;
 };
 
 template <>
-struct IsRef<WriterRef> : std::true_type
+struct IsRef<VectoredWriterRef> : std::true_type
 {
 };
 
+namespace Detail
+{
+
 /**
- * @brief A type-erased reference to a stream that implements Seekable.
+ * @brief Enabled if the passed type is a Reader that is not a Ref, which
+ *        allows calls to it to be statically dispatched and inlined.
  */
-class SeekableRef
+template <typename READER>
+using EnableIfConcreteReader = std::enable_if_t<!IsRefV<std::remove_const_t<READER>> && IsReaderV<READER>>;
+
+/**
+ * @brief Enabled if the passed type is a Writer that is not a Ref, which
+ *        allows calls to it to be statically dispatched and inlined.
+ */
+template <typename WRITER>
+using EnableIfConcreteWriter = std::enable_if_t<!IsRefV<std::remove_const_t<WRITER>> && IsWriterV<WRITER>>;
+
+template <typename READER>
+inline size_t ReadLoop(uint8_t *dest, READER &reader, size_t count)
 {
-  public:
-    using WrapSeekFunc = size_t (*)(void *, const SeekPos &);
+    size_t offset = 0, remain = count;
+    while (offset != count)
+    {
+        const size_t read = reader.LexRead(dest + offset, remain);
+        if (read == 0)
+        {
+            return offset;
+        }
 
-    template <typename SEEKABLE>
-    using EnableIfWrappable = std::enable_if_t<!IsRefV<SEEKABLE> && IsSeekableV<SEEKABLE>>;
+        offset += read;
+        remain -= read;
+    }
 
-    SeekableRef() = delete;
+    return count;
+}
 
-    /**
-     * @brief Copy constructor.
-     */
-    SeekableRef(const SeekableRef &other) : m_ptr(other.m_ptr), m_lexSeek(other.m_lexSeek) {}
+template <typename READER>
+inline void ReadExactLoop(uint8_t *dest, READER &reader, size_t count)
+{
+    size_t offset = 0, remain = count;
+    while (offset != count)
+    {
+        const size_t read = reader.LexRead(dest + offset, remain);
+        if (read == 0)
+        {
+            LEXIO_THROW(std::runtime_error("could not read exact number of bytes"));
+        }
 
-    /**
-     * @brief Construct and wrap any Seekable that isn't a Ref.
-     */
-    template <typename SEEKABLE, typename = EnableIfWrappable<SEEKABLE>>
-    SeekableRef(SEEKABLE &seekable) : m_ptr(&seekable), m_lexSeek(Detail::WrapSeek<SEEKABLE>)
+        offset += read;
+        remain -= read;
+    }
+}
+
+template <size_t N, typename BUFFERED_READER>
+LEXIO_FORCEINLINE void LoadExact(uint8_t (&outBuf)[N], BUFFERED_READER &bufReader, std::true_type)
+{
+    const BufferView view = bufReader.LexFillBuffer(N);
+    if (view.Size() >= N)
     {
+        // Fast path, copy straight out of the buffer.
+        std::memcpy(&outBuf[0], view.Data(), N);
+        bufReader.LexConsumeBuffer(N);
+        return;
     }
 
-    /**
-     * @brief Member-wise constructor.  Useful if you want to construct an
-     *        SeekableRef from some other type of Ref.
-     */
-    SeekableRef(void *ptr, WrapSeekFunc lexSeek) : m_ptr(ptr), m_lexSeek(lexSeek) {}
+    // Buffer came up short, let the read loop sort it out.
+    ReadExactLoop(&outBuf[0], bufReader, N);
+}
 
-    /**
-     * @brief Copy assignment operator.
-     */
-    SeekableRef &operator=(const SeekableRef &other)
+template <size_t N, typename READER>
+LEXIO_FORCEINLINE void LoadExact(uint8_t (&outBuf)[N], READER &reader, std::false_type)
+{
+    ReadExactLoop(&outBuf[0], reader, N);
+}
+
+/**
+ * @brief Read exactly N bytes into a small fixed-size buffer.  If the reader
+ *        is a BufferedReader, the bytes are copied directly out of its
+ *        buffer, which lets the compiler turn the copy and a subsequent
+ *        decode into a single load.
+ *
+ * @throws std::runtime_error if not enough bytes could be read, or if an
+ *         error with the read operation was encountered.
+ */
+template <size_t N, typename READER>
+LEXIO_FORCEINLINE void LoadExact(uint8_t (&outBuf)[N], READER &reader)
+{
+    LoadExact(outBuf, reader, IsBufferedReader<READER>{});
+}
+
+template <typename WRITER>
+inline size_t WriteLoop(WRITER &writer, const uint8_t *src, size_t count)
+{
+    size_t offset = 0, remain = count;
+    while (offset != count)
     {
-        if (this == &other)
+        const size_t written = writer.LexWrite(src + offset, remain);
+        if (written == 0)
         {
-            return *this;
+            return offset;
         }
 
-        m_ptr = other.m_ptr;
-        m_lexSeek = other.m_lexSeek;
-        return *this;
+        offset += written;
+        remain -= written;
     }
 
-    /**
-     * @brief Copy-assign and wrap any Seekable that isn't a Ref.
-     */
-    template <typename SEEKABLE, typename = EnableIfWrappable<SEEKABLE>>
-    SeekableRef &operator=(SEEKABLE &seekable)
+    return count;
+}
+
+template <typename WRITER>
+inline void WriteExactLoop(WRITER &writer, const uint8_t *src, size_t count)
+{
+    size_t offset = 0, remain = count;
+    while (offset != count)
     {
-        m_ptr = &seekable;
-        m_lexSeek = Detail::WrapSeek<SEEKABLE>;
-        return *this;
+        const size_t written = writer.LexWrite(src + offset, remain);
+        if (written == 0)
+        {
+            LEXIO_THROW(std::runtime_error("could not write exact number of bytes"));
+        }
+
+        offset += written;
+        remain -= written;
     }
+}
 
-    size_t LexSeek(const SeekPos &pos) const { return m_lexSeek(m_ptr, pos); }
+template <typename TRY_READER>
+inline Error TryReadLoop(size_t &outRead, uint8_t *dest, TRY_READER &reader, size_t count)
+{
+    size_t offset = 0;
+    while (offset != count)
+    {
+        size_t read = 0;
+        const Error err = reader.LexTryRead(read, dest + offset, count - offset);
+        if (err)
+        {
+            outRead = offset;
+            return err;
+        }
+        else if (read == 0)
+        {
+            break;
+        }
 
-  protected:
-    void *m_ptr;
-    WrapSeekFunc m_lexSeek;
-};
+        offset += read;
+    }
 
-template <>
-struct IsRef<SeekableRef> : std::true_type
+    outRead = offset;
+    return Error{};
+}
+
+template <typename TRY_READER>
+inline Error TryReadExactLoop(uint8_t *dest, TRY_READER &reader, size_t count)
 {
-};
+    size_t read = 0;
+    const Error err = TryReadLoop(read, dest, reader, count);
+    if (err)
+    {
+        return err;
+    }
+    else if (read != count)
+    {
+        return Error{"could not read exact number of bytes"};
+    }
+    return Error{};
+}
+
+template <typename TRY_WRITER>
+inline Error TryWriteLoop(size_t &outWritten, TRY_WRITER &writer, const uint8_t *src, size_t count)
+{
+    size_t offset = 0;
+    while (offset != count)
+    {
+        size_t written = 0;
+        const Error err = writer.LexTryWrite(written, src + offset, count - offset);
+        if (err)
+        {
+            outWritten = offset;
+            return err;
+        }
+        else if (written == 0)
+        {
+            break;
+        }
+
+        offset += written;
+    }
+
+    outWritten = offset;
+    return Error{};
+}
+
+template <typename TRY_WRITER>
+inline Error TryWriteExactLoop(TRY_WRITER &writer, const uint8_t *src, size_t count)
+{
+    size_t written = 0;
+    const Error err = TryWriteLoop(written, writer, src, count);
+    if (err)
+    {
+        return err;
+    }
+    else if (written != count)
+    {
+        return Error{"could not write exact number of bytes"};
+    }
+    return Error{};
+}
+
+template <size_t N, typename BUFFERED_WRITER, typename ENCODE>
+LEXIO_FORCEINLINE void StoreExact(BUFFERED_WRITER &bufWriter, ENCODE encode, std::true_type)
+{
+    const MutableBufferView view = bufWriter.LexReserve(N);
+    encode(view.Data());
+    bufWriter.LexCommit(N);
+}
+
+template <size_t N, typename WRITER, typename ENCODE>
+LEXIO_FORCEINLINE void StoreExact(WRITER &writer, ENCODE encode, std::false_type)
+{
+    uint8_t buf[N];
+    encode(&buf[0]);
+    WriteExactLoop(writer, &buf[0], N);
+}
+
+/**
+ * @brief Write exactly N bytes produced by an encoder, which is called with
+ *        a pointer to N bytes of writable memory.  If the writer is a
+ *        BufferedWriter, the encoder writes straight into its reserved space
+ *        instead of going through LexWrite.
+ *
+ * @throws std::runtime_error if the bytes could not be written, or if an
+ *         error with the write operation was encountered.
+ */
+template <size_t N, typename WRITER, typename ENCODE>
+LEXIO_FORCEINLINE void StoreExact(WRITER &writer, ENCODE encode)
+{
+    StoreExact<N>(writer, encode, IsBufferedWriter<WRITER>{});
+}
+
+} // namespace Detail
 
 //******************************************************************************
 //
@@ -931,6 +2731,18 @@ inline void ConsumeBuffer(const BufferedReaderRef &bufReader, size_t size)
     bufReader.LexConsumeBuffer(size);
 }
 
+/**
+ * @brief Estimate how many bytes can be read before hitting EOF.
+ *
+ * @param reader Reader to operate on.
+ * @return Expected number of bytes remaining, or 0 if the reader isn't a
+ *         SizeHint or can't tell.  Readers can end earlier or later.
+ */
+inline size_t SizeHint(const ReaderRef &reader)
+{
+    return reader.LexSizeHint();
+}
+
 /**
  * @brief Attempt to write a buffer of data at the current offset.
  *
@@ -959,6 +2771,35 @@ inline void Flush(const WriterRef &writer)
     return writer.LexFlush();
 }
 
+/**
+ * @brief Reserve writable space at the current position of a BufferedWriter.
+ *
+ * @param bufWriter BufferedWriter to operate on.
+ * @param count Amount of space to reserve in bytes.
+ * @return View of the reserved space, which is at least the requested size.
+ *         Nothing is written to the stream until Commit is called.
+ * @throws std::runtime_error if the requested space could not be provided,
+ *         or if an error with draining the buffer was encountered.
+ */
+inline MutableBufferView Reserve(const BufferedWriterRef &bufWriter, size_t count)
+{
+    return bufWriter.LexReserve(count);
+}
+
+/**
+ * @brief Append bytes from the front of the most recent reservation to the
+ *        stream.
+ *
+ * @param bufWriter BufferedWriter to operate on.
+ * @param count Number of reserved bytes to commit.
+ * @throws std::runtime_error if more bytes than were reserved are passed to
+ *         the function.
+ */
+inline void Commit(const BufferedWriterRef &bufWriter, size_t count)
+{
+    bufWriter.LexCommit(count);
+}
+
 /**
  * @brief Seek to a position in the underlying Seekable.
  *
@@ -985,7 +2826,46 @@ inline size_t Seek(const SeekableRef &seekable, const SeekPos &pos)
  */
 inline size_t Seek(const SeekableRef &seekable, ptrdiff_t offset, Whence whence)
 {
-    return seekable.LexSeek({offset, whence});
+    return seekable.LexSeek({offset, whence});
+}
+
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls LexIO::RawRead as many times as necessary to fill
+ *        the output buffer until EOF is hit.
+ *
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader Reader to operate on.
+ * @param count Number of bytes to attempt to read.
+ * @return Actual number of bytes read, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.
+ */
+template <typename BYTE, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
+inline size_t Read(BYTE *outDest, const ReaderRef &reader, size_t count)
+{
+    return Detail::ReadLoop(reinterpret_cast<uint8_t *>(outDest), reader, count);
+}
+
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined.
+ *
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader Reader to operate on.
+ * @param count Number of bytes to attempt to read.
+ * @return Actual number of bytes read, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.
+ */
+template <typename BYTE, typename READER, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+inline size_t Read(BYTE *outDest, READER &reader, size_t count)
+{
+    return Detail::ReadLoop(reinterpret_cast<uint8_t *>(outDest), reader, count);
 }
 
 /**
@@ -993,38 +2873,23 @@ inline size_t Seek(const SeekableRef &seekable, ptrdiff_t offset, Whence whence)
  *        buffer.  Calls LexIO::RawRead as many times as necessary to fill
  *        the output buffer until EOF is hit.
  *
- * @param outDest Pointer to starting byte of output buffer.
+ * @param outArray Output buffer array.
  * @param reader Reader to operate on.
- * @param count Number of bytes to attempt to read.
  * @return Actual number of bytes read, or 0 if EOF-like condition was
  *         encountered.
  * @throws std::runtime_error if an error with the read operation was
  *         encountered.  EOF is _not_ considered an error.
  */
-template <typename BYTE, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
-inline size_t Read(BYTE *outDest, const ReaderRef &reader, size_t count)
+template <typename BYTE, size_t N, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
+LEXIO_FORCEINLINE size_t Read(BYTE (&outArray)[N], const ReaderRef &reader)
 {
-    uint8_t *dest = reinterpret_cast<uint8_t *>(outDest);
-    size_t offset = 0, remain = count;
-    while (offset != count)
-    {
-        const size_t read = reader.LexRead(dest + offset, remain);
-        if (read == 0)
-        {
-            return offset;
-        }
-
-        offset += read;
-        remain -= read;
-    }
-
-    return count;
+    return Read(outArray, reader, N);
 }
 
 /**
  * @brief Read data from the current offset, inserting it into the passed
- *        buffer.  Calls LexIO::RawRead as many times as necessary to fill
- *        the output buffer until EOF is hit.
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined.
  *
  * @param outArray Output buffer array.
  * @param reader Reader to operate on.
@@ -1033,8 +2898,10 @@ inline size_t Read(BYTE *outDest, const ReaderRef &reader, size_t count)
  * @throws std::runtime_error if an error with the read operation was
  *         encountered.  EOF is _not_ considered an error.
  */
-template <typename BYTE, size_t N, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
-LEXIO_FORCEINLINE size_t Read(BYTE (&outArray)[N], const ReaderRef &reader)
+template <typename BYTE, size_t N, typename READER,
+          typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+LEXIO_FORCEINLINE size_t Read(BYTE (&outArray)[N], READER &reader)
 {
     return Read(outArray, reader, N);
 }
@@ -1055,19 +2922,27 @@ LEXIO_FORCEINLINE size_t Read(BYTE (&outArray)[N], const ReaderRef &reader)
 template <typename BYTE, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
 inline void ReadExact(BYTE *outDest, const ReaderRef &reader, size_t count)
 {
-    uint8_t *dest = reinterpret_cast<uint8_t *>(outDest);
-    size_t offset = 0, remain = count;
-    while (offset != count)
-    {
-        const size_t read = reader.LexRead(dest + offset, remain);
-        if (read == 0)
-        {
-            throw std::runtime_error("could not read exact number of bytes");
-        }
+    Detail::ReadExactLoop(reinterpret_cast<uint8_t *>(outDest), reader, count);
+}
 
-        offset += read;
-        remain -= read;
-    }
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined, and throws an exception if not enough bytes could
+ *        be read.
+ *
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader Reader to operate on.
+ * @param count Number of bytes to read.
+ * @throws std::runtime_error if stream encountered an EOF-like condition before
+ *         enough bytes could be read, or if an error with the read operation
+ *         was encountered.
+ */
+template <typename BYTE, typename READER, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+inline void ReadExact(BYTE *outDest, READER &reader, size_t count)
+{
+    Detail::ReadExactLoop(reinterpret_cast<uint8_t *>(outDest), reader, count);
 }
 
 /**
@@ -1088,6 +2963,26 @@ LEXIO_FORCEINLINE void ReadExact(BYTE (&outArray)[N], const ReaderRef &reader)
     ReadExact(outArray, reader, N);
 }
 
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined, and throws an exception if not enough bytes could
+ *        be read.
+ *
+ * @param outArray Output buffer array.
+ * @param reader Reader to operate on.
+ * @throws std::runtime_error if stream encountered an EOF-like condition before
+ *         enough bytes could be read, or if an error with the read operation
+ *         was encountered.
+ */
+template <typename BYTE, size_t N, typename READER,
+          typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+LEXIO_FORCEINLINE void ReadExact(BYTE (&outArray)[N], READER &reader)
+{
+    ReadExact(outArray, reader, N);
+}
+
 /**
  * @brief Get the current contents of the buffer.
  *
@@ -1117,21 +3012,26 @@ inline BufferView GetBuffer(const BufferedReaderRef &bufReader) noexcept
 template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
 inline size_t Write(const WriterRef &writer, const BYTE *src, size_t count)
 {
-    const uint8_t *srcByte = reinterpret_cast<const uint8_t *>(src);
-    size_t offset = 0, remain = count;
-    while (offset != count)
-    {
-        const size_t written = writer.LexWrite(srcByte + offset, remain);
-        if (written == 0)
-        {
-            return offset;
-        }
-
-        offset += written;
-        remain -= written;
-    }
+    return Detail::WriteLoop(writer, reinterpret_cast<const uint8_t *>(src), count);
+}
 
-    return count;
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined.
+ *
+ * @param writer Writer to operate on.
+ * @param src Pointer to starting byte of input buffer.
+ * @param count Size of input buffer in bytes.
+ * @return Actual number of bytes written, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the write operation was
+ *         encountered.  A partial write is _not_ considered an error.
+ */
+template <typename WRITER, typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+inline size_t Write(WRITER &writer, const BYTE *src, size_t count)
+{
+    return Detail::WriteLoop(writer, reinterpret_cast<const uint8_t *>(src), count);
 }
 
 /**
@@ -1152,6 +3052,24 @@ LEXIO_FORCEINLINE size_t Write(const WriterRef &writer, const BYTE (&array)[N])
     return Write(writer, array, N);
 }
 
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined.
+ *
+ * @param writer Writer to operate on.
+ * @param array Input buffer array.
+ * @return Actual number of bytes written, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the write operation was
+ *         encountered.  A partial write is _not_ considered an error.
+ */
+template <typename WRITER, typename BYTE, size_t N, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+LEXIO_FORCEINLINE size_t Write(WRITER &writer, const BYTE (&array)[N])
+{
+    return Write(writer, array, N);
+}
+
 /**
  * @brief Write a buffer of data at the current offset.  Calls LexIO::RawWrite
  *        as many times as necessary to write the entire buffer, throwing
@@ -1167,19 +3085,26 @@ LEXIO_FORCEINLINE size_t Write(const WriterRef &writer, const BYTE (&array)[N])
 template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
 inline void WriteExact(const WriterRef &writer, const BYTE *src, size_t count)
 {
-    const uint8_t *srcByte = reinterpret_cast<const uint8_t *>(src);
-    size_t offset = 0, remain = count;
-    while (offset != count)
-    {
-        const size_t written = writer.LexWrite(srcByte + offset, remain);
-        if (written == 0)
-        {
-            throw std::runtime_error("could not write exact number of bytes");
-        }
+    Detail::WriteExactLoop(writer, reinterpret_cast<const uint8_t *>(src), count);
+}
 
-        offset += written;
-        remain -= written;
-    }
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined, and throws an
+ *        exception if not enough bytes could be written.
+ *
+ * @param writer Writer to operate on.
+ * @param src Pointer to starting byte of input buffer.
+ * @param count Size of input buffer in bytes.
+ * @throws std::runtime_error if stream encountered an EOF-like condition before
+ *         enough bytes could be written, or if an error with the write
+ *         operation was encountered.
+ */
+template <typename WRITER, typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+inline void WriteExact(WRITER &writer, const BYTE *src, size_t count)
+{
+    Detail::WriteExactLoop(writer, reinterpret_cast<const uint8_t *>(src), count);
 }
 
 /**
@@ -1199,6 +3124,24 @@ LEXIO_FORCEINLINE void WriteExact(const WriterRef &writer, const BYTE (&array)[N
     return WriteExact(writer, array, N);
 }
 
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined, and throws an
+ *        exception if not enough bytes could be written.
+ *
+ * @param writer Writer to operate on.
+ * @param array Input buffer array.
+ * @throws std::runtime_error if stream encountered an EOF-like condition before
+ *         enough bytes could be written, or if an error with the write
+ *         operation was encountered.
+ */
+template <typename WRITER, typename BYTE, size_t N, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+LEXIO_FORCEINLINE void WriteExact(WRITER &writer, const BYTE (&array)[N])
+{
+    return WriteExact(writer, array, N);
+}
+
 /**
  * @brief Return the current offset position.
  *
@@ -1228,6 +3171,9 @@ inline size_t Rewind(const SeekableRef &seekable)
 /**
  * @brief Return length of underlying data.
  *
+ * @detail Sized streams are asked directly.  Otherwise the length is found by
+ *         seeking to the end and back to the current position.
+ *
  * @param seekable Seekable to operate on.
  * @return Length of underlying data.
  * @throws std::runtime_error if Seek call throws, or some other error
@@ -1235,10 +3181,233 @@ inline size_t Rewind(const SeekableRef &seekable)
  */
 inline size_t Length(const SeekableRef &seekable)
 {
-    const size_t old = seekable.LexSeek({0, Whence::current});
-    const size_t len = seekable.LexSeek({0, Whence::end});
-    seekable.LexSeek({ptrdiff_t(old), Whence::start});
-    return len;
+    return seekable.LexLength();
+}
+
+/**
+ * @brief Read data from an absolute offset without using or modifying the
+ *        cursor, inserting it into the passed buffer.  Calls the underlying
+ *        LexReadAt as many times as necessary to fill the output buffer
+ *        until EOF is hit.
+ *
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader PositionalReader to operate on.
+ * @param count Number of bytes to attempt to read.
+ * @param offset Absolute offset in the stream to read from.
+ * @return Actual number of bytes read, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.
+ */
+template <typename BYTE, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
+inline size_t ReadAt(BYTE *outDest, const PositionalReaderRef &reader, size_t count, size_t offset)
+{
+    uint8_t *dest = reinterpret_cast<uint8_t *>(outDest);
+    size_t done = 0;
+    while (done != count)
+    {
+        const size_t read = reader.LexReadAt(dest + done, count - done, offset + done);
+        if (read == 0)
+        {
+            return done;
+        }
+
+        done += read;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Write a buffer of data at an absolute offset without using or
+ *        modifying the cursor.  Calls the underlying LexWriteAt as many
+ *        times as necessary to write the entire buffer unless EOF is hit.
+ *
+ * @param writer PositionalWriter to operate on.
+ * @param src Pointer to starting byte of input buffer.
+ * @param count Size of input buffer in bytes.
+ * @param offset Absolute offset in the stream to write to.
+ * @return Actual number of bytes written, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the write operation was
+ *         encountered.  A partial write is _not_ considered an error.
+ */
+template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
+inline size_t WriteAt(const PositionalWriterRef &writer, const BYTE *src, size_t count, size_t offset)
+{
+    const uint8_t *srcByte = reinterpret_cast<const uint8_t *>(src);
+    size_t done = 0;
+    while (done != count)
+    {
+        const size_t written = writer.LexWriteAt(srcByte + done, count - done, offset + done);
+        if (written == 0)
+        {
+            return done;
+        }
+
+        done += written;
+    }
+
+    return count;
+}
+
+namespace Detail
+{
+
+template <typename READER>
+inline size_t ReadV(const MutableBufferView *bufs, READER &reader, size_t count, std::true_type)
+{
+    size_t total = 0, i = 0;
+    while (i != count)
+    {
+        size_t read = reader.LexReadV(bufs + i, count - i);
+        if (read == 0)
+        {
+            return total;
+        }
+        total += read;
+
+        // Skip past every buffer that was completely filled.
+        while (i != count && read >= bufs[i].Size())
+        {
+            read -= bufs[i].Size();
+            i += 1;
+        }
+
+        if (read != 0)
+        {
+            // Finish off the buffer that was only partially filled.
+            MutableBufferView rest{bufs[i].Data() + read, bufs[i].Size() - read};
+            while (rest.Size() != 0)
+            {
+                const size_t restRead = reader.LexReadV(&rest, 1);
+                if (restRead == 0)
+                {
+                    return total;
+                }
+                total += restRead;
+                rest = MutableBufferView{rest.Data() + restRead, rest.Size() - restRead};
+            }
+            i += 1;
+        }
+    }
+
+    return total;
+}
+
+template <typename READER>
+inline size_t ReadV(const MutableBufferView *bufs, READER &reader, size_t count, std::false_type)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t read = Read(bufs[i].Data(), reader, bufs[i].Size());
+        total += read;
+        if (read != bufs[i].Size())
+        {
+            break;
+        }
+    }
+    return total;
+}
+
+template <typename WRITER>
+inline size_t WriteV(WRITER &writer, const BufferView *bufs, size_t count, std::true_type)
+{
+    size_t total = 0, i = 0;
+    while (i != count)
+    {
+        size_t written = writer.LexWriteV(bufs + i, count - i);
+        if (written == 0)
+        {
+            return total;
+        }
+        total += written;
+
+        // Skip past every buffer that was completely written.
+        while (i != count && written >= bufs[i].Size())
+        {
+            written -= bufs[i].Size();
+            i += 1;
+        }
+
+        if (written != 0)
+        {
+            // Finish off the buffer that was only partially written.
+            BufferView rest{bufs[i].Data() + written, bufs[i].Size() - written};
+            while (rest.Size() != 0)
+            {
+                const size_t restWritten = writer.LexWriteV(&rest, 1);
+                if (restWritten == 0)
+                {
+                    return total;
+                }
+                total += restWritten;
+                rest = BufferView{rest.Data() + restWritten, rest.Size() - restWritten};
+            }
+            i += 1;
+        }
+    }
+
+    return total;
+}
+
+template <typename WRITER>
+inline size_t WriteV(WRITER &writer, const BufferView *bufs, size_t count, std::false_type)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t written = Write(writer, bufs[i].Data(), bufs[i].Size());
+        total += written;
+        if (written != bufs[i].Size())
+        {
+            break;
+        }
+    }
+    return total;
+}
+
+} // namespace Detail
+
+/**
+ * @brief Read data from the current offset, scattering it into the passed
+ *        buffers in order.  Uses LexReadV if the reader is a VectoredReader,
+ *        otherwise reads into each buffer one at a time.  Reads as many
+ *        times as necessary to fill every buffer until EOF is hit.
+ *
+ * @param bufs Pointer to first element of an array of output buffers.
+ * @param reader Reader to operate on.
+ * @param count Number of buffers in the array.
+ * @return Total number of bytes read, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.
+ */
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER> || IsVectoredReaderV<READER>>>
+inline size_t ReadV(const MutableBufferView *bufs, READER &reader, size_t count)
+{
+    return Detail::ReadV(bufs, reader, count, IsVectoredReader<READER>{});
+}
+
+/**
+ * @brief Write data at the current offset, gathering it from the passed
+ *        buffers in order.  Uses LexWriteV if the writer is a VectoredWriter,
+ *        otherwise writes each buffer one at a time.  Writes as many times
+ *        as necessary to write every buffer unless EOF is hit.
+ *
+ * @param writer Writer to operate on.
+ * @param bufs Pointer to first element of an array of input buffers.
+ * @param count Number of buffers in the array.
+ * @return Total number of bytes written, or 0 if EOF-like condition was
+ *         encountered.
+ * @throws std::runtime_error if an error with the write operation was
+ *         encountered.  A partial write is _not_ considered an error.
+ */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER> || IsVectoredWriterV<WRITER>>>
+inline size_t WriteV(WRITER &writer, const BufferView *bufs, size_t count)
+{
+    return Detail::WriteV(writer, bufs, count, IsVectoredWriter<WRITER>{});
 }
 
 } // namespace LexIO
@@ -0,0 +1,515 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+/**
+ * @file direct.hpp
+ * @brief Buffers and wrappers that keep I/O aligned for files opened with
+ *        OpenOptions::direct.
+ */
+
+#pragma once
+
+#include "./core.hpp"
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <fcntl.h>
+#include <stdlib.h>
+#endif
+
+#include <utility>
+
+namespace LexIO
+{
+
+/**
+ * @brief Alignment used by default for direct I/O.  Covers the logical
+ *        block size of practically every disk and filesystem.
+ */
+constexpr size_t DEFAULT_DIRECT_ALIGNMENT = 4096;
+
+namespace Detail
+{
+
+constexpr size_t AlignDown(size_t value, size_t alignment)
+{
+    return value - (value % alignment);
+}
+
+constexpr size_t AlignUp(size_t value, size_t alignment)
+{
+    return AlignDown(value + alignment - 1, alignment);
+}
+
+/**
+ * @brief Round a size up to an alignment that came from the caller, after
+ *        making sure the alignment is usable.
+ *
+ * @throws std::runtime_error if the alignment is not a power of two at
+ *         least the size of a pointer.
+ */
+inline size_t CheckedAlignUp(size_t value, size_t alignment)
+{
+    if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0)
+    {
+        LEXIO_THROW(std::runtime_error("alignment must be a power of two"));
+    }
+    return AlignUp(value, alignment);
+}
+
+} // namespace Detail
+
+/**
+ * @brief A heap buffer whose address and size are multiples of an
+ *        alignment.
+ */
+class AlignedBuffer
+{
+    uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_alignment = 0;
+
+    void Free() noexcept
+    {
+#if defined(_WIN32)
+        _aligned_free(m_data);
+#else
+        free(m_data);
+#endif
+        m_data = nullptr;
+    }
+
+  public:
+    AlignedBuffer() = default;
+    AlignedBuffer(const AlignedBuffer &) = delete;
+    AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+
+    /**
+     * @brief Allocate a buffer.
+     *
+     * @param size Minimum size of the buffer, rounded up to the alignment.
+     * @param alignment Alignment of the buffer, a power of two.
+     * @throws std::runtime_error if the alignment is invalid or the
+     *         allocation failed.
+     */
+    AlignedBuffer(size_t size, size_t alignment = DEFAULT_DIRECT_ALIGNMENT)
+        : m_size(Detail::CheckedAlignUp(size, alignment)), m_alignment(alignment)
+    {
+#if defined(_WIN32)
+        m_data = static_cast<uint8_t *>(_aligned_malloc(m_size, alignment));
+#else
+        void *data = nullptr;
+        if (posix_memalign(&data, alignment, m_size) == 0)
+        {
+            m_data = static_cast<uint8_t *>(data);
+        }
+#endif
+        if (m_data == nullptr)
+        {
+            LEXIO_THROW(std::runtime_error("could not allocate aligned buffer"));
+        }
+    }
+
+    AlignedBuffer(AlignedBuffer &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+          m_alignment(other.m_alignment)
+    {
+    }
+
+    AlignedBuffer &operator=(AlignedBuffer &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Free();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_alignment = other.m_alignment;
+        return *this;
+    }
+
+    ~AlignedBuffer() { Free(); }
+
+    uint8_t *Data() noexcept { return m_data; }
+    const uint8_t *Data() const noexcept { return m_data; }
+    size_t Size() const noexcept { return m_size; }
+    size_t Alignment() const noexcept { return m_alignment; }
+};
+
+/**
+ * @brief A BufferedReader for files opened for direct I/O, which only ever
+ *        asks the wrapped Reader for aligned lengths into aligned memory at
+ *        aligned offsets.
+ *
+ * @detail The wrapped Reader must start at an aligned offset.  A read that
+ *         comes up short of an aligned length is taken as the end of the
+ *         file, since reading past it would be unaligned.  Seeking lands on
+ *         the aligned offset below the target and discards the difference.
+ *
+ * @tparam READER Reader type to wrap.
+ */
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+class DirectReader
+{
+    static constexpr size_t DEFAULT_ALLOC_SIZE = 1024 * 1024;
+
+    READER m_reader;
+    AlignedBuffer m_buffer;
+    size_t m_start = 0;
+    size_t m_end = 0;
+    bool m_eof = false;
+
+    size_t Alignment() const { return m_buffer.Alignment(); }
+
+  public:
+    /**
+     * @brief Constructor from existing Reader.
+     *
+     * @param reader Reader to wrap.
+     * @param bufSize Size of read buffer in bytes, rounded up to the
+     *                alignment.
+     * @param alignment Alignment of offsets, lengths, and addresses.
+     */
+    DirectReader(READER &&reader, size_t bufSize = DEFAULT_ALLOC_SIZE,
+                 size_t alignment = DEFAULT_DIRECT_ALIGNMENT)
+        : m_reader(std::move(reader)), m_buffer(Detail::CheckedAlignUp(bufSize, alignment) + alignment, alignment)
+    {
+    }
+
+    /**
+     * @brief Return underlying Reader.
+     */
+    const READER &Reader() const & { return m_reader; }
+
+    /**
+     * @brief Return the number of bytes the buffer is guaranteed to be able
+     *        to fill.  One extra block is kept for data that doesn't start
+     *        on a block boundary.
+     */
+    size_t Capacity() const { return m_buffer.Size() - Alignment(); }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        const bool aligned = reinterpret_cast<uintptr_t>(outDest) % Alignment() == 0;
+        if (m_start == m_end && !m_eof && aligned && count >= Capacity())
+        {
+            // Large aligned read, pass the aligned part straight through.
+            const size_t actual = RawRead(outDest, m_reader, Detail::AlignDown(count, Alignment()));
+            m_eof = actual % Alignment() != 0;
+            return actual;
+        }
+
+        BufferView data = LexFillBuffer(Detail::Min(count, Capacity()));
+        const size_t actualSize = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), actualSize);
+        LexConsumeBuffer(actualSize);
+        return actualSize;
+    }
+
+    BufferView LexFillBuffer(size_t count)
+    {
+        size_t size = m_end - m_start;
+        if (count <= size)
+        {
+            // We already have enough data buffered.
+            return BufferView{m_buffer.Data() + m_start, size};
+        }
+
+        if (count > Capacity())
+        {
+            LEXIO_THROW(std::runtime_error("can't fill buffer past its capacity"));
+        }
+
+        if (count > m_buffer.Size() - m_start)
+        {
+            // Compact whole blocks so the end of the data stays aligned.
+            const size_t from = Detail::AlignDown(m_start, Alignment());
+            std::memmove(m_buffer.Data(), m_buffer.Data() + from, m_end - from);
+            m_start -= from;
+            m_end -= from;
+        }
+
+        while (size < count && !m_eof)
+        {
+            const size_t actual = RawRead(m_buffer.Data() + m_end, m_reader, m_buffer.Size() - m_end);
+            if (actual == 0)
+            {
+                break;
+            }
+
+            m_end += actual;
+            size += actual;
+            m_eof = actual % Alignment() != 0;
+        }
+
+        return BufferView{m_buffer.Data() + m_start, size};
+    }
+
+    void LexConsumeBuffer(size_t count)
+    {
+        if (count > m_end - m_start)
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        m_start += count;
+        if (m_start == m_end)
+        {
+            // Buffer is empty.  The end is aligned unless we hit EOF, in which
+            // case nothing else will be read, so rewinding is always safe.
+            m_start = 0;
+            m_end = 0;
+        }
+    }
+
+    template <typename SIZE_HINT = READER, typename = std::enable_if_t<IsSizeHintV<SIZE_HINT>>>
+    size_t LexSizeHint()
+    {
+        return (m_end - m_start) + m_reader.LexSizeHint();
+    }
+
+    template <typename SIZED = READER, typename = std::enable_if_t<IsSizedV<SIZED>>>
+    size_t LexLength()
+    {
+        return m_reader.LexLength();
+    }
+
+    template <typename SEEKABLE = READER, typename = std::enable_if_t<IsSeekableV<SEEKABLE>>>
+    size_t LexSeek(const SeekPos &pos)
+    {
+        size_t target = 0;
+        if (pos.whence == Whence::current)
+        {
+            const size_t position = Tell(m_reader) - (m_end - m_start);
+            if (pos.offset < 0 && size_t(-pos.offset) > position)
+            {
+                LEXIO_THROW(std::runtime_error("seek to negative position"));
+            }
+            target = position + pos.offset;
+        }
+        else
+        {
+            target = Seek(m_reader, pos);
+        }
+
+        const size_t aligned = Detail::AlignDown(target, Alignment());
+        Seek(m_reader, aligned, Whence::start);
+        m_start = 0;
+        m_end = 0;
+        m_eof = false;
+
+        if (target != aligned)
+        {
+            // Read the block the target is in and skip up to the target.
+            const BufferView data = LexFillBuffer(target - aligned);
+            LexConsumeBuffer(Detail::Min(target - aligned, data.Size()));
+        }
+        return target;
+    }
+};
+
+namespace Detail
+{
+
+#if defined(O_DIRECT)
+
+/**
+ * @brief Puts the original status flags back on a descriptor when it goes
+ *        out of scope, even if the write in between throws.
+ */
+class FileFlagsRestorer
+{
+    int m_fd;
+    int m_flags;
+
+  public:
+    FileFlagsRestorer(int fd, int flags) : m_fd(fd), m_flags(flags) {}
+    FileFlagsRestorer(const FileFlagsRestorer &) = delete;
+    FileFlagsRestorer &operator=(const FileFlagsRestorer &) = delete;
+    ~FileFlagsRestorer() { fcntl(m_fd, F_SETFL, m_flags); }
+};
+
+#endif
+
+/**
+ * @brief Write the unaligned tail of a DirectWriter after turning off
+ *        O_DIRECT on the descriptor, which is the only way to write it
+ *        without padding the file.
+ */
+template <typename WRITER>
+inline void WriteDirectTail(WRITER &writer, const uint8_t *src, size_t count, std::true_type)
+{
+#if defined(O_DIRECT)
+    const int fd = writer.LexFileDescriptor();
+    const int flags = fd != -1 ? fcntl(fd, F_GETFL) : -1;
+    if (flags != -1 && (flags & O_DIRECT) != 0 && fcntl(fd, F_SETFL, flags & ~O_DIRECT) != -1)
+    {
+        const FileFlagsRestorer restorer{fd, flags};
+        WriteExact(writer, src, count);
+        return;
+    }
+#endif
+    WriteExact(writer, src, count);
+}
+
+/**
+ * @brief Write the unaligned tail of a DirectWriter to a Writer without a
+ *        descriptor, which has no alignment requirements we can relax.
+ */
+template <typename WRITER>
+inline void WriteDirectTail(WRITER &writer, const uint8_t *src, size_t count, std::false_type)
+{
+    WriteExact(writer, src, count);
+}
+
+} // namespace Detail
+
+/**
+ * @brief A Writer for files opened for direct I/O, which only ever hands
+ *        the wrapped Writer aligned lengths from aligned memory.
+ *
+ * @detail The wrapped Writer must start at an aligned offset.  Data that
+ *         doesn't fill a whole block stays buffered across flushes, and is
+ *         only written by Close, which turns off O_DIRECT for that last
+ *         write if the Writer exposes a file descriptor.  Nothing can be
+ *         written after Close.
+ *
+ * @tparam WRITER Writer type to wrap.
+ */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+class DirectWriter
+{
+    static constexpr size_t DEFAULT_ALLOC_SIZE = 1024 * 1024;
+
+    WRITER m_writer;
+    AlignedBuffer m_buffer;
+    size_t m_size = 0;
+    bool m_closed = false;
+
+    /**
+     * @brief Write every whole block in the buffer and move the remainder
+     *        to the front.
+     */
+    void FlushBlocks()
+    {
+        const size_t blocks = Detail::AlignDown(m_size, m_buffer.Alignment());
+        if (blocks == 0)
+        {
+            return;
+        }
+
+        WriteExact(m_writer, m_buffer.Data(), blocks);
+        std::memmove(m_buffer.Data(), m_buffer.Data() + blocks, m_size - blocks);
+        m_size -= blocks;
+    }
+
+  public:
+    /**
+     * @brief Constructor from existing Writer.
+     *
+     * @param writer Writer to wrap.
+     * @param bufSize Size of write buffer in bytes, rounded up to the
+     *                alignment.
+     * @param alignment Alignment of lengths and addresses.
+     */
+    DirectWriter(WRITER &&writer, size_t bufSize = DEFAULT_ALLOC_SIZE,
+                 size_t alignment = DEFAULT_DIRECT_ALIGNMENT)
+        : m_writer(std::move(writer)), m_buffer(bufSize, alignment)
+    {
+    }
+
+    DirectWriter(DirectWriter &&other) noexcept
+        : m_writer(std::move(other.m_writer)), m_buffer(std::move(other.m_buffer)), m_size(other.m_size),
+          m_closed(std::exchange(other.m_closed, true))
+    {
+    }
+
+    /**
+     * @brief Destructor, which closes the writer if needed.
+     */
+    ~DirectWriter()
+    {
+        if (!m_closed)
+        {
+            Close();
+        }
+    }
+
+    /**
+     * @brief Return underlying Writer.
+     */
+    const WRITER &Writer() const & { return m_writer; }
+
+    /**
+     * @brief Write everything that's buffered, including a partial block at
+     *        the end, and flush the wrapped Writer.
+     */
+    void Close()
+    {
+        if (m_closed)
+        {
+            return;
+        }
+
+        m_closed = true;
+        FlushBlocks();
+        if (m_size != 0)
+        {
+            Detail::WriteDirectTail(m_writer, m_buffer.Data(), m_size, IsFileDescriptor<WRITER>{});
+            m_size = 0;
+        }
+        Flush(m_writer);
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        if (m_closed)
+        {
+            LEXIO_THROW(std::runtime_error("can't write to a closed DirectWriter"));
+        }
+
+        size_t remain = count;
+        while (remain != 0)
+        {
+            const size_t chunk = Detail::Min(remain, m_buffer.Size() - m_size);
+            std::memcpy(m_buffer.Data() + m_size, src, chunk);
+            m_size += chunk;
+            src += chunk;
+            remain -= chunk;
+
+            if (m_size == m_buffer.Size())
+            {
+                FlushBlocks();
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Write whole blocks and flush the wrapped Writer.  A partial
+     *        block at the end stays buffered until more data or Close.
+     */
+    void LexFlush()
+    {
+        FlushBlocks();
+        Flush(m_writer);
+    }
+};
+
+} // namespace LexIO
@@ -23,8 +23,10 @@
 
 #include "./core.hpp"
 
+#include "./async.hpp"
 #include "./bufreader.hpp"
 #include "./bufwriter.hpp"
+#include "./direct.hpp"
 #include "./lib.hpp"
 #include "./serialize.hpp"
 #include "./stream.hpp"
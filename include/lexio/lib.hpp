@@ -26,6 +26,20 @@
 #include <algorithm>
 #include <memory>
 
+#if !defined(_WIN32)
+
+#include <errno.h>
+#include <system_error>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
+
+#endif
+
 namespace LexIO
 {
 
@@ -106,6 +120,84 @@ inline size_t ReadToEOF(OUT_ITER outIt, const BufferedReaderRef &bufReader)
     }
 }
 
+namespace Detail
+{
+
+/**
+ * @brief This type exists if the passed T is a resizable container of
+ *        contiguous bytes, like std::vector<uint8_t> or std::string.  A
+ *        data() that returns a pointer to bytes is what tells contiguous
+ *        containers apart from ones like std::deque.
+ */
+template <typename T>
+using ByteContainerType =
+    std::enable_if_t<sizeof(std::declval<T &>()[0]) == 1 &&
+                         std::is_pointer<decltype(std::declval<T &>().data())>::value &&
+                         sizeof(*std::declval<T &>().data()) == 1,
+                     decltype(std::declval<T &>().resize(std::declval<size_t>()), std::declval<T &>().size())>;
+
+template <typename T>
+using IsByteContainer = IsDetected<ByteContainerType, T>;
+
+} // namespace Detail
+
+/**
+ * @brief Read the entire contents of the stream, appending it directly to
+ *        the storage of a contiguous container.
+ *
+ * @detail If the reader is a SizeHint, the container is grown once to fit
+ *         the expected data and read into with as few calls as possible.
+ *
+ * @param outContainer Container to append to, such as a std::vector of
+ *                     bytes or a std::string.
+ * @param reader Reader to operate on.
+ * @return Total number of bytes read.
+ */
+template <typename CONTAINER, typename READER,
+          typename = std::enable_if_t<Detail::IsByteContainer<CONTAINER>::value && IsReaderV<READER>>>
+inline size_t ReadToEOF(CONTAINER &outContainer, READER &reader)
+{
+    constexpr size_t MIN_GROWTH = 8192;
+
+    const size_t start = outContainer.size();
+    const size_t hint = SizeHint(reader);
+
+    // Leave one byte past the hint, so an accurate hint sees EOF without
+    // having to grow the container again.
+    size_t size = start;
+    outContainer.resize(start + (hint != 0 ? hint + 1 : MIN_GROWTH));
+    for (;;)
+    {
+        if (size == outContainer.size())
+        {
+            outContainer.resize(size + Detail::Max(size / 2, MIN_GROWTH));
+        }
+
+        // Before C++17 std::string::data() is const, so go through
+        // operator[], which is writable and contiguous with data().
+        size_t count = 0;
+        LEXIO_TRY
+        {
+            count = Read(reinterpret_cast<uint8_t *>(&outContainer[0]) + size, reader, outContainer.size() - size);
+        }
+        LEXIO_CATCH_ALL
+        {
+            // Don't leave the padding behind as if it had been read.
+            outContainer.resize(size);
+            std::rethrow_exception(std::current_exception());
+        }
+
+        if (count == 0)
+        {
+            break;
+        }
+        size += count;
+    }
+
+    outContainer.resize(size);
+    return size - start;
+}
+
 /**
  * @brief Read the entire contents of the stream until we hit a terminating byte
  *        or until EOF is hit.  The output will contain the terminator as the
@@ -152,10 +244,232 @@ inline size_t ReadUntil(OUT_ITER outIt, const BufferedReaderRef &bufReader, cons
     }
 }
 
+#if !defined(_WIN32)
+
+namespace Detail
+{
+
+/**
+ * @brief Repeatedly call a kernel-side transfer function until it hits EOF
+ *        or moves everything that was asked for.
+ *
+ * @param outCount Incremented by the number of bytes transferred.
+ * @param outUnsupported Set if the transfer isn't supported for these
+ *                       descriptors and nothing was moved, in which case the
+ *                       caller should try another.
+ * @param count Maximum number of bytes to transfer.
+ * @param transfer Function that moves up to the passed number of bytes and
+ *                 returns the number moved, 0 on EOF, or -1 with errno set.
+ * @return Error from the transfer, if it failed for any other reason.
+ */
+template <typename FUNC>
+inline Error TryCopyDescriptorWith(size_t &outCount, bool &outUnsupported, size_t count, FUNC &&transfer) noexcept
+{
+    // Largest single transfer Linux will do, larger requests are truncated.
+    constexpr size_t MAX_TRANSFER = 0x7ffff000;
+
+    outUnsupported = false;
+    bool moved = false;
+    while (count != 0)
+    {
+        ssize_t moving = 0;
+        do
+        {
+            moving = transfer(Min(count, MAX_TRANSFER));
+        } while (moving == -1 && errno == EINTR);
+
+        if (moving == -1)
+        {
+            const int err = errno;
+            if (!moved && (err == EXDEV || err == EINVAL || err == ENOSYS || err == EOPNOTSUPP || err == EBADF))
+            {
+                outUnsupported = true;
+                return Error{};
+            }
+            return Error{"Could not copy file.", err};
+        }
+        else if (moving == 0)
+        {
+            // Some filesystems report nothing to copy instead of an error, so
+            // a transfer that never moved anything isn't trusted as EOF.
+            outUnsupported = !moved;
+            return Error{};
+        }
+
+        outCount += static_cast<size_t>(moving);
+        count -= static_cast<size_t>(moving);
+        moved = true;
+    }
+    return Error{};
+}
+
+/**
+ * @brief Copy from one descriptor to another until EOF or until count bytes
+ *        have been copied.
+ *
+ * @detail On Linux this tries copy_file_range first, which keeps the data
+ *         inside the kernel and can share blocks between files.  When both
+ *         cursors are used, sendfile and splice are tried next.  Anything
+ *         else is pumped through a large user-space buffer.
+ *
+ * @param outCount Number of bytes copied.
+ * @param outFd Descriptor to write to.
+ * @param outOffset Offset to write at, which is advanced past the copied
+ *                  data, or nullptr to write at the descriptor's cursor.
+ * @param inFd Descriptor to read from.
+ * @param inOffset Offset to read from, which is advanced past the copied
+ *                 data, or nullptr to read from the descriptor's cursor.
+ * @param count Maximum number of bytes to copy.
+ * @return Error from reading or writing, if any.
+ */
+inline Error TryCopyDescriptorRange(size_t &outCount, int outFd, size_t *outOffset, int inFd, size_t *inOffset,
+                                    size_t count) noexcept
+{
+    outCount = 0;
+    bool unsupported = true;
+
+#if defined(__linux__)
+#if defined(SYS_copy_file_range)
+    const Error err = TryCopyDescriptorWith(outCount, unsupported, count, [&](size_t want) {
+        loff_t in = inOffset != nullptr ? static_cast<loff_t>(*inOffset) : 0;
+        loff_t out = outOffset != nullptr ? static_cast<loff_t>(*outOffset) : 0;
+        const ssize_t copied = static_cast<ssize_t>(syscall(SYS_copy_file_range, inFd, inOffset ? &in : nullptr,
+                                                            outFd, outOffset ? &out : nullptr, want, 0));
+        if (copied > 0 && inOffset != nullptr)
+        {
+            *inOffset += static_cast<size_t>(copied);
+        }
+        if (copied > 0 && outOffset != nullptr)
+        {
+            *outOffset += static_cast<size_t>(copied);
+        }
+        return copied;
+    });
+    if (err || !unsupported)
+    {
+        return err;
+    }
+#endif
+
+    if (inOffset == nullptr && outOffset == nullptr)
+    {
+        const Error sendErr = TryCopyDescriptorWith(outCount, unsupported, count - outCount, [&](size_t want) {
+            return sendfile(outFd, inFd, nullptr, want);
+        });
+        if (sendErr || !unsupported)
+        {
+            return sendErr;
+        }
+
+#if defined(SPLICE_F_MOVE)
+        const Error spliceErr = TryCopyDescriptorWith(outCount, unsupported, count - outCount, [&](size_t want) {
+            return splice(inFd, nullptr, outFd, nullptr, want, SPLICE_F_MOVE);
+        });
+        if (spliceErr || !unsupported)
+        {
+            return spliceErr;
+        }
+#endif
+    }
+#endif
+
+    constexpr size_t BUFFER_SIZE = 128 * 1024;
+    std::unique_ptr<uint8_t[]> buffer;
+    while (outCount != count)
+    {
+        if (!buffer)
+        {
+            buffer.reset(::new uint8_t[BUFFER_SIZE]);
+        }
+
+        const size_t want = Min(count - outCount, BUFFER_SIZE);
+        ssize_t bytesRead = 0;
+        do
+        {
+            bytesRead = inOffset != nullptr ? pread(inFd, buffer.get(), want, static_cast<off_t>(*inOffset))
+                                            : read(inFd, buffer.get(), want);
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead == -1)
+        {
+            return Error{"Could not read file.", errno};
+        }
+        else if (bytesRead == 0)
+        {
+            return Error{};
+        }
+        else if (inOffset != nullptr)
+        {
+            *inOffset += static_cast<size_t>(bytesRead);
+        }
+
+        size_t written = 0;
+        while (written != static_cast<size_t>(bytesRead))
+        {
+            const uint8_t *src = buffer.get() + written;
+            const size_t left = static_cast<size_t>(bytesRead) - written;
+            const ssize_t bytesWritten = outOffset != nullptr
+                                             ? pwrite(outFd, src, left, static_cast<off_t>(*outOffset + written))
+                                             : write(outFd, src, left);
+            if (bytesWritten == -1 && errno != EINTR)
+            {
+                return Error{"Could not write file.", errno};
+            }
+            else if (bytesWritten == 0)
+            {
+                return Error{"could not write exact number of bytes"};
+            }
+            else if (bytesWritten > 0)
+            {
+                written += static_cast<size_t>(bytesWritten);
+                outCount += static_cast<size_t>(bytesWritten);
+            }
+        }
+
+        if (outOffset != nullptr)
+        {
+            *outOffset += written;
+        }
+    }
+    return Error{};
+}
+
+/**
+ * @brief Copy from one descriptor to another until EOF, starting at their
+ *        current offsets and leaving them past the copied data.
+ *
+ * @param outFd Descriptor to write to.
+ * @param inFd Descriptor to read from.
+ * @return Number of bytes copied.
+ * @throws std::system_error if reading or writing failed.
+ */
+inline size_t CopyDescriptor(int outFd, int inFd)
+{
+    size_t count = 0;
+    const Error err = TryCopyDescriptorRange(count, outFd, nullptr, inFd, nullptr, SIZE_MAX);
+    if (err.SysError() != 0)
+    {
+        LEXIO_THROW(std::system_error(err.SysError(), std::generic_category(), err.Message()));
+    }
+    else if (err)
+    {
+        LEXIO_THROW(std::runtime_error(err.Message()));
+    }
+    return count;
+}
+
+} // namespace Detail
+
+#endif
+
 /**
  * @brief Copy the contents of a buffered reader to a writer until EOF is hit
  *        on the reader.
  *
+ * @detail If both streams are FileDescriptors, the copy is done between the
+ *         descriptors once the reader's buffer is drained, which avoids
+ *         bringing the data into user space where the platform allows it.
+ *
  * @param writer Writer to copy to.
  * @param bufReader Buffered read to read from.
  * @return Number of bytes copied.
@@ -167,6 +481,18 @@ inline size_t Copy(const WriterRef &writer, const BufferedReaderRef &bufReader)
     size_t count = 0;
     for (;;)
     {
+#if !defined(_WIN32)
+        const int inFd = bufReader.LexFileDescriptor();
+        if (inFd != -1)
+        {
+            const int outFd = writer.LexFileDescriptor();
+            if (outFd != -1)
+            {
+                return count + Detail::CopyDescriptor(outFd, inFd);
+            }
+        }
+#endif
+
         const BufferView buffer = bufReader.LexFillBuffer(BUFFER_SIZE);
         if (buffer.Size() == 0)
         {
@@ -179,4 +505,43 @@ inline size_t Copy(const WriterRef &writer, const BufferedReaderRef &bufReader)
     }
 }
 
+/**
+ * @brief Copy the contents of an unbuffered reader to a writer until EOF is
+ *        hit on the reader.
+ *
+ * @detail If both streams are FileDescriptors, the copy is done between the
+ *         descriptors.  Otherwise data is pumped through a temporary buffer.
+ *
+ * @param writer Writer to copy to.
+ * @param reader Reader to read from.
+ * @return Number of bytes copied.
+ */
+inline size_t Copy(const WriterRef &writer, const UnbufferedReaderRef &reader)
+{
+#if !defined(_WIN32)
+    const int inFd = reader.LexFileDescriptor();
+    const int outFd = inFd != -1 ? writer.LexFileDescriptor() : -1;
+    if (outFd != -1)
+    {
+        return Detail::CopyDescriptor(outFd, inFd);
+    }
+#endif
+
+    constexpr size_t BUFFER_SIZE = 128 * 1024;
+    std::unique_ptr<uint8_t[]> buffer{::new uint8_t[BUFFER_SIZE]};
+
+    size_t count = 0;
+    for (;;)
+    {
+        const size_t read = Read(buffer.get(), reader, BUFFER_SIZE);
+        if (read == 0)
+        {
+            return count;
+        }
+
+        WriteExact(writer, buffer.get(), read);
+        count += read;
+    }
+}
+
 } // namespace LexIO
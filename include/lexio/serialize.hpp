@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include "./serialize/encode.hpp"
+
 #include "./serialize/int.hpp"
 #include "./serialize/tryint.hpp"
 
@@ -0,0 +1,285 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+/**
+ * @file encode.hpp
+ * @brief Fixed-width encoding functions that write into raw memory, such as
+ *        the space handed out by LexIO::Reserve.
+ */
+
+#pragma once
+
+#include "../core.hpp"
+
+#include <cstring>
+
+namespace LexIO
+{
+
+using float32_t = float;
+using float64_t = double;
+
+/**
+ * @brief Encode a uint8_t.
+ *
+ * @param outDest Destination with room for at least 1 byte.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU8(uint8_t *outDest, uint8_t value) noexcept
+{
+    outDest[0] = value;
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode an int8_t.
+ *
+ * @param outDest Destination with room for at least 1 byte.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode8(uint8_t *outDest, int8_t value) noexcept
+{
+    outDest[0] = uint8_t(value);
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a little-endian uint16_t.
+ *
+ * @param outDest Destination with room for at least 2 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU16LE(uint8_t *outDest, uint16_t value) noexcept
+{
+    value = LEXIO_IF_BE_BSWAP16(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a big-endian uint16_t.
+ *
+ * @param outDest Destination with room for at least 2 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU16BE(uint8_t *outDest, uint16_t value) noexcept
+{
+    value = LEXIO_IF_LE_BSWAP16(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a little-endian int16_t.
+ *
+ * @param outDest Destination with room for at least 2 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode16LE(uint8_t *outDest, int16_t value) noexcept
+{
+    uint16_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU16LE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a big-endian int16_t.
+ *
+ * @param outDest Destination with room for at least 2 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode16BE(uint8_t *outDest, int16_t value) noexcept
+{
+    uint16_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU16BE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a little-endian uint32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU32LE(uint8_t *outDest, uint32_t value) noexcept
+{
+    value = LEXIO_IF_BE_BSWAP32(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a big-endian uint32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU32BE(uint8_t *outDest, uint32_t value) noexcept
+{
+    value = LEXIO_IF_LE_BSWAP32(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a little-endian int32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode32LE(uint8_t *outDest, int32_t value) noexcept
+{
+    uint32_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU32LE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a big-endian int32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode32BE(uint8_t *outDest, int32_t value) noexcept
+{
+    uint32_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU32BE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a little-endian uint64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU64LE(uint8_t *outDest, uint64_t value) noexcept
+{
+    value = LEXIO_IF_BE_BSWAP64(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a big-endian uint64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeU64BE(uint8_t *outDest, uint64_t value) noexcept
+{
+    value = LEXIO_IF_LE_BSWAP64(value);
+    std::memcpy(outDest, &value, sizeof(value));
+    return outDest + sizeof(value);
+}
+
+/**
+ * @brief Encode a little-endian int64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode64LE(uint8_t *outDest, int64_t value) noexcept
+{
+    uint64_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU64LE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a big-endian int64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *Encode64BE(uint8_t *outDest, int64_t value) noexcept
+{
+    uint64_t uvalue;
+    std::memcpy(&uvalue, &value, sizeof(uvalue));
+    return EncodeU64BE(outDest, uvalue);
+}
+
+/**
+ * @brief Encode a little-endian float32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeFloat32LE(uint8_t *outDest, float32_t value) noexcept
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return EncodeU32LE(outDest, bits);
+}
+
+/**
+ * @brief Encode a big-endian float32_t.
+ *
+ * @param outDest Destination with room for at least 4 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeFloat32BE(uint8_t *outDest, float32_t value) noexcept
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return EncodeU32BE(outDest, bits);
+}
+
+/**
+ * @brief Encode a little-endian float64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeFloat64LE(uint8_t *outDest, float64_t value) noexcept
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return EncodeU64LE(outDest, bits);
+}
+
+/**
+ * @brief Encode a big-endian float64_t.
+ *
+ * @param outDest Destination with room for at least 8 bytes.
+ * @param value Value to encode.
+ * @return Pointer just past the encoded bytes.
+ */
+inline uint8_t *EncodeFloat64BE(uint8_t *outDest, float64_t value) noexcept
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return EncodeU64BE(outDest, bits);
+}
+
+} // namespace LexIO
@@ -34,11 +34,12 @@ namespace LexIO
  * @return Float that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline float32_t ReadFloat32LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline float32_t ReadFloat32LE(READER &reader)
 {
     float32_t out = 0;
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -47,6 +48,14 @@ inline float32_t ReadFloat32LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadFloat32LE.
+ */
+inline float32_t ReadFloat32LE(const ReaderRef &reader)
+{
+    return ReadFloat32LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian float32_t from a stream.
  *
@@ -54,11 +63,12 @@ inline float32_t ReadFloat32LE(const ReaderRef &reader)
  * @return Float that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline float32_t ReadFloat32BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline float32_t ReadFloat32BE(READER &reader)
 {
     float32_t out = 0;
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -67,6 +77,14 @@ inline float32_t ReadFloat32BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadFloat32BE.
+ */
+inline float32_t ReadFloat32BE(const ReaderRef &reader)
+{
+    return ReadFloat32BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian float32_t to a stream.
  *
@@ -74,16 +92,18 @@ inline float32_t ReadFloat32BE(const ReaderRef &reader)
  * @param value Float to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteFloat32LE(const WriterRef &writer, float32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteFloat32LE(WRITER &writer, float32_t value)
 {
-    uint32_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_BE_BSWAP32(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat32LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteFloat32LE.
+ */
+inline void WriteFloat32LE(const WriterRef &writer, float32_t value)
+{
+    WriteFloat32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -93,16 +113,18 @@ inline void WriteFloat32LE(const WriterRef &writer, float32_t value)
  * @param value Float to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteFloat32BE(const WriterRef &writer, float32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteFloat32BE(WRITER &writer, float32_t value)
 {
-    uint32_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_LE_BSWAP32(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat32BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteFloat32BE.
+ */
+inline void WriteFloat32BE(const WriterRef &writer, float32_t value)
+{
+    WriteFloat32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -114,11 +136,12 @@ inline void WriteFloat32BE(const WriterRef &writer, float32_t value)
  * @return Float that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline float64_t ReadFloat64LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline float64_t ReadFloat64LE(READER &reader)
 {
     float64_t out = 0;
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -127,6 +150,14 @@ inline float64_t ReadFloat64LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadFloat64LE.
+ */
+inline float64_t ReadFloat64LE(const ReaderRef &reader)
+{
+    return ReadFloat64LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian float64_t from a stream.
  *
@@ -134,11 +165,12 @@ inline float64_t ReadFloat64LE(const ReaderRef &reader)
  * @return Float that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline float64_t ReadFloat64BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline float64_t ReadFloat64BE(READER &reader)
 {
     float64_t out = 0;
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -147,6 +179,14 @@ inline float64_t ReadFloat64BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadFloat64BE.
+ */
+inline float64_t ReadFloat64BE(const ReaderRef &reader)
+{
+    return ReadFloat64BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian float64_t to a stream.
  *
@@ -154,16 +194,18 @@ inline float64_t ReadFloat64BE(const ReaderRef &reader)
  * @param value Float to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteFloat64LE(const WriterRef &writer, float64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteFloat64LE(WRITER &writer, float64_t value)
 {
-    uint64_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_BE_BSWAP64(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat64LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteFloat64LE.
+ */
+inline void WriteFloat64LE(const WriterRef &writer, float64_t value)
+{
+    WriteFloat64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -173,16 +215,18 @@ inline void WriteFloat64LE(const WriterRef &writer, float64_t value)
  * @param value Float to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteFloat64BE(const WriterRef &writer, float64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteFloat64BE(WRITER &writer, float64_t value)
 {
-    uint64_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_LE_BSWAP64(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat64BE(outDest, value); });
+}
 
-    return WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteFloat64BE.
+ */
+inline void WriteFloat64BE(const WriterRef &writer, float64_t value)
+{
+    WriteFloat64BE<const WriterRef>(writer, value);
 }
 
 } // namespace LexIO
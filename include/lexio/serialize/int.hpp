@@ -37,13 +37,22 @@ namespace LexIO
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint8_t ReadU8(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint8_t ReadU8(READER &reader)
 {
     uint8_t buf[sizeof(uint8_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
     return buf[0];
 }
 
+/**
+ * @brief Type-erased overload of ReadU8.
+ */
+inline uint8_t ReadU8(const ReaderRef &reader)
+{
+    return ReadU8<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a uint8_t to a stream.
  *
@@ -51,10 +60,18 @@ inline uint8_t ReadU8(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU8(WRITER &writer, uint8_t value)
+{
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU8(outDest, value); });
+}
+
+/**
+ * @brief Type-erased overload of WriteU8.
+ */
 inline void WriteU8(const WriterRef &writer, uint8_t value)
 {
-    const uint8_t buf[sizeof(uint8_t)] = {value};
-    WriteExact(writer, buf, sizeof(buf));
+    WriteU8<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -66,13 +83,22 @@ inline void WriteU8(const WriterRef &writer, uint8_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int8_t Read8(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int8_t Read8(READER &reader)
 {
     uint8_t buf[sizeof(uint8_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
     return int8_t(buf[0]);
 }
 
+/**
+ * @brief Type-erased overload of Read8.
+ */
+inline int8_t Read8(const ReaderRef &reader)
+{
+    return Read8<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a int8_t to a stream.
  *
@@ -80,10 +106,18 @@ inline int8_t Read8(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write8(WRITER &writer, int8_t value)
+{
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode8(outDest, value); });
+}
+
+/**
+ * @brief Type-erased overload of Write8.
+ */
 inline void Write8(const WriterRef &writer, int8_t value)
 {
-    const uint8_t buf[sizeof(uint8_t)] = {uint8_t(value)};
-    WriteExact(writer, buf, sizeof(buf));
+    Write8<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -95,10 +129,11 @@ inline void Write8(const WriterRef &writer, int8_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint16_t ReadU16LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint16_t ReadU16LE(READER &reader)
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint16_t out;
     std::memcpy(&out, buf, sizeof(uint16_t));
@@ -106,6 +141,14 @@ inline uint16_t ReadU16LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU16LE.
+ */
+inline uint16_t ReadU16LE(const ReaderRef &reader)
+{
+    return ReadU16LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian uint16_t from a stream.
  *
@@ -113,10 +156,11 @@ inline uint16_t ReadU16LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint16_t ReadU16BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint16_t ReadU16BE(READER &reader)
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint16_t out;
     std::memcpy(&out, buf, sizeof(out));
@@ -124,6 +168,14 @@ inline uint16_t ReadU16BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU16BE.
+ */
+inline uint16_t ReadU16BE(const ReaderRef &reader)
+{
+    return ReadU16BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian uint16_t to a stream.
  *
@@ -131,13 +183,18 @@ inline uint16_t ReadU16BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU16LE(const WriterRef &writer, uint16_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU16LE(WRITER &writer, uint16_t value)
 {
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP16(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU16LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU16LE.
+ */
+inline void WriteU16LE(const WriterRef &writer, uint16_t value)
+{
+    WriteU16LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -147,13 +204,18 @@ inline void WriteU16LE(const WriterRef &writer, uint16_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU16BE(const WriterRef &writer, uint16_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU16BE(WRITER &writer, uint16_t value)
 {
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP16(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU16BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU16BE.
+ */
+inline void WriteU16BE(const WriterRef &writer, uint16_t value)
+{
+    WriteU16BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -165,10 +227,11 @@ inline void WriteU16BE(const WriterRef &writer, uint16_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int16_t Read16LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int16_t Read16LE(READER &reader)
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint16_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -179,6 +242,14 @@ inline int16_t Read16LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read16LE.
+ */
+inline int16_t Read16LE(const ReaderRef &reader)
+{
+    return Read16LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian int16_t from a stream.
  *
@@ -186,10 +257,11 @@ inline int16_t Read16LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int16_t Read16BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int16_t Read16BE(READER &reader)
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint16_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -200,6 +272,14 @@ inline int16_t Read16BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read16BE.
+ */
+inline int16_t Read16BE(const ReaderRef &reader)
+{
+    return Read16BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian int16_t to a stream.
  *
@@ -207,16 +287,18 @@ inline int16_t Read16BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write16LE(const WriterRef &writer, int16_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write16LE(WRITER &writer, int16_t value)
 {
-    uint16_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP16(uvalue);
-
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode16LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write16LE.
+ */
+inline void Write16LE(const WriterRef &writer, int16_t value)
+{
+    Write16LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -226,16 +308,18 @@ inline void Write16LE(const WriterRef &writer, int16_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write16BE(const WriterRef &writer, int16_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write16BE(WRITER &writer, int16_t value)
 {
-    uint16_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP16(uvalue);
-
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode16BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write16BE.
+ */
+inline void Write16BE(const WriterRef &writer, int16_t value)
+{
+    Write16BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -247,10 +331,11 @@ inline void Write16BE(const WriterRef &writer, int16_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint32_t ReadU32LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint32_t ReadU32LE(READER &reader)
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t out;
     std::memcpy(&out, buf, sizeof(out));
@@ -258,6 +343,14 @@ inline uint32_t ReadU32LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU32LE.
+ */
+inline uint32_t ReadU32LE(const ReaderRef &reader)
+{
+    return ReadU32LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian uint32_t from a stream.
  *
@@ -265,10 +358,11 @@ inline uint32_t ReadU32LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint32_t ReadU32BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint32_t ReadU32BE(READER &reader)
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t out;
     std::memcpy(&out, buf, sizeof(out));
@@ -276,6 +370,14 @@ inline uint32_t ReadU32BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU32BE.
+ */
+inline uint32_t ReadU32BE(const ReaderRef &reader)
+{
+    return ReadU32BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian uint32_t to a stream.
  *
@@ -283,13 +385,18 @@ inline uint32_t ReadU32BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU32LE(const WriterRef &writer, uint32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU32LE(WRITER &writer, uint32_t value)
 {
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP32(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU32LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU32LE.
+ */
+inline void WriteU32LE(const WriterRef &writer, uint32_t value)
+{
+    WriteU32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -299,13 +406,18 @@ inline void WriteU32LE(const WriterRef &writer, uint32_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU32BE(const WriterRef &writer, uint32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU32BE(WRITER &writer, uint32_t value)
 {
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP32(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU32BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU32BE.
+ */
+inline void WriteU32BE(const WriterRef &writer, uint32_t value)
+{
+    WriteU32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -317,10 +429,11 @@ inline void WriteU32BE(const WriterRef &writer, uint32_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int32_t Read32LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int32_t Read32LE(READER &reader)
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -331,6 +444,14 @@ inline int32_t Read32LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read32LE.
+ */
+inline int32_t Read32LE(const ReaderRef &reader)
+{
+    return Read32LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian int32_t from a stream.
  *
@@ -338,10 +459,11 @@ inline int32_t Read32LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int32_t Read32BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int32_t Read32BE(READER &reader)
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint32_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -352,6 +474,14 @@ inline int32_t Read32BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read32BE.
+ */
+inline int32_t Read32BE(const ReaderRef &reader)
+{
+    return Read32BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian int32_t to a stream.
  *
@@ -359,16 +489,18 @@ inline int32_t Read32BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write32LE(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write32LE(WRITER &writer, int32_t value)
 {
-    uint32_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP32(uvalue);
-
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode32LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write32LE.
+ */
+inline void Write32LE(const WriterRef &writer, int32_t value)
+{
+    Write32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -378,16 +510,18 @@ inline void Write32LE(const WriterRef &writer, int32_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write32BE(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write32BE(WRITER &writer, int32_t value)
 {
-    uint32_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP32(uvalue);
-
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode32BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write32BE.
+ */
+inline void Write32BE(const WriterRef &writer, int32_t value)
+{
+    Write32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -399,10 +533,11 @@ inline void Write32BE(const WriterRef &writer, int32_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint64_t ReadU64LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint64_t ReadU64LE(READER &reader)
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t out;
     std::memcpy(&out, buf, sizeof(out));
@@ -410,6 +545,14 @@ inline uint64_t ReadU64LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU64LE.
+ */
+inline uint64_t ReadU64LE(const ReaderRef &reader)
+{
+    return ReadU64LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian uint64_t from a stream.
  *
@@ -417,10 +560,11 @@ inline uint64_t ReadU64LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline uint64_t ReadU64BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint64_t ReadU64BE(READER &reader)
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t out;
     std::memcpy(&out, buf, sizeof(out));
@@ -428,6 +572,14 @@ inline uint64_t ReadU64BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of ReadU64BE.
+ */
+inline uint64_t ReadU64BE(const ReaderRef &reader)
+{
+    return ReadU64BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian uint64_t to a stream.
  *
@@ -435,13 +587,18 @@ inline uint64_t ReadU64BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU64LE(const WriterRef &writer, uint64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU64LE(WRITER &writer, uint64_t value)
 {
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP64(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU64LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU64LE.
+ */
+inline void WriteU64LE(const WriterRef &writer, uint64_t value)
+{
+    WriteU64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -451,13 +608,18 @@ inline void WriteU64LE(const WriterRef &writer, uint64_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void WriteU64BE(const WriterRef &writer, uint64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteU64BE(WRITER &writer, uint64_t value)
 {
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP64(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU64BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of WriteU64BE.
+ */
+inline void WriteU64BE(const WriterRef &writer, uint64_t value)
+{
+    WriteU64BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -469,10 +631,11 @@ inline void WriteU64BE(const WriterRef &writer, uint64_t value)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int64_t Read64LE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int64_t Read64LE(READER &reader)
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -483,6 +646,14 @@ inline int64_t Read64LE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read64LE.
+ */
+inline int64_t Read64LE(const ReaderRef &reader)
+{
+    return Read64LE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Read a big-endian int64_t from a stream.
  *
@@ -490,10 +661,11 @@ inline int64_t Read64LE(const ReaderRef &reader)
  * @return Integer that was read.
  * @throws std::runtime_error if stream could not be read.
  */
-inline int64_t Read64BE(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int64_t Read64BE(READER &reader)
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    ReadExact(buf, reader);
+    Detail::LoadExact(buf, reader);
 
     uint64_t bits = 0;
     std::memcpy(&bits, buf, sizeof(bits));
@@ -504,6 +676,14 @@ inline int64_t Read64BE(const ReaderRef &reader)
     return out;
 }
 
+/**
+ * @brief Type-erased overload of Read64BE.
+ */
+inline int64_t Read64BE(const ReaderRef &reader)
+{
+    return Read64BE<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a little-endian int64_t to a stream.
  *
@@ -511,16 +691,18 @@ inline int64_t Read64BE(const ReaderRef &reader)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write64LE(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write64LE(WRITER &writer, int64_t value)
 {
-    uint64_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP64(uvalue);
-
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode64LE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write64LE.
+ */
+inline void Write64LE(const WriterRef &writer, int64_t value)
+{
+    Write64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -530,16 +712,18 @@ inline void Write64LE(const WriterRef &writer, int64_t value)
  * @param value Integer to write.
  * @throws std::runtime_error if stream could not be written.
  */
-inline void Write64BE(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void Write64BE(WRITER &writer, int64_t value)
 {
-    uint64_t uvalue;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP64(uvalue);
-
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    Detail::StoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode64BE(outDest, value); });
+}
 
-    WriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of Write64BE.
+ */
+inline void Write64BE(const WriterRef &writer, int64_t value)
+{
+    Write64BE<const WriterRef>(writer, value);
 }
 
 } // namespace LexIO
@@ -26,9 +26,6 @@
 namespace LexIO
 {
 
-using float32_t = float;
-using float64_t = double;
-
 /**
  * @brief Try to read a little-endian float32_t from a stream.
  *
@@ -36,10 +33,11 @@ using float64_t = double;
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadFloat32LE(float32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadFloat32LE(float32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -51,6 +49,14 @@ inline bool TryReadFloat32LE(float32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadFloat32LE.
+ */
+inline bool TryReadFloat32LE(float32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadFloat32LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian float32_t from a stream.
  *
@@ -58,10 +64,11 @@ inline bool TryReadFloat32LE(float32_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadFloat32BE(float32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadFloat32BE(float32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -73,6 +80,14 @@ inline bool TryReadFloat32BE(float32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadFloat32BE.
+ */
+inline bool TryReadFloat32BE(float32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadFloat32BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian float32_t to a stream.
  *
@@ -80,16 +95,18 @@ inline bool TryReadFloat32BE(float32_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteFloat32LE(const WriterRef &writer, float32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteFloat32LE(WRITER &writer, float32_t value) noexcept
 {
-    uint32_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_BE_BSWAP32(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat32LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteFloat32LE.
+ */
+inline bool TryWriteFloat32LE(const WriterRef &writer, float32_t value) noexcept
+{
+    return TryWriteFloat32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -99,16 +116,18 @@ inline bool TryWriteFloat32LE(const WriterRef &writer, float32_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteFloat32BE(const WriterRef &writer, float32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteFloat32BE(WRITER &writer, float32_t value) noexcept
 {
-    uint32_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_LE_BSWAP32(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat32BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteFloat32BE.
+ */
+inline bool TryWriteFloat32BE(const WriterRef &writer, float32_t value) noexcept
+{
+    return TryWriteFloat32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -120,10 +139,11 @@ inline bool TryWriteFloat32BE(const WriterRef &writer, float32_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadFloat64LE(float64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadFloat64LE(float64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -135,6 +155,14 @@ inline bool TryReadFloat64LE(float64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadFloat64LE.
+ */
+inline bool TryReadFloat64LE(float64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadFloat64LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian float64_t from a stream.
  *
@@ -142,10 +170,11 @@ inline bool TryReadFloat64LE(float64_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadFloat64BE(float64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadFloat64BE(float64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -157,6 +186,14 @@ inline bool TryReadFloat64BE(float64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadFloat64BE.
+ */
+inline bool TryReadFloat64BE(float64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadFloat64BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian float64_t to a stream.
  *
@@ -164,16 +201,18 @@ inline bool TryReadFloat64BE(float64_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteFloat64LE(const WriterRef &writer, float64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteFloat64LE(WRITER &writer, float64_t value) noexcept
 {
-    uint64_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_BE_BSWAP64(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat64LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteFloat64LE.
+ */
+inline bool TryWriteFloat64LE(const WriterRef &writer, float64_t value) noexcept
+{
+    return TryWriteFloat64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -183,16 +222,18 @@ inline bool TryWriteFloat64LE(const WriterRef &writer, float64_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteFloat64BE(const WriterRef &writer, float64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteFloat64BE(WRITER &writer, float64_t value) noexcept
 {
-    uint64_t bits = 0;
-    std::memcpy(&bits, &value, sizeof(bits));
-
-    uint8_t buf[sizeof(bits)] = {0};
-    bits = LEXIO_IF_LE_BSWAP64(bits);
-    std::memcpy(buf, &bits, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeFloat64BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteFloat64BE.
+ */
+inline bool TryWriteFloat64BE(const WriterRef &writer, float64_t value) noexcept
+{
+    return TryWriteFloat64BE<const WriterRef>(writer, value);
 }
 
 } // namespace LexIO
@@ -23,6 +23,8 @@
 
 #include "../try.hpp"
 
+#include "./encode.hpp"
+
 #include <cstring>
 
 namespace LexIO
@@ -37,10 +39,11 @@ namespace LexIO
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU8(uint8_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU8(uint8_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint8_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -48,6 +51,14 @@ inline bool TryReadU8(uint8_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU8.
+ */
+inline bool TryReadU8(uint8_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU8<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a uint8_t to a stream.
  *
@@ -55,10 +66,18 @@ inline bool TryReadU8(uint8_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU8(WRITER &writer, uint8_t value) noexcept
+{
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU8(outDest, value); });
+}
+
+/**
+ * @brief Type-erased overload of TryWriteU8.
+ */
 inline bool TryWriteU8(const WriterRef &writer, uint8_t value) noexcept
 {
-    const uint8_t buf[sizeof(uint8_t)] = {value};
-    return TryWriteExact(writer, buf, sizeof(buf));
+    return TryWriteU8<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -70,10 +89,11 @@ inline bool TryWriteU8(const WriterRef &writer, uint8_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead8(int8_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead8(int8_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint8_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -81,6 +101,14 @@ inline bool TryRead8(int8_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead8.
+ */
+inline bool TryRead8(int8_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead8<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a int8_t to a stream.
  *
@@ -88,10 +116,18 @@ inline bool TryRead8(int8_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite8(WRITER &writer, int8_t value) noexcept
+{
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode8(outDest, value); });
+}
+
+/**
+ * @brief Type-erased overload of TryWrite8.
+ */
 inline bool TryWrite8(const WriterRef &writer, int8_t value) noexcept
 {
-    const uint8_t buf[sizeof(uint8_t)] = {uint8_t(value)};
-    return TryWriteExact(writer, buf, sizeof(buf));
+    return TryWrite8<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -103,10 +139,11 @@ inline bool TryWrite8(const WriterRef &writer, int8_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU16LE(uint16_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU16LE(uint16_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -116,6 +153,14 @@ inline bool TryReadU16LE(uint16_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU16LE.
+ */
+inline bool TryReadU16LE(uint16_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU16LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian uint16_t from a stream.
  *
@@ -123,10 +168,11 @@ inline bool TryReadU16LE(uint16_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU16BE(uint16_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU16BE(uint16_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -136,6 +182,14 @@ inline bool TryReadU16BE(uint16_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU16BE.
+ */
+inline bool TryReadU16BE(uint16_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU16BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian uint16_t to a stream.
  *
@@ -143,13 +197,18 @@ inline bool TryReadU16BE(uint16_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU16LE(const WriterRef &writer, uint16_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU16LE(WRITER &writer, uint16_t value) noexcept
 {
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP16(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU16LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU16LE.
+ */
+inline bool TryWriteU16LE(const WriterRef &writer, uint16_t value) noexcept
+{
+    return TryWriteU16LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -159,13 +218,18 @@ inline bool TryWriteU16LE(const WriterRef &writer, uint16_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU16BE(const WriterRef &writer, uint16_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU16BE(WRITER &writer, uint16_t value) noexcept
 {
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP16(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU16BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU16BE.
+ */
+inline bool TryWriteU16BE(const WriterRef &writer, uint16_t value) noexcept
+{
+    return TryWriteU16BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -177,10 +241,11 @@ inline bool TryWriteU16BE(const WriterRef &writer, uint16_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead16LE(int16_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead16LE(int16_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -192,6 +257,14 @@ inline bool TryRead16LE(int16_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead16LE.
+ */
+inline bool TryRead16LE(int16_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead16LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian int16_t from a stream.
  *
@@ -199,10 +272,11 @@ inline bool TryRead16LE(int16_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead16BE(int16_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead16BE(int16_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint16_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -214,6 +288,14 @@ inline bool TryRead16BE(int16_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead16BE.
+ */
+inline bool TryRead16BE(int16_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead16BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian int16_t to a stream.
  *
@@ -221,16 +303,18 @@ inline bool TryRead16BE(int16_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite16LE(const WriterRef &writer, int16_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite16LE(WRITER &writer, int16_t value) noexcept
 {
-    uint16_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP16(uvalue);
-
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode16LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite16LE.
+ */
+inline bool TryWrite16LE(const WriterRef &writer, int16_t value) noexcept
+{
+    return TryWrite16LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -240,16 +324,18 @@ inline bool TryWrite16LE(const WriterRef &writer, int16_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite16BE(const WriterRef &writer, int16_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite16BE(WRITER &writer, int16_t value) noexcept
 {
-    uint16_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP16(uvalue);
-
-    uint8_t buf[sizeof(uint16_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode16BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite16BE.
+ */
+inline bool TryWrite16BE(const WriterRef &writer, int16_t value) noexcept
+{
+    return TryWrite16BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -261,10 +347,11 @@ inline bool TryWrite16BE(const WriterRef &writer, int16_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU32LE(uint32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU32LE(uint32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -274,6 +361,14 @@ inline bool TryReadU32LE(uint32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU32LE.
+ */
+inline bool TryReadU32LE(uint32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU32LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian uint32_t from a stream.
  *
@@ -281,10 +376,11 @@ inline bool TryReadU32LE(uint32_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU32BE(uint32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU32BE(uint32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -294,6 +390,14 @@ inline bool TryReadU32BE(uint32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU32BE.
+ */
+inline bool TryReadU32BE(uint32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU32BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian uint32_t to a stream.
  *
@@ -301,13 +405,18 @@ inline bool TryReadU32BE(uint32_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU32LE(const WriterRef &writer, uint32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU32LE(WRITER &writer, uint32_t value) noexcept
 {
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP32(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU32LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU32LE.
+ */
+inline bool TryWriteU32LE(const WriterRef &writer, uint32_t value) noexcept
+{
+    return TryWriteU32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -317,13 +426,18 @@ inline bool TryWriteU32LE(const WriterRef &writer, uint32_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU32BE(const WriterRef &writer, uint32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU32BE(WRITER &writer, uint32_t value) noexcept
 {
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP32(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU32BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU32BE.
+ */
+inline bool TryWriteU32BE(const WriterRef &writer, uint32_t value) noexcept
+{
+    return TryWriteU32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -335,10 +449,11 @@ inline bool TryWriteU32BE(const WriterRef &writer, uint32_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead32LE(int32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead32LE(int32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -350,6 +465,14 @@ inline bool TryRead32LE(int32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead32LE.
+ */
+inline bool TryRead32LE(int32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead32LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian int32_t from a stream.
  *
@@ -357,10 +480,11 @@ inline bool TryRead32LE(int32_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead32BE(int32_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead32BE(int32_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint32_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -372,6 +496,14 @@ inline bool TryRead32BE(int32_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead32BE.
+ */
+inline bool TryRead32BE(int32_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead32BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian int32_t to a stream.
  *
@@ -379,16 +511,18 @@ inline bool TryRead32BE(int32_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite32LE(const WriterRef &writer, int32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite32LE(WRITER &writer, int32_t value) noexcept
 {
-    uint32_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP32(uvalue);
-
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode32LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite32LE.
+ */
+inline bool TryWrite32LE(const WriterRef &writer, int32_t value) noexcept
+{
+    return TryWrite32LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -398,16 +532,18 @@ inline bool TryWrite32LE(const WriterRef &writer, int32_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite32BE(const WriterRef &writer, int32_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite32BE(WRITER &writer, int32_t value) noexcept
 {
-    uint32_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP32(uvalue);
-
-    uint8_t buf[sizeof(uint32_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode32BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite32BE.
+ */
+inline bool TryWrite32BE(const WriterRef &writer, int32_t value) noexcept
+{
+    return TryWrite32BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -419,10 +555,11 @@ inline bool TryWrite32BE(const WriterRef &writer, int32_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU64LE(uint64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU64LE(uint64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -432,6 +569,14 @@ inline bool TryReadU64LE(uint64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU64LE.
+ */
+inline bool TryReadU64LE(uint64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU64LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian uint64_t from a stream.
  *
@@ -439,10 +584,11 @@ inline bool TryReadU64LE(uint64_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadU64BE(uint64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadU64BE(uint64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -452,6 +598,14 @@ inline bool TryReadU64BE(uint64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadU64BE.
+ */
+inline bool TryReadU64BE(uint64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryReadU64BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian uint64_t to a stream.
  *
@@ -459,13 +613,18 @@ inline bool TryReadU64BE(uint64_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU64LE(const WriterRef &writer, uint64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU64LE(WRITER &writer, uint64_t value) noexcept
 {
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    value = LEXIO_IF_BE_BSWAP64(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU64LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU64LE.
+ */
+inline bool TryWriteU64LE(const WriterRef &writer, uint64_t value) noexcept
+{
+    return TryWriteU64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -475,13 +634,18 @@ inline bool TryWriteU64LE(const WriterRef &writer, uint64_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteU64BE(const WriterRef &writer, uint64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteU64BE(WRITER &writer, uint64_t value) noexcept
 {
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    value = LEXIO_IF_LE_BSWAP64(value);
-    std::memcpy(buf, &value, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { EncodeU64BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWriteU64BE.
+ */
+inline bool TryWriteU64BE(const WriterRef &writer, uint64_t value) noexcept
+{
+    return TryWriteU64BE<const WriterRef>(writer, value);
 }
 
 //******************************************************************************
@@ -493,10 +657,11 @@ inline bool TryWriteU64BE(const WriterRef &writer, uint64_t value) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead64LE(int64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead64LE(int64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -508,6 +673,14 @@ inline bool TryRead64LE(int64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead64LE.
+ */
+inline bool TryRead64LE(int64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead64LE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to read a big-endian int64_t from a stream.
  *
@@ -515,10 +688,11 @@ inline bool TryRead64LE(int64_t &out, const ReaderRef &reader) noexcept
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryRead64BE(int64_t &out, const ReaderRef &reader) noexcept
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryRead64BE(int64_t &out, READER &reader) noexcept
 {
     uint8_t buf[sizeof(uint64_t)] = {0};
-    if (!TryReadExact(buf, reader))
+    if (!Detail::TryLoadExact(buf, reader))
     {
         return false;
     }
@@ -530,6 +704,14 @@ inline bool TryRead64BE(int64_t &out, const ReaderRef &reader) noexcept
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryRead64BE.
+ */
+inline bool TryRead64BE(int64_t &out, const ReaderRef &reader) noexcept
+{
+    return TryRead64BE<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a little-endian int64_t to a stream.
  *
@@ -537,16 +719,18 @@ inline bool TryRead64BE(int64_t &out, const ReaderRef &reader) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite64LE(const WriterRef &writer, int64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite64LE(WRITER &writer, int64_t value) noexcept
 {
-    uint64_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_BE_BSWAP64(uvalue);
-
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode64LE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite64LE.
+ */
+inline bool TryWrite64LE(const WriterRef &writer, int64_t value) noexcept
+{
+    return TryWrite64LE<const WriterRef>(writer, value);
 }
 
 /**
@@ -556,16 +740,18 @@ inline bool TryWrite64LE(const WriterRef &writer, int64_t value) noexcept
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWrite64BE(const WriterRef &writer, int64_t value) noexcept
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWrite64BE(WRITER &writer, int64_t value) noexcept
 {
-    uint64_t uvalue = 0;
-    std::memcpy(&uvalue, &value, sizeof(uvalue));
-    uvalue = LEXIO_IF_LE_BSWAP64(uvalue);
-
-    uint8_t buf[sizeof(uint64_t)] = {0};
-    std::memcpy(buf, &uvalue, sizeof(buf));
+    return Detail::TryStoreExact<sizeof(value)>(writer, [value](uint8_t *outDest) { Encode64BE(outDest, value); });
+}
 
-    return TryWriteExact(writer, buf, sizeof(buf));
+/**
+ * @brief Type-erased overload of TryWrite64BE.
+ */
+inline bool TryWrite64BE(const WriterRef &writer, int64_t value) noexcept
+{
+    return TryWrite64BE<const WriterRef>(writer, value);
 }
 
 } // namespace LexIO
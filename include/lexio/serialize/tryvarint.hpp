@@ -36,7 +36,8 @@ namespace LexIO
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadUVarint32(uint32_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadUVarint32(uint32_t &out, READER &reader)
 {
     constexpr int MAX_BYTES = 5;
     uint32_t rvo = 0;
@@ -65,6 +66,14 @@ inline bool TryReadUVarint32(uint32_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadUVarint32.
+ */
+inline bool TryReadUVarint32(uint32_t &out, const ReaderRef &reader)
+{
+    return TryReadUVarint32<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a uint32_t to a stream as a varint.
  *
@@ -72,7 +81,8 @@ inline bool TryReadUVarint32(uint32_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteUVarint32(const WriterRef &writer, uint32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteUVarint32(WRITER &writer, uint32_t value)
 {
     uint32_t v = value;
     while (v >= 0x80)
@@ -86,6 +96,14 @@ inline bool TryWriteUVarint32(const WriterRef &writer, uint32_t value)
     return TryWriteU8(writer, static_cast<uint8_t>(v));
 }
 
+/**
+ * @brief Type-erased overload of TryWriteUVarint32.
+ */
+inline bool TryWriteUVarint32(const WriterRef &writer, uint32_t value)
+{
+    return TryWriteUVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an uint32_t as a varint.
  */
@@ -111,7 +129,8 @@ constexpr size_t UVarint32Bytes(uint32_t value)
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadVarint32(int32_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadVarint32(int32_t &out, READER &reader)
 {
     uint32_t outVal = 0;
     if (!TryReadUVarint32(outVal, reader))
@@ -122,6 +141,14 @@ inline bool TryReadVarint32(int32_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadVarint32.
+ */
+inline bool TryReadVarint32(int32_t &out, const ReaderRef &reader)
+{
+    return TryReadVarint32<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a int32_t to a stream as a varint.  Negative values
  *        are encoded as large positive integers.
@@ -130,11 +157,20 @@ inline bool TryReadVarint32(int32_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteVarint32(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteVarint32(WRITER &writer, int32_t value)
 {
     return TryWriteUVarint32(writer, static_cast<uint32_t>(value));
 }
 
+/**
+ * @brief Type-erased overload of TryWriteVarint32.
+ */
+inline bool TryWriteVarint32(const WriterRef &writer, int32_t value)
+{
+    return TryWriteVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an int32_t as a varint.
  */
@@ -160,7 +196,8 @@ constexpr size_t Varint32Bytes(int32_t value)
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadSVarint32(int32_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadSVarint32(int32_t &out, READER &reader)
 {
     uint32_t outVal;
     if (!TryReadUVarint32(outVal, reader))
@@ -171,6 +208,14 @@ inline bool TryReadSVarint32(int32_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadSVarint32.
+ */
+inline bool TryReadSVarint32(int32_t &out, const ReaderRef &reader)
+{
+    return TryReadSVarint32<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a int32_t to a stream as a varint.  Negative values
  *        are encoded as small positive integers using zig-zag encoding.
@@ -179,12 +224,21 @@ inline bool TryReadSVarint32(int32_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteSVarint32(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteSVarint32(WRITER &writer, int32_t value)
 {
     const uint32_t var = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
     return TryWriteUVarint32(writer, var);
 }
 
+/**
+ * @brief Type-erased overload of TryWriteSVarint32.
+ */
+inline bool TryWriteSVarint32(const WriterRef &writer, int32_t value)
+{
+    return TryWriteSVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an int32_t as a varint using
  *        zig-zag encoding.
@@ -210,7 +264,8 @@ constexpr size_t SVarint32Bytes(int32_t value)
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadUVarint64(uint64_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadUVarint64(uint64_t &out, READER &reader)
 {
     constexpr int MAX_BYTES = 10;
     uint64_t rvo = 0;
@@ -239,6 +294,14 @@ inline bool TryReadUVarint64(uint64_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadUVarint64.
+ */
+inline bool TryReadUVarint64(uint64_t &out, const ReaderRef &reader)
+{
+    return TryReadUVarint64<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a uint64_t to a stream as a varint.
  *
@@ -246,7 +309,8 @@ inline bool TryReadUVarint64(uint64_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteUVarint64(const WriterRef &writer, const uint64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteUVarint64(WRITER &writer, const uint64_t value)
 {
     uint64_t v = value;
     while (v >= 0x80)
@@ -260,6 +324,14 @@ inline bool TryWriteUVarint64(const WriterRef &writer, const uint64_t value)
     return TryWriteU8(writer, static_cast<uint8_t>(v));
 }
 
+/**
+ * @brief Type-erased overload of TryWriteUVarint64.
+ */
+inline bool TryWriteUVarint64(const WriterRef &writer, const uint64_t value)
+{
+    return TryWriteUVarint64<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an uint64_t as a varint.
  */
@@ -285,7 +357,8 @@ constexpr size_t UVarint64Bytes(const uint64_t value)
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadVarint64(int64_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadVarint64(int64_t &out, READER &reader)
 {
     uint64_t outVal = 0;
     if (!TryReadUVarint64(outVal, reader))
@@ -296,6 +369,14 @@ inline bool TryReadVarint64(int64_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadVarint64.
+ */
+inline bool TryReadVarint64(int64_t &out, const ReaderRef &reader)
+{
+    return TryReadVarint64<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a int64_t to a stream as a varint.  Negative values
  *        are encoded as large positive integers.
@@ -304,11 +385,20 @@ inline bool TryReadVarint64(int64_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteVarint64(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteVarint64(WRITER &writer, int64_t value)
 {
     return TryWriteUVarint64(writer, static_cast<uint64_t>(value));
 }
 
+/**
+ * @brief Type-erased overload of TryWriteVarint64.
+ */
+inline bool TryWriteVarint64(const WriterRef &writer, int64_t value)
+{
+    return TryWriteVarint64<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an int64_t as a varint.
  */
@@ -334,7 +424,8 @@ constexpr size_t Varint64Bytes(int64_t value)
  * @param reader Reader to read from.
  * @return True if the read was successful.
  */
-inline bool TryReadSVarint64(int64_t &out, const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline bool TryReadSVarint64(int64_t &out, READER &reader)
 {
     uint64_t outVal;
     if (!TryReadUVarint64(outVal, reader))
@@ -345,6 +436,14 @@ inline bool TryReadSVarint64(int64_t &out, const ReaderRef &reader)
     return true;
 }
 
+/**
+ * @brief Type-erased overload of TryReadSVarint64.
+ */
+inline bool TryReadSVarint64(int64_t &out, const ReaderRef &reader)
+{
+    return TryReadSVarint64<const ReaderRef>(out, reader);
+}
+
 /**
  * @brief Try to write a int64_t to a stream as a varint.  Negative values
  *        are encoded as small positive integers using zig-zag encoding.
@@ -353,12 +452,21 @@ inline bool TryReadSVarint64(int64_t &out, const ReaderRef &reader)
  * @param value Integer to write.
  * @return True if the write was successful.
  */
-inline bool TryWriteSVarint64(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline bool TryWriteSVarint64(WRITER &writer, int64_t value)
 {
     const uint64_t var = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
     return TryWriteUVarint64(writer, var);
 }
 
+/**
+ * @brief Type-erased overload of TryWriteSVarint64.
+ */
+inline bool TryWriteSVarint64(const WriterRef &writer, int64_t value)
+{
+    return TryWriteSVarint64<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Return number of bytes needed to encode an int64_t as a varint using
  *        zig-zag encoding.
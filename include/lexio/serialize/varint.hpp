@@ -38,16 +38,25 @@ namespace LexIO
  * @return An unsigned 32-bit integer from the Reader.
  * @throws std::runtime_error if there are too many varint bytes for a 64-bit integer.
  */
-inline uint32_t ReadUVarint32(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint32_t ReadUVarint32(READER &reader)
 {
     uint32_t rvo;
     if (!TryReadUVarint32(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadUVarint32.
+ */
+inline uint32_t ReadUVarint32(const ReaderRef &reader)
+{
+    return ReadUVarint32<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a protobuf-style Varint.
  *
@@ -58,14 +67,23 @@ inline uint32_t ReadUVarint32(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 32-bit integer to write to the Writer.
  */
-inline void WriteUVarint32(const WriterRef &writer, uint32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteUVarint32(WRITER &writer, uint32_t value)
 {
     if (!TryWriteUVarint32(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteUVarint32.
+ */
+inline void WriteUVarint32(const WriterRef &writer, uint32_t value)
+{
+    WriteUVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Read a signed integer encoded as a protobuf-style Varint.
  *
@@ -74,16 +92,25 @@ inline void WriteUVarint32(const WriterRef &writer, uint32_t value)
  * @param reader Reader to operate on.
  * @return An signed 32-bit integer from the Reader.
  */
-inline int32_t ReadVarint32(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int32_t ReadVarint32(READER &reader)
 {
     int32_t rvo;
     if (!TryReadVarint32(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadVarint32.
+ */
+inline int32_t ReadVarint32(const ReaderRef &reader)
+{
+    return ReadVarint32<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a signed integer encoded as a protobuf-style Varint.
  *
@@ -92,14 +119,23 @@ inline int32_t ReadVarint32(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 32-bit integer to write to the Writer.
  */
-inline void WriteVarint32(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteVarint32(WRITER &writer, int32_t value)
 {
     if (!TryWriteVarint32(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteVarint32.
+ */
+inline void WriteVarint32(const WriterRef &writer, int32_t value)
+{
+    WriteVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Read a signed integer zig-zag encoded as a protobuf-style Varint.
  *
@@ -108,16 +144,25 @@ inline void WriteVarint32(const WriterRef &writer, int32_t value)
  * @param reader Reader to operate on.
  * @return An signed 32-bit integer from the Reader.
  */
-inline int32_t ReadSVarint32(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int32_t ReadSVarint32(READER &reader)
 {
     int32_t rvo;
     if (!TryReadSVarint32(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadSVarint32.
+ */
+inline int32_t ReadSVarint32(const ReaderRef &reader)
+{
+    return ReadSVarint32<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a signed integer zig-zag encoded as a protobuf-style Varint.
  *
@@ -126,14 +171,23 @@ inline int32_t ReadSVarint32(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 32-bit integer to write to the Writer.
  */
-inline void WriteSVarint32(const WriterRef &writer, int32_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteSVarint32(WRITER &writer, int32_t value)
 {
     if (!TryWriteSVarint32(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteSVarint32.
+ */
+inline void WriteSVarint32(const WriterRef &writer, int32_t value)
+{
+    WriteSVarint32<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Read a protobuf-style Varint.
  *
@@ -145,16 +199,25 @@ inline void WriteSVarint32(const WriterRef &writer, int32_t value)
  * @return An unsigned 64-bit integer from the Reader.
  * @throws std::runtime_error if there are too many varint bytes for a 64-bit integer.
  */
-inline uint64_t ReadUVarint64(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline uint64_t ReadUVarint64(READER &reader)
 {
     uint64_t rvo;
     if (!TryReadUVarint64(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadUVarint64.
+ */
+inline uint64_t ReadUVarint64(const ReaderRef &reader)
+{
+    return ReadUVarint64<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a protobuf-style Varint.
  *
@@ -165,14 +228,23 @@ inline uint64_t ReadUVarint64(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 64-bit integer to write to the Writer.
  */
-inline void WriteUVarint64(const WriterRef &writer, const uint64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteUVarint64(WRITER &writer, const uint64_t value)
 {
     if (!TryWriteUVarint64(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteUVarint64.
+ */
+inline void WriteUVarint64(const WriterRef &writer, const uint64_t value)
+{
+    WriteUVarint64<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Read a signed integer encoded as a protobuf-style Varint.
  *
@@ -181,16 +253,25 @@ inline void WriteUVarint64(const WriterRef &writer, const uint64_t value)
  * @param reader Reader to operate on.
  * @return An signed 64-bit integer from the Reader.
  */
-inline int64_t ReadVarint64(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int64_t ReadVarint64(READER &reader)
 {
     int64_t rvo;
     if (!TryReadVarint64(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadVarint64.
+ */
+inline int64_t ReadVarint64(const ReaderRef &reader)
+{
+    return ReadVarint64<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a signed integer encoded as a protobuf-style Varint.
  *
@@ -199,14 +280,23 @@ inline int64_t ReadVarint64(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 64-bit integer to write to the Writer.
  */
-inline void WriteVarint64(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteVarint64(WRITER &writer, int64_t value)
 {
     if (!TryWriteVarint64(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteVarint64.
+ */
+inline void WriteVarint64(const WriterRef &writer, int64_t value)
+{
+    WriteVarint64<const WriterRef>(writer, value);
+}
+
 /**
  * @brief Read a signed integer zig-zag encoded as a protobuf-style Varint.
  *
@@ -215,16 +305,25 @@ inline void WriteVarint64(const WriterRef &writer, int64_t value)
  * @param reader Reader to operate on.
  * @return An signed 64-bit integer from the Reader.
  */
-inline int64_t ReadSVarint64(const ReaderRef &reader)
+template <typename READER, typename = std::enable_if_t<IsReaderV<READER>>>
+inline int64_t ReadSVarint64(READER &reader)
 {
     int64_t rvo;
     if (!TryReadSVarint64(rvo, reader))
     {
-        throw std::runtime_error("could not read");
+        LEXIO_THROW(std::runtime_error("could not read"));
     }
     return rvo;
 }
 
+/**
+ * @brief Type-erased overload of ReadSVarint64.
+ */
+inline int64_t ReadSVarint64(const ReaderRef &reader)
+{
+    return ReadSVarint64<const ReaderRef>(reader);
+}
+
 /**
  * @brief Write a signed integer zig-zag encoded as a protobuf-style Varint.
  *
@@ -233,12 +332,21 @@ inline int64_t ReadSVarint64(const ReaderRef &reader)
  * @param writer Writer to operate on.
  * @param value An unsigned 64-bit integer to write to the Writer.
  */
-inline void WriteSVarint64(const WriterRef &writer, int64_t value)
+template <typename WRITER, typename = std::enable_if_t<IsWriterV<WRITER>>>
+inline void WriteSVarint64(WRITER &writer, int64_t value)
 {
     if (!TryWriteSVarint64(writer, value))
     {
-        throw std::runtime_error("could not write");
+        LEXIO_THROW(std::runtime_error("could not write"));
     }
 }
 
+/**
+ * @brief Type-erased overload of WriteSVarint64.
+ */
+inline void WriteSVarint64(const WriterRef &writer, int64_t value)
+{
+    WriteSVarint64<const WriterRef>(writer, value);
+}
+
 } // namespace LexIO
@@ -22,5 +22,7 @@
 #pragma once
 
 #include "./stream/file.hpp"
+#include "./stream/pipe.hpp"
+#include "./stream/uring.hpp"
 #include "./stream/vector.hpp"
 #include "./stream/view.hpp"
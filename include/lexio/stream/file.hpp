@@ -22,6 +22,7 @@
 #pragma once
 
 #include "../core.hpp"
+#include "../lib.hpp"
 
 namespace LexIO
 {
@@ -50,6 +51,22 @@ enum class OpenMode
     appendPlus,
 };
 
+/**
+ * @brief Options that change how a file opened with FileOpen does I/O.
+ */
+struct OpenOptions
+{
+    // Bypass the page cache.  Uses O_DIRECT where available, F_NOCACHE on
+    // macOS and FILE_FLAG_NO_BUFFERING on Windows.  Offsets, lengths, and
+    // buffer addresses usually have to be aligned to the logical block size,
+    // see DirectReader and DirectWriter.
+    bool direct = false;
+
+    // Writes return once the data is on storage.  Uses O_DSYNC, or
+    // FILE_FLAG_WRITE_THROUGH on Windows.
+    bool dsync = false;
+};
+
 } // namespace LexIO
 
 #if defined(_WIN32)
@@ -147,13 +164,14 @@ class FileWin32
      * @return A constructed FileWin32 object.
      * @throws Win32Error if error was encountered.
      */
-    static FileWin32 Open(const char *path, DWORD desiredAccess, DWORD shareMode, DWORD creationDisposition)
+    static FileWin32 Open(const char *path, DWORD desiredAccess, DWORD shareMode, DWORD creationDisposition,
+                          DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL)
     {
         // Request buffer size.
         const int wanted = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
         if (wanted == 0)
         {
-            throw Win32Error("Could not open file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not open file.", GetLastError()));
         }
 
         // Stuff filename into wide string.
@@ -162,15 +180,15 @@ class FileWin32
         const int actual = MultiByteToWideChar(CP_UTF8, 0, path, -1, &wpath[0], wanted);
         if (actual == 0)
         {
-            throw Win32Error("Could not open file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not open file.", GetLastError()));
         }
 
         // Open the file.
         const HANDLE fileHandle = CreateFileW(wpath.c_str(), desiredAccess, shareMode, NULL, creationDisposition,
-                                              FILE_ATTRIBUTE_NORMAL, NULL);
+                                              flagsAndAttributes, NULL);
         if (fileHandle == INVALID_HANDLE_VALUE)
         {
-            throw Win32Error("Could not open file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not open file.", GetLastError()));
         }
 
         return FileWin32(fileHandle);
@@ -186,7 +204,7 @@ class FileWin32
             const BOOL ok = CloseHandle(m_fileHandle);
             if (ok == FALSE)
             {
-                throw Win32Error("Could not close file.", GetLastError());
+                LEXIO_THROW(Win32Error("Could not close file.", GetLastError()));
             }
             m_fileHandle = INVALID_HANDLE_VALUE;
         }
@@ -199,7 +217,7 @@ class FileWin32
         const BOOL ok = ReadFile(m_fileHandle, outDest, bytesToRead, &bytesRead, NULL);
         if (ok == FALSE)
         {
-            throw Win32Error("Could not read file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not read file.", GetLastError()));
         }
         return bytesRead;
     }
@@ -211,7 +229,7 @@ class FileWin32
         const BOOL ok = WriteFile(m_fileHandle, src, bytesToRead, &bytesRead, NULL);
         if (ok == FALSE)
         {
-            throw Win32Error("Could not write file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not write file.", GetLastError()));
         }
         return bytesRead;
     }
@@ -221,7 +239,7 @@ class FileWin32
         const BOOL ok = FlushFileBuffers(m_fileHandle);
         if (ok == FALSE)
         {
-            throw Win32Error("Could not flush file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not flush file.", GetLastError()));
         }
     }
 
@@ -247,11 +265,21 @@ class FileWin32
         const BOOL ok = SetFilePointerEx(m_fileHandle, offset, &newOffset, whence);
         if (ok == 0)
         {
-            throw Win32Error("Could not seek file.", GetLastError());
+            LEXIO_THROW(Win32Error("Could not seek file.", GetLastError()));
         }
         return static_cast<size_t>(newOffset.QuadPart);
     }
 
+    size_t LexLength() const
+    {
+        LARGE_INTEGER size;
+        if (FALSE == GetFileSizeEx(m_fileHandle, &size))
+        {
+            LEXIO_THROW(Win32Error("Could not get file size.", GetLastError()));
+        }
+        return size_t(size.QuadPart);
+    }
+
   protected:
     HANDLE m_fileHandle = INVALID_HANDLE_VALUE;
 
@@ -263,28 +291,39 @@ class FileWin32
  *
  * @param path Path to file.  Encoding is assumed to be UTF-8.
  * @param mode Mode to open with.
+ * @param options Extra options to open with.
  * @return An opened file.
  * @throws Win32Error if open operation failed.
  * @throws std::runtime_error if invalid mode was passed.
  */
-inline FileWin32 FileOpen(const char *path, const OpenMode mode)
+inline FileWin32 FileOpen(const char *path, const OpenMode mode, const OpenOptions &options = OpenOptions{})
 {
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+    if (options.direct)
+    {
+        flags |= FILE_FLAG_NO_BUFFERING;
+    }
+    if (options.dsync)
+    {
+        flags |= FILE_FLAG_WRITE_THROUGH;
+    }
+
     switch (mode)
     {
     case OpenMode::read:
-        return FileWin32::Open(path, GENERIC_READ, 0, OPEN_EXISTING);
+        return FileWin32::Open(path, GENERIC_READ, 0, OPEN_EXISTING, flags);
     case OpenMode::write:
-        return FileWin32::Open(path, GENERIC_WRITE, 0, CREATE_ALWAYS);
+        return FileWin32::Open(path, GENERIC_WRITE, 0, CREATE_ALWAYS, flags);
     case OpenMode::append:
-        return FileWin32::Open(path, GENERIC_WRITE, 0, OPEN_ALWAYS);
+        return FileWin32::Open(path, GENERIC_WRITE, 0, OPEN_ALWAYS, flags);
     case OpenMode::readPlus:
-        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, OPEN_EXISTING);
+        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, OPEN_EXISTING, flags);
     case OpenMode::writePlus:
-        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS);
+        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, CREATE_ALWAYS, flags);
     case OpenMode::appendPlus:
-        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, OPEN_ALWAYS);
+        return FileWin32::Open(path, GENERIC_READ | GENERIC_WRITE, 0, OPEN_ALWAYS, flags);
     default:
-        throw std::runtime_error("Unknown open mode type.");
+        LEXIO_THROW(std::runtime_error("Unknown open mode type."));
     }
 }
 
@@ -293,7 +332,7 @@ inline size_t Length(const FileWin32 &file)
     LARGE_INTEGER size;
     if (FALSE == GetFileSizeEx(file.FileHandle(), &size))
     {
-        throw Win32Error("Could not get file size.", GetLastError());
+        LEXIO_THROW(Win32Error("Could not get file size.", GetLastError()));
     }
     return size_t(size.QuadPart);
 }
@@ -311,9 +350,19 @@ using File = FileWin32;
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
 namespace LexIO
 {
 
@@ -329,13 +378,339 @@ class POSIXError : public std::runtime_error
     int GetError() const noexcept { return m_error; }
 };
 
+/**
+ * @brief Ways that a FilePOSIX can make written data durable.
+ */
+enum class SyncMode
+{
+    // Flush data and metadata with fsync(2).
+    fsync,
+
+    // Flush data and only the metadata needed to read it back with
+    // fdatasync(2).  Falls back to fsync(2) where unavailable.
+    fdatasync,
+
+    // Start writeback of dirty pages and wait for it to finish with
+    // sync_file_range(2).  Does not flush metadata or disk caches, and falls
+    // back to fdatasync(2) outside of Linux.
+    syncFileRange,
+
+    // Never sync, leave writeback to the operating system.
+    none,
+};
+
+/**
+ * @brief Policy that controls when and how a FilePOSIX syncs written data.
+ */
+struct SyncPolicy
+{
+    // How to sync when LexFlush is called or a threshold is hit.
+    SyncMode mode = SyncMode::fsync;
+
+    // Sync after this many bytes have been written since the last sync.
+    // Zero disables the byte threshold.
+    size_t everyBytes = 0;
+
+    // Sync on write if this much time has passed since the last sync.
+    // Zero disables the time threshold.
+    std::chrono::milliseconds everyTime{0};
+};
+
+/**
+ * @brief How a FilePOSIX expects a range of the file to be accessed, passed
+ *        to the kernel with posix_fadvise(2).
+ */
+enum class AccessHint
+{
+    // No particular pattern, undoes any earlier hint.
+    normal,
+
+    // Read front to back, so read ahead aggressively.
+    sequential,
+
+    // Read in no particular order, so don't read ahead.
+    random,
+
+    // Will be read soon, so start reading it into the page cache now.
+    willNeed,
+
+    // Won't be read again soon, so drop it from the page cache.
+    dontNeed,
+
+    // Will be read once.
+    noReuse,
+};
+
+/**
+ * @brief A range of a file that holds data, as opposed to a hole.
+ */
+struct FileExtent
+{
+    size_t offset = 0;
+    size_t length = 0;
+};
+
 /**
  * @brief A stream implementation that wraps a POSIX fd.
  */
 class FilePOSIX
 {
+    // Buffers passed to a single readv/writev call.  Anything past this is
+    // left to the caller as a partial read or write.
+    static constexpr size_t MAX_IOV = 64;
+
     int m_fd = -1;
-    FilePOSIX(const int fd) : m_fd(fd) {}
+    SyncPolicy m_syncPolicy;
+    size_t m_unsyncedBytes = 0;
+    std::chrono::steady_clock::time_point m_lastSync;
+
+    // When the offset cache is enabled and the offset is known, m_offset is
+    // the real position of the stream and the kernel offset is stale.
+    bool m_cacheOffset = false;
+    bool m_append = false;
+    bool m_offsetKnown = false;
+    size_t m_offset = 0;
+
+    // Drop behind reads once this many bytes have been read, or never if 0.
+    size_t m_dropBehind = 0;
+    size_t m_dropPending = 0;
+
+    // Keep at least half of this much space reserved past the cursor, or
+    // never if 0.  m_preallocEnd is the end of what we've reserved so far.
+    // m_preallocCursor is where the cursor was when we last looked, plus
+    // whatever has been written since.
+    size_t m_preallocStep = 0;
+    size_t m_preallocEnd = 0;
+    size_t m_preallocCursor = 0;
+
+    FilePOSIX(const int fd) : m_fd(fd), m_lastSync(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Get the cached offset, asking the kernel for it if the cache
+     *        was invalidated.
+     *
+     * @param outOffset Current offset of the stream.
+     * @return Error from the lseek call, if one was needed and failed.
+     */
+    Error TryCachedOffset(size_t &outOffset) noexcept
+    {
+        if (!m_offsetKnown)
+        {
+            const off_t offset = lseek(m_fd, 0, SEEK_CUR);
+            if (offset == -1)
+            {
+                return Error{"Could not seek file.", errno};
+            }
+
+            m_offset = static_cast<size_t>(offset);
+            m_offsetKnown = true;
+        }
+
+        outOffset = m_offset;
+        return Error{};
+    }
+
+    /**
+     * @brief Move the kernel offset to the cached offset and invalidate the
+     *        cache, so the fd can be used directly.
+     *
+     * @throws POSIXError if the seek failed.
+     */
+    void RestoreKernelOffset()
+    {
+        if (m_cacheOffset && m_offsetKnown)
+        {
+            if (lseek(m_fd, static_cast<off_t>(m_offset), SEEK_SET) == -1)
+            {
+                LEXIO_THROW(POSIXError("Could not seek file.", errno));
+            }
+            m_offsetKnown = false;
+        }
+    }
+
+    /**
+     * @brief Drop the pages behind the cursor from the page cache once
+     *        enough has been read.  Failure is ignored, it's only a hint.
+     */
+    void DropBehindIfNeeded(size_t bytesRead) noexcept
+    {
+        m_dropPending += bytesRead;
+        if (m_dropPending < m_dropBehind)
+        {
+            return;
+        }
+
+#if defined(POSIX_FADV_DONTNEED)
+        const off_t offset = m_cacheOffset && m_offsetKnown ? static_cast<off_t>(m_offset) : lseek(m_fd, 0, SEEK_CUR);
+        if (offset != -1)
+        {
+            const off_t length = Detail::Min(offset, static_cast<off_t>(m_dropPending));
+            posix_fadvise(m_fd, offset - length, length, POSIX_FADV_DONTNEED);
+        }
+#endif
+        m_dropPending = 0;
+    }
+
+    /**
+     * @brief Reserve space for a range of the file.
+     *
+     * @return Error from the allocation, if it failed.
+     */
+    Error TryPreallocate(size_t offset, size_t length, bool keepSize) noexcept
+    {
+#if defined(__linux__)
+        int ok = 0;
+        do
+        {
+            ok = fallocate(m_fd, keepSize ? FALLOC_FL_KEEP_SIZE : 0, static_cast<off_t>(offset),
+                           static_cast<off_t>(length));
+        } while (ok == -1 && errno == EINTR);
+
+        if (ok == -1)
+        {
+            return Error{"Could not preallocate file.", errno};
+        }
+#elif defined(__APPLE__)
+        struct stat st;
+        if (fstat(m_fd, &st) == -1)
+        {
+            return Error{"Could not stat file.", errno};
+        }
+
+        // F_PREALLOCATE only grows the allocation from the current end.
+        const off_t end = static_cast<off_t>(offset + length);
+        if (end > st.st_size)
+        {
+            fstore_t store;
+            std::memset(&store, 0, sizeof(store));
+            store.fst_flags = F_ALLOCATECONTIG;
+            store.fst_posmode = F_PEOFPOSMODE;
+            store.fst_length = end - st.st_size;
+            if (fcntl(m_fd, F_PREALLOCATE, &store) == -1)
+            {
+                // Contiguous space is only a preference.
+                store.fst_flags = F_ALLOCATEALL;
+                if (fcntl(m_fd, F_PREALLOCATE, &store) == -1)
+                {
+                    return Error{"Could not preallocate file.", errno};
+                }
+            }
+
+            if (!keepSize && ftruncate(m_fd, end) == -1)
+            {
+                return Error{"Could not preallocate file.", errno};
+            }
+        }
+#else
+        if (!keepSize)
+        {
+            // Returns the error rather than setting errno.
+            const int err = posix_fallocate(m_fd, static_cast<off_t>(offset), static_cast<off_t>(length));
+            if (err != 0)
+            {
+                return Error{"Could not preallocate file.", err};
+            }
+        }
+#endif
+        return Error{};
+    }
+
+    /**
+     * @brief Reserve more space past the cursor after a write if it's
+     *        running low.  Failure is ignored, since the write it would have
+     *        helped has already happened.
+     *
+     * @detail The cursor is estimated from the bytes written, and only
+     *         looked up once the estimate says the reservation is running
+     *         low, so most writes don't pay for an lseek.
+     *
+     * @param written Bytes written by the write that just finished.
+     */
+    void PreallocateIfNeeded(size_t written) noexcept
+    {
+        m_preallocCursor += written;
+        if (m_preallocCursor + m_preallocStep / 2 < m_preallocEnd)
+        {
+            return;
+        }
+
+        const off_t offset = m_cacheOffset && m_offsetKnown ? static_cast<off_t>(m_offset) : lseek(m_fd, 0, SEEK_CUR);
+        if (offset == -1)
+        {
+            return;
+        }
+
+        m_preallocCursor = static_cast<size_t>(offset);
+        if (m_preallocCursor + m_preallocStep / 2 < m_preallocEnd)
+        {
+            return;
+        }
+
+        const size_t start = Detail::Max(m_preallocCursor, m_preallocEnd);
+        const size_t end = m_preallocCursor + m_preallocStep;
+        const Error err = TryPreallocate(start, end - start, true);
+        if (!err)
+        {
+            m_preallocEnd = end;
+        }
+        else if (err.SysError() == EOPNOTSUPP || err.SysError() == ENOSYS)
+        {
+            // The filesystem can't do it, so stop trying.
+            m_preallocStep = 0;
+        }
+    }
+
+    /**
+     * @brief Release space reserved past the end of the file by
+     *        PreallocateIfNeeded, by truncating the file to its own size.
+     */
+    void TrimPreallocation() noexcept
+    {
+        if (m_preallocEnd == 0)
+        {
+            return;
+        }
+
+        struct stat st;
+        if (fstat(m_fd, &st) == 0 && S_ISREG(st.st_mode))
+        {
+            ftruncate(m_fd, st.st_size);
+        }
+        m_preallocEnd = 0;
+    }
+
+    /**
+     * @brief Check the sync thresholds after a write, syncing if needed.
+     *
+     * @return Error from the sync, if one was attempted and failed.
+     */
+    Error TrySyncIfNeeded() noexcept
+    {
+        if (m_syncPolicy.everyBytes != 0 && m_unsyncedBytes >= m_syncPolicy.everyBytes)
+        {
+            return TrySync();
+        }
+        else if (m_syncPolicy.everyTime.count() != 0 &&
+                 std::chrono::steady_clock::now() - m_lastSync >= m_syncPolicy.everyTime)
+        {
+            return TrySync();
+        }
+        return Error{};
+    }
+
+    /**
+     * @brief Check the sync thresholds after a write, syncing if needed.
+     *
+     * @throws POSIXError if the sync operation failed.
+     */
+    void SyncIfNeeded()
+    {
+        const Error err = TrySyncIfNeeded();
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+    }
 
   public:
     /**
@@ -348,7 +723,15 @@ class FilePOSIX
     /**
      * @brief Move constructor.
      */
-    FilePOSIX(FilePOSIX &&other) noexcept : m_fd(other.m_fd) { other.m_fd = -1; }
+    FilePOSIX(FilePOSIX &&other) noexcept
+        : m_fd(other.m_fd), m_syncPolicy(other.m_syncPolicy), m_unsyncedBytes(other.m_unsyncedBytes),
+          m_lastSync(other.m_lastSync), m_cacheOffset(other.m_cacheOffset), m_append(other.m_append),
+          m_offsetKnown(other.m_offsetKnown), m_offset(other.m_offset), m_dropBehind(other.m_dropBehind),
+          m_dropPending(other.m_dropPending), m_preallocStep(other.m_preallocStep), m_preallocEnd(other.m_preallocEnd),
+          m_preallocCursor(other.m_preallocCursor)
+    {
+        other.m_fd = -1;
+    }
 
     /**
      * @brief Destructor closes file handle with no error handling.
@@ -357,6 +740,7 @@ class FilePOSIX
     {
         if (m_fd != -1)
         {
+            TrimPreallocation();
             close(m_fd);
         }
         m_fd = -1;
@@ -370,13 +754,26 @@ class FilePOSIX
     FilePOSIX &operator=(FilePOSIX &&other) noexcept
     {
         m_fd = other.m_fd;
+        m_syncPolicy = other.m_syncPolicy;
+        m_unsyncedBytes = other.m_unsyncedBytes;
+        m_lastSync = other.m_lastSync;
+        m_cacheOffset = other.m_cacheOffset;
+        m_append = other.m_append;
+        m_offsetKnown = other.m_offsetKnown;
+        m_offset = other.m_offset;
+        m_dropBehind = other.m_dropBehind;
+        m_dropPending = other.m_dropPending;
+        m_preallocStep = other.m_preallocStep;
+        m_preallocEnd = other.m_preallocEnd;
+        m_preallocCursor = other.m_preallocCursor;
         other.m_fd = -1;
         return *this;
     }
 
     /**
      * @brief Return the internal fd.  Reading, writing, and seeking this
-     *        handle directly is not recommended.
+     *        handle directly is not recommended, and while the offset cache
+     *        is enabled the offset of the fd is not kept up to date.
      */
     int FileHandle() const & noexcept { return m_fd; }
 
@@ -391,160 +788,1530 @@ class FilePOSIX
     static int InvalidFileHandle() { return -1; }
 
     /**
-     * @brief Open a file for reading.
+     * @brief Return the current sync policy.
+     */
+    const SyncPolicy &GetSyncPolicy() const noexcept { return m_syncPolicy; }
+
+    /**
+     * @brief Set the policy used by LexFlush and by writes to decide when and
+     *        how written data is synced to storage.
      *
-     * @param path Path to filename, assumed to be a null-terminated string.
-     * @param flags flags to pass to open(2) call.
-     * @param mode mode to pass to open(2) call.
-     * @return A constructed FilePOSIX object.
-     * @throws POSIXError if error was encountered.
+     * @param policy New sync policy.
      */
-    static FilePOSIX Open(const char *path, const int flags, mode_t mode)
+    void SetSyncPolicy(const SyncPolicy &policy) noexcept { m_syncPolicy = policy; }
+
+    /**
+     * @brief Return the number of bytes written since the last sync.
+     */
+    size_t UnsyncedBytes() const noexcept { return m_unsyncedBytes; }
+
+    /**
+     * @brief Return true if the offset cache is enabled.
+     */
+    bool GetOffsetCache() const noexcept { return m_cacheOffset; }
+
+    /**
+     * @brief Enable or disable tracking the file offset in user space.
+     *
+     * @detail With the cache enabled, reads and writes use pread and pwrite
+     *         at the cached offset, and seeks other than from the end are
+     *         plain arithmetic, so Tell never makes a system call.  Writes to
+     *         files opened with O_APPEND go wherever the kernel puts them,
+     *         so they invalidate the cache until the next operation that
+     *         needs the offset asks the kernel for it.
+     *
+     * @param enable True to enable the cache, false to disable it.  Disabling
+     *               it moves the offset of the fd to the cached offset.
+     * @throws POSIXError if the file isn't seekable, or its flags couldn't be
+     *         read.
+     */
+    void SetOffsetCache(bool enable)
     {
-        int fd = 0;
-        do
+        if (enable == m_cacheOffset)
         {
-            fd = open(path, flags, mode);
-        } while (fd == -1 && errno == EINTR);
+            return;
+        }
+        else if (!enable)
+        {
+            RestoreKernelOffset();
+            m_cacheOffset = false;
+            return;
+        }
 
-        if (fd == -1)
+        const int flags = fcntl(m_fd, F_GETFL);
+        if (flags == -1)
         {
-            throw POSIXError("Could not open file.", errno);
+            LEXIO_THROW(POSIXError("Could not get file flags.", errno));
         }
 
-        return FilePOSIX(fd);
+        const off_t offset = lseek(m_fd, 0, SEEK_CUR);
+        if (offset == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not seek file.", errno));
+        }
+
+        m_cacheOffset = true;
+        m_append = (flags & O_APPEND) != 0;
+        m_offsetKnown = true;
+        m_offset = static_cast<size_t>(offset);
     }
 
     /**
-     * @brief Close the file.
+     * @brief Tell the kernel how a range of the file will be accessed.
+     *
+     * @detail A no-op on platforms without posix_fadvise(2).
+     *
+     * @param hint Expected access pattern.
+     * @param offset Start of the range.
+     * @param length Length of the range, or 0 for the rest of the file.
+     * @throws POSIXError if the kernel rejected the hint.
      */
-    void Close()
+    void Advise(AccessHint hint, size_t offset = 0, size_t length = 0)
     {
-        if (m_fd != -1)
+#if defined(POSIX_FADV_NORMAL)
+        int advice = POSIX_FADV_NORMAL;
+        switch (hint)
         {
-            int ok = 0;
-            do
-            {
-                ok = close(m_fd);
-            } while (ok == -1 && errno == EINTR);
+        case AccessHint::normal:
+            advice = POSIX_FADV_NORMAL;
+            break;
+        case AccessHint::sequential:
+            advice = POSIX_FADV_SEQUENTIAL;
+            break;
+        case AccessHint::random:
+            advice = POSIX_FADV_RANDOM;
+            break;
+        case AccessHint::willNeed:
+            advice = POSIX_FADV_WILLNEED;
+            break;
+        case AccessHint::dontNeed:
+            advice = POSIX_FADV_DONTNEED;
+            break;
+        case AccessHint::noReuse:
+            advice = POSIX_FADV_NOREUSE;
+            break;
+        }
 
-            if (ok == -1)
-            {
-                throw POSIXError("Could not close file.", errno);
-            }
-            m_fd = -1;
+        // Returns the error rather than setting errno.
+        const int err = posix_fadvise(m_fd, static_cast<off_t>(offset), static_cast<off_t>(length), advice);
+        if (err != 0)
+        {
+            LEXIO_THROW(POSIXError("Could not advise file access.", err));
         }
+#else
+        (void)hint;
+        (void)offset;
+        (void)length;
+#endif
     }
 
-    size_t LexRead(uint8_t *outDest, size_t count)
+    /**
+     * @brief Start reading a range of the file into the page cache, without
+     *        waiting for it.
+     *
+     * @detail Uses readahead(2) on Linux, and POSIX_FADV_WILLNEED elsewhere.
+     *
+     * @param offset Start of the range.
+     * @param length Length of the range.
+     * @throws POSIXError if the range could not be read ahead.
+     */
+    void Readahead(size_t offset, size_t length)
     {
-        ssize_t bytesRead = 0;
-        do
+#if defined(__linux__)
+        if (readahead(m_fd, static_cast<off_t>(offset), length) == -1)
         {
-            bytesRead = read(m_fd, outDest, count);
-        } while (bytesRead == -1 && errno == EINTR);
+            LEXIO_THROW(POSIXError("Could not read ahead file.", errno));
+        }
+#else
+        Advise(AccessHint::willNeed, offset, length);
+#endif
+    }
 
-        if (bytesRead == -1)
+    /**
+     * @brief Reserve disk space for a range of the file, so writes to it
+     *        don't have to allocate.
+     *
+     * @detail Uses fallocate(2) on Linux, F_PREALLOCATE on macOS and
+     *         posix_fallocate(3) elsewhere.  Reserving space without
+     *         changing the size is a no-op where none of these support it.
+     *
+     * @param offset Start of the range.
+     * @param length Length of the range.
+     * @param keepSize If true, the size of the file doesn't change, and space
+     *                 past the end is reserved for later.  Otherwise the
+     *                 file is extended to cover the range, which reads as
+     *                 zeroes.
+     * @throws POSIXError if the space couldn't be reserved, including when
+     *         the filesystem doesn't support it.
+     */
+    void Preallocate(size_t offset, size_t length, bool keepSize = false)
+    {
+        const Error err = TryPreallocate(offset, length, keepSize);
+        if (err)
         {
-            throw POSIXError("Could not read file.", errno);
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
         }
-        return static_cast<size_t>(bytesRead);
     }
 
-    size_t LexWrite(const uint8_t *src, size_t count)
+    /**
+     * @brief Truncate or extend the file to the given length.
+     *
+     * @throws POSIXError if the file couldn't be resized.
+     */
+    void Truncate(size_t length)
     {
-        ssize_t bytesWritten = 0;
+        int ok = 0;
         do
         {
-            bytesWritten = write(m_fd, src, count);
-        } while (bytesWritten == -1 && errno == EINTR);
+            ok = ftruncate(m_fd, static_cast<off_t>(length));
+        } while (ok == -1 && errno == EINTR);
 
-        if (bytesWritten == -1)
+        if (ok == -1)
         {
-            throw POSIXError("Could not write file.", errno);
+            LEXIO_THROW(POSIXError("Could not truncate file.", errno));
         }
-        return static_cast<size_t>(bytesWritten);
     }
 
-    void LexFlush()
+    /**
+     * @brief Find the first range of data at or after an offset, skipping
+     *        over any holes in a sparse file.
+     *
+     * @detail Uses SEEK_DATA and SEEK_HOLE, without moving the cursor.
+     *         Filesystems without hole support report the rest of the file
+     *         as one extent, as do platforms without SEEK_DATA.
+     *
+     * @param outExtent Extent that was found.
+     * @param offset Offset to start looking at.
+     * @return True if an extent was found, false if there is no data past
+     *         the offset.
+     * @throws POSIXError if the file couldn't be searched.
+     */
+    bool NextDataExtent(FileExtent &outExtent, size_t offset)
     {
-        const int ok = fsync(m_fd);
-        if (ok == -1)
+        const size_t length = LexLength();
+        if (offset >= length)
         {
-            throw POSIXError("Could not flush file.", errno);
+            return false;
         }
-    }
-
-    size_t LexSeek(const SeekPos &pos)
-    {
-        int whence = 0;
 
-        switch (pos.whence)
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        // Both seeks move the offset of the fd, which has to be put back
+        // unless the offset cache has taken over for it.
+        const bool restore = !(m_cacheOffset && m_offsetKnown);
+        const off_t saved = restore ? lseek(m_fd, 0, SEEK_CUR) : 0;
+        if (saved == -1)
         {
-        case LexIO::Whence::start:
+            LEXIO_THROW(POSIXError("Could not seek file.", errno));
+        }
+
+        const off_t data = lseek(m_fd, static_cast<off_t>(offset), SEEK_DATA);
+        const off_t hole = data != -1 ? lseek(m_fd, data, SEEK_HOLE) : -1;
+        const int err = errno;
+
+        if (restore && lseek(m_fd, saved, SEEK_SET) == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not seek file.", errno));
+        }
+
+        if (data == -1 && err == ENXIO)
+        {
+            // Nothing but holes until the end of the file.
+            return false;
+        }
+        else if (hole != -1)
+        {
+            outExtent.offset = static_cast<size_t>(data);
+            outExtent.length = static_cast<size_t>(hole - data);
+            return true;
+        }
+        else if (err != EINVAL)
+        {
+            LEXIO_THROW(POSIXError("Could not seek file.", err));
+        }
+#endif
+
+        outExtent.offset = offset;
+        outExtent.length = length - offset;
+        return true;
+    }
+
+    /**
+     * @brief Return the preallocation step, or 0 if it's off.
+     */
+    size_t GetPreallocateStep() const noexcept { return m_preallocStep; }
+
+    /**
+     * @brief Reserve space ahead of sequential writes in large steps.
+     *
+     * @detail Whenever less than half a step is reserved past the cursor
+     *         after a write, space up to a full step past the cursor is
+     *         reserved without changing the size of the file.  This keeps
+     *         the file from fragmenting and takes block allocation off of
+     *         most writes.  Whatever is left past the end of the file is
+     *         released when the file is closed.  That's done by truncating
+     *         the file to its current size, so don't use this on a file
+     *         another process is extending at the same time.
+     *
+     *         Positional writes don't reserve anything.  If the filesystem
+     *         doesn't support reserving space, the step is set back to 0.
+     *
+     * @param step Bytes to reserve ahead of the cursor, or 0 to turn it
+     *             off.
+     */
+    void SetPreallocateStep(size_t step) noexcept { m_preallocStep = step; }
+
+    /**
+     * @brief Return the drop behind window, or 0 if drop behind is off.
+     */
+    size_t GetDropBehind() const noexcept { return m_dropBehind; }
+
+    /**
+     * @brief Drop pages from the page cache once they have been read.
+     *
+     * @detail Meant for streaming a file through a buffered reader once.
+     *         Every time this many bytes have been read, the range just read
+     *         is dropped with POSIX_FADV_DONTNEED, so a long scan doesn't
+     *         evict everything else from the cache.  Data that was copied
+     *         into a buffer is no longer needed in the page cache, so this
+     *         works no matter how far ahead the buffer reads.
+     *
+     * @param window Bytes to read between drops, or 0 to turn it off.
+     */
+    void SetDropBehind(size_t window) noexcept
+    {
+        m_dropBehind = window;
+        m_dropPending = 0;
+    }
+
+    /**
+     * @brief Sync written data to storage using the mode of the current
+     *        sync policy.
+     *
+     * @throws POSIXError if the sync operation failed.
+     */
+    void Sync()
+    {
+        const Error err = TrySync();
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+    }
+
+    /**
+     * @brief Sync written data to storage using the mode of the current
+     *        sync policy, without throwing.
+     *
+     * @return Error with the errno of the failed sync operation, if any.
+     */
+    Error TrySync() noexcept
+    {
+        int ok = 0;
+        switch (m_syncPolicy.mode)
+        {
+        case SyncMode::fsync:
+            ok = fsync(m_fd);
+            break;
+        case SyncMode::fdatasync:
+#if defined(__APPLE__)
+            ok = fsync(m_fd);
+#else
+            ok = fdatasync(m_fd);
+#endif
+            break;
+        case SyncMode::syncFileRange:
+#if defined(__linux__)
+            ok = sync_file_range(m_fd, 0, 0,
+                                 SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+#elif defined(__APPLE__)
+            ok = fsync(m_fd);
+#else
+            ok = fdatasync(m_fd);
+#endif
+            break;
+        case SyncMode::none:
+            break;
+        }
+
+        if (ok == -1)
+        {
+            return Error{"Could not flush file.", errno};
+        }
+
+        m_unsyncedBytes = 0;
+        m_lastSync = std::chrono::steady_clock::now();
+        return Error{};
+    }
+
+    /**
+     * @brief Open a file for reading.
+     *
+     * @param path Path to filename, assumed to be a null-terminated string.
+     * @param flags flags to pass to open(2) call.
+     * @param mode mode to pass to open(2) call.
+     * @return A constructed FilePOSIX object.
+     * @throws POSIXError if error was encountered.
+     */
+    static FilePOSIX Open(const char *path, const int flags, mode_t mode)
+    {
+        int fd = 0;
+        do
+        {
+            fd = open(path, flags, mode);
+        } while (fd == -1 && errno == EINTR);
+
+        if (fd == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not open file.", errno));
+        }
+
+        return FilePOSIX(fd);
+    }
+
+    /**
+     * @brief Close the file.
+     */
+    void Close()
+    {
+        if (m_fd != -1)
+        {
+            TrimPreallocation();
+
+            int ok = 0;
+            do
+            {
+                ok = close(m_fd);
+            } while (ok == -1 && errno == EINTR);
+
+            if (ok == -1)
+            {
+                LEXIO_THROW(POSIXError("Could not close file.", errno));
+            }
+            m_fd = -1;
+        }
+    }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        size_t bytesRead = 0;
+        const Error err = LexTryRead(bytesRead, outDest, count);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        return bytesRead;
+    }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) noexcept
+    {
+        outRead = 0;
+        size_t offset = 0;
+        if (m_cacheOffset)
+        {
+            const Error err = TryCachedOffset(offset);
+            if (err)
+            {
+                return err;
+            }
+        }
+
+        ssize_t bytesRead = 0;
+        do
+        {
+            bytesRead = m_cacheOffset ? pread(m_fd, outDest, count, static_cast<off_t>(offset))
+                                      : read(m_fd, outDest, count);
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead == -1)
+        {
+            return Error{"Could not read file.", errno};
+        }
+
+        outRead = static_cast<size_t>(bytesRead);
+        m_offset += outRead;
+        if (m_dropBehind != 0)
+        {
+            DropBehindIfNeeded(outRead);
+        }
+        return Error{};
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        size_t bytesWritten = 0;
+        const Error err = LexTryWrite(bytesWritten, src, count);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        return bytesWritten;
+    }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) noexcept
+    {
+        outWritten = 0;
+        size_t offset = 0;
+        const bool positional = m_cacheOffset && !m_append;
+        if (positional)
+        {
+            const Error err = TryCachedOffset(offset);
+            if (err)
+            {
+                return err;
+            }
+        }
+
+        ssize_t bytesWritten = 0;
+        do
+        {
+            bytesWritten = positional ? pwrite(m_fd, src, count, static_cast<off_t>(offset)) : write(m_fd, src, count);
+        } while (bytesWritten == -1 && errno == EINTR);
+
+        if (bytesWritten == -1)
+        {
+            return Error{"Could not write file.", errno};
+        }
+
+        // The data is written even if the sync fails, so report both.
+        outWritten = static_cast<size_t>(bytesWritten);
+        m_offset += outWritten;
+        if (m_append)
+        {
+            // Appends land at the end of the file, wherever that is now.
+            m_offsetKnown = false;
+        }
+
+        if (m_preallocStep != 0)
+        {
+            PreallocateIfNeeded(outWritten);
+        }
+
+        m_unsyncedBytes += outWritten;
+        return TrySyncIfNeeded();
+    }
+
+    void LexFlush() { Sync(); }
+
+    int LexFileDescriptor()
+    {
+        // Whoever uses the fd moves its offset, so the cache can't be trusted.
+        RestoreKernelOffset();
+        return m_fd;
+    }
+
+    size_t LexSizeHint() const noexcept
+    {
+        // Only regular files have a meaningful size to go by.
+        struct stat st;
+        if (fstat(m_fd, &st) == -1 || !S_ISREG(st.st_mode))
+        {
+            return 0;
+        }
+
+        const off_t offset = m_cacheOffset && m_offsetKnown ? static_cast<off_t>(m_offset) : lseek(m_fd, 0, SEEK_CUR);
+        if (offset == -1 || offset >= st.st_size)
+        {
+            return 0;
+        }
+        return static_cast<size_t>(st.st_size - offset);
+    }
+
+    size_t LexReadV(const MutableBufferView *bufs, size_t count)
+    {
+        iovec iov[MAX_IOV];
+        const size_t iovCount = count < MAX_IOV ? count : MAX_IOV;
+        for (size_t i = 0; i < iovCount; i++)
+        {
+            iov[i].iov_base = bufs[i].Data();
+            iov[i].iov_len = bufs[i].Size();
+        }
+
+        size_t offset = 0;
+        if (m_cacheOffset)
+        {
+            const Error err = TryCachedOffset(offset);
+            if (err)
+            {
+                LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+            }
+        }
+
+        ssize_t bytesRead = 0;
+        do
+        {
+            bytesRead = m_cacheOffset ? preadv(m_fd, &iov[0], static_cast<int>(iovCount), static_cast<off_t>(offset))
+                                      : readv(m_fd, &iov[0], static_cast<int>(iovCount));
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not read file.", errno));
+        }
+
+        m_offset += static_cast<size_t>(bytesRead);
+        if (m_dropBehind != 0)
+        {
+            DropBehindIfNeeded(static_cast<size_t>(bytesRead));
+        }
+        return static_cast<size_t>(bytesRead);
+    }
+
+    size_t LexWriteV(const BufferView *bufs, size_t count)
+    {
+        iovec iov[MAX_IOV];
+        const size_t iovCount = count < MAX_IOV ? count : MAX_IOV;
+        for (size_t i = 0; i < iovCount; i++)
+        {
+            iov[i].iov_base = const_cast<uint8_t *>(bufs[i].Data());
+            iov[i].iov_len = bufs[i].Size();
+        }
+
+        size_t offset = 0;
+        const bool positional = m_cacheOffset && !m_append;
+        if (positional)
+        {
+            const Error err = TryCachedOffset(offset);
+            if (err)
+            {
+                LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+            }
+        }
+
+        ssize_t bytesWritten = 0;
+        do
+        {
+            bytesWritten = positional ? pwritev(m_fd, &iov[0], static_cast<int>(iovCount), static_cast<off_t>(offset))
+                                      : writev(m_fd, &iov[0], static_cast<int>(iovCount));
+        } while (bytesWritten == -1 && errno == EINTR);
+
+        if (bytesWritten == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not write file.", errno));
+        }
+
+        m_offset += static_cast<size_t>(bytesWritten);
+        if (m_append)
+        {
+            m_offsetKnown = false;
+        }
+
+        if (m_preallocStep != 0)
+        {
+            PreallocateIfNeeded(static_cast<size_t>(bytesWritten));
+        }
+
+        m_unsyncedBytes += static_cast<size_t>(bytesWritten);
+        SyncIfNeeded();
+        return static_cast<size_t>(bytesWritten);
+    }
+
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        ssize_t bytesRead = 0;
+        do
+        {
+            bytesRead = pread(m_fd, outDest, count, static_cast<off_t>(offset));
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not read file.", errno));
+        }
+        return static_cast<size_t>(bytesRead);
+    }
+
+    /**
+     * @brief Write data at an absolute offset without moving the cursor.
+     *
+     * @details Positional writes do not count towards the sync policy
+     *          thresholds, since that accounting is not thread-safe.  Call
+     *          Sync() once all positional writes are done if durability is
+     *          required.  On Linux, files opened in append mode ignore the
+     *          offset and always append.
+     */
+    size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset)
+    {
+        ssize_t bytesWritten = 0;
+        do
+        {
+            bytesWritten = pwrite(m_fd, src, count, static_cast<off_t>(offset));
+        } while (bytesWritten == -1 && errno == EINTR);
+
+        if (bytesWritten == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not write file.", errno));
+        }
+        return static_cast<size_t>(bytesWritten);
+    }
+
+    size_t LexSeek(const SeekPos &pos)
+    {
+        if (m_cacheOffset && pos.whence != Whence::end)
+        {
+            // The end of the file can move under us, anything else is known.
+            size_t base = 0;
+            if (pos.whence == Whence::current)
+            {
+                const Error err = TryCachedOffset(base);
+                if (err)
+                {
+                    LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+                }
+            }
+
+            const ptrdiff_t newOffset = static_cast<ptrdiff_t>(base) + pos.offset;
+            if (newOffset < 0)
+            {
+                LEXIO_THROW(POSIXError("Could not seek file.", EINVAL));
+            }
+
+            m_offset = static_cast<size_t>(newOffset);
+            m_offsetKnown = true;
+            m_preallocCursor = m_offset;
+            return m_offset;
+        }
+
+        int whence = 0;
+
+        switch (pos.whence)
+        {
+        case LexIO::Whence::start:
             whence = SEEK_SET;
             break;
         case LexIO::Whence::current:
-            whence = SEEK_CUR;
+            whence = SEEK_CUR;
+            break;
+        case LexIO::Whence::end:
+            whence = SEEK_END;
+            break;
+        }
+
+        const off_t newOffset = lseek(m_fd, static_cast<off_t>(pos.offset), whence);
+        if (newOffset == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not seek file.", errno));
+        }
+
+        m_offset = static_cast<size_t>(newOffset);
+        m_offsetKnown = true;
+        m_preallocCursor = m_offset;
+        return m_offset;
+    }
+
+    size_t LexLength() const
+    {
+        struct stat st;
+        if (-1 == fstat(m_fd, &st))
+        {
+            LEXIO_THROW(POSIXError("Could not stat file.", errno));
+        }
+        return size_t(st.st_size);
+    }
+};
+
+namespace Detail
+{
+
+/**
+ * @brief Copy a range between two descriptors at explicit offsets, leaving
+ *        both of their cursors alone.
+ *
+ * @detail Uses copy_file_range on Linux where possible, which can share
+ *         blocks or copy on the device instead of going through memory.
+ *         Stops early if the source turns out to be shorter.
+ *
+ * @throws POSIXError if reading or writing failed.
+ */
+inline void CopyFileRange(int outFd, size_t outOffset, int inFd, size_t inOffset, size_t count)
+{
+    size_t copied = 0;
+    const Error err = TryCopyDescriptorRange(copied, outFd, &outOffset, inFd, &inOffset, count);
+    if (err)
+    {
+        LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+    }
+}
+
+/**
+ * @brief Make a range of a file read as zeroes, punching a hole if the
+ *        filesystem supports it and writing zeroes otherwise.
+ *
+ * @throws POSIXError if the range couldn't be cleared.
+ */
+inline void ClearFileRange(int fd, size_t offset, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    int ok = 0;
+    do
+    {
+        ok = fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset),
+                       static_cast<off_t>(count));
+    } while (ok == -1 && errno == EINTR);
+
+    if (ok == 0)
+    {
+        return;
+    }
+    else if (errno != EOPNOTSUPP)
+    {
+        LEXIO_THROW(POSIXError("Could not punch hole in file.", errno));
+    }
+#endif
+
+    constexpr size_t BUFFER_SIZE = 64 * 1024;
+    std::unique_ptr<uint8_t[]> zeroes{::new uint8_t[BUFFER_SIZE]()};
+    while (count != 0)
+    {
+        const ssize_t bytesWritten = pwrite(fd, zeroes.get(), Min(count, BUFFER_SIZE), static_cast<off_t>(offset));
+        if (bytesWritten == -1 && errno != EINTR)
+        {
+            LEXIO_THROW(POSIXError("Could not write file.", errno));
+        }
+        else if (bytesWritten == 0)
+        {
+            LEXIO_THROW(POSIXError("could not write exact number of bytes", 0));
+        }
+        else if (bytesWritten > 0)
+        {
+            offset += static_cast<size_t>(bytesWritten);
+            count -= static_cast<size_t>(bytesWritten);
+        }
+    }
+}
+
+} // namespace Detail
+
+/**
+ * @brief Copy from the cursor of one file to the end, to the cursor of
+ *        another, without reading or writing the holes of a sparse file.
+ *
+ * @detail Data extents of the source are found with NextDataExtent and
+ *         copied to the same relative offsets in the destination.  Holes
+ *         are left unwritten where the destination is being extended,
+ *         and punched (or zeroed) where it already had data, so the
+ *         destination ends up with the same contents and holes.  Both
+ *         cursors end up past the copied range.
+ *
+ * @param dest File to copy to.
+ * @param src File to copy from.
+ * @return Number of bytes the destination advanced by, holes included.
+ * @throws POSIXError if the copy failed.
+ */
+inline size_t CopySparse(FilePOSIX &dest, FilePOSIX &src)
+{
+    const size_t srcStart = src.LexSeek(SeekPos{0, Whence::current});
+    const size_t destStart = dest.LexSeek(SeekPos{0, Whence::current});
+    const size_t srcEnd = src.LexLength();
+    if (srcStart >= srcEnd)
+    {
+        return 0;
+    }
+
+    // Only the part of a hole that overlaps existing data has to be cleared.
+    const size_t destLength = dest.LexLength();
+    const auto clearHole = [&](size_t srcOffset, size_t count) {
+        const size_t offset = destStart + (srcOffset - srcStart);
+        if (offset < destLength)
+        {
+            Detail::ClearFileRange(dest.FileHandle(), offset, Detail::Min(count, destLength - offset));
+        }
+    };
+
+    size_t offset = srcStart;
+    FileExtent extent;
+    while (offset < srcEnd && src.NextDataExtent(extent, offset))
+    {
+        const size_t end = Detail::Min(extent.offset + extent.length, srcEnd);
+        clearHole(offset, extent.offset - offset);
+        Detail::CopyFileRange(dest.FileHandle(), destStart + (extent.offset - srcStart), src.FileHandle(),
+                              extent.offset, end - extent.offset);
+        offset = end;
+    }
+    clearHole(offset, srcEnd - offset);
+
+    // A trailing hole only exists if the file is long enough to contain it.
+    const size_t total = srcEnd - srcStart;
+    if (destStart + total > dest.LexLength())
+    {
+        dest.Truncate(destStart + total);
+    }
+
+    src.LexSeek(SeekPos{static_cast<ptrdiff_t>(srcEnd), Whence::start});
+    dest.LexSeek(SeekPos{static_cast<ptrdiff_t>(destStart + total), Whence::start});
+    return total;
+}
+
+/**
+ * @brief Open a file, calling the appropriate invocation of FilePOSIX::Open.
+ *
+ * @param path Path to file.  Encoding is assumed to be UTF-8.
+ * @param mode Mode to open with.
+ * @param options Extra options to open with.
+ * @return An opened file.
+ * @throws POSIXError if open operation failed.
+ * @throws std::runtime_error if invalid mode was passed.
+ */
+inline FilePOSIX FileOpen(const char *path, const OpenMode mode, const OpenOptions &options = OpenOptions{})
+{
+    int flags = 0;
+    switch (mode)
+    {
+    case OpenMode::read:
+        flags = O_RDONLY;
+        break;
+    case OpenMode::write:
+        flags = O_WRONLY | O_CREAT | O_TRUNC;
+        break;
+    case OpenMode::append:
+        flags = O_WRONLY | O_CREAT;
+        break;
+    case OpenMode::readPlus:
+        flags = O_RDWR;
+        break;
+    case OpenMode::writePlus:
+        flags = O_RDWR | O_CREAT | O_TRUNC;
+        break;
+    case OpenMode::appendPlus:
+        flags = O_RDWR | O_CREAT;
+        break;
+    default:
+        LEXIO_THROW(std::runtime_error("Unknown open mode type."));
+    }
+
+#if defined(O_DIRECT)
+    if (options.direct)
+    {
+        flags |= O_DIRECT;
+    }
+#endif
+    if (options.dsync)
+    {
+        flags |= O_DSYNC;
+    }
+
+    FilePOSIX file = FilePOSIX::Open(path, flags, 0666);
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+    if (options.direct && fcntl(file.FileHandle(), F_NOCACHE, 1) == -1)
+    {
+        LEXIO_THROW(POSIXError("Could not disable caching.", errno));
+    }
+#endif
+    return file;
+}
+
+inline size_t Length(const int fd)
+{
+    struct stat st;
+    if (-1 == fstat(fd, &st))
+    {
+        LEXIO_THROW(POSIXError("Could not stat file.", errno));
+    }
+    return size_t(st.st_size);
+}
+
+/**
+ * @brief On UNIX, File is a FilePOSIX.
+ */
+using File = FilePOSIX;
+
+/**
+ * @brief Access pattern hints that can be given to a MappedFile.
+ */
+enum class MapAdvice
+{
+    // No special treatment.
+    normal,
+
+    // Pages will be accessed in order, read ahead aggressively.
+    sequential,
+
+    // Pages will be accessed in random order, don't read ahead.
+    random,
+
+    // Pages will be needed soon, start reading them in now.
+    willNeed,
+};
+
+/**
+ * @brief A read-only stream implementation that memory-maps a file.
+ *
+ * @detail LexFillBuffer returns views directly into the mapping, so reading
+ *         through the BufferedReader interface involves no copies and no
+ *         system calls once a page is resident.  Only a window of the file
+ *         is mapped at a time, and the window slides along the file as the
+ *         stream is read or seeked.  A fill larger than the window size
+ *         maps as much of the file as is needed to satisfy it.
+ */
+class MappedFile
+{
+    static constexpr size_t DEFAULT_WINDOW_SIZE = 64 * 1024 * 1024;
+
+    FilePOSIX m_file;
+    size_t m_length = 0;
+    size_t m_windowSize = DEFAULT_WINDOW_SIZE;
+    MapAdvice m_advice = MapAdvice::normal;
+    uint8_t *m_map = nullptr;
+    size_t m_mapOffset = 0;
+    size_t m_mapSize = 0;
+    size_t m_offset = 0;
+    size_t m_bufferOffset = 0;
+
+    static size_t PageSize() { return static_cast<size_t>(sysconf(_SC_PAGESIZE)); }
+
+    size_t BufferSize() const { return m_offset - m_bufferOffset; }
+
+    void Unmap() noexcept
+    {
+        if (m_map != nullptr)
+        {
+            munmap(m_map, m_mapSize);
+        }
+        m_map = nullptr;
+        m_mapOffset = 0;
+        m_mapSize = 0;
+    }
+
+    void ApplyAdvice()
+    {
+        int advice = MADV_NORMAL;
+        switch (m_advice)
+        {
+        case MapAdvice::normal:
+            advice = MADV_NORMAL;
+            break;
+        case MapAdvice::sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case MapAdvice::random:
+            advice = MADV_RANDOM;
+            break;
+        case MapAdvice::willNeed:
+            advice = MADV_WILLNEED;
+            break;
+        }
+
+        if (madvise(m_map, m_mapSize, advice) == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not advise mapping.", errno));
+        }
+    }
+
+    /**
+     * @brief Ensure the range [start, end) of the file is mapped, sliding
+     *        the window if it is not.
+     */
+    void MapWindow(size_t start, size_t end)
+    {
+        if (m_map != nullptr && start >= m_mapOffset && end <= m_mapOffset + m_mapSize)
+        {
+            // Range is already mapped.
+            return;
+        }
+
+        Unmap();
+
+        // Mappings must start on a page boundary.
+        const size_t mapOffset = start - (start % PageSize());
+        const size_t mapSize = Detail::Min(Detail::Max(m_windowSize, end - mapOffset), m_length - mapOffset);
+
+        void *map = mmap(nullptr, mapSize, PROT_READ, MAP_SHARED, m_file.FileHandle(), static_cast<off_t>(mapOffset));
+        if (map == MAP_FAILED)
+        {
+            LEXIO_THROW(POSIXError("Could not map file.", errno));
+        }
+
+        m_map = static_cast<uint8_t *>(map);
+        m_mapOffset = mapOffset;
+        m_mapSize = mapSize;
+        if (m_advice != MapAdvice::normal)
+        {
+            ApplyAdvice();
+        }
+    }
+
+  public:
+    /**
+     * @brief Default constructor with no file.
+     */
+    MappedFile() = default;
+
+    MappedFile(const MappedFile &other) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    MappedFile(MappedFile &&other) noexcept
+        : m_file(std::move(other.m_file)), m_length(other.m_length), m_windowSize(other.m_windowSize),
+          m_advice(other.m_advice), m_map(std::exchange(other.m_map, nullptr)), m_mapOffset(other.m_mapOffset),
+          m_mapSize(other.m_mapSize), m_offset(other.m_offset), m_bufferOffset(other.m_bufferOffset)
+    {
+    }
+
+    /**
+     * @brief Construct from an open file.
+     *
+     * @param file File to map, must be opened for reading.
+     * @param windowSize Size of the mapped window in bytes, rounded up to
+     *                   the page size.
+     * @throws POSIXError if the file could not be measured.
+     */
+    MappedFile(FilePOSIX &&file, size_t windowSize = DEFAULT_WINDOW_SIZE)
+        : m_file(std::move(file)), m_length(Length(m_file.FileHandle()))
+    {
+        const size_t pageSize = PageSize();
+        m_windowSize = Detail::Max(pageSize, windowSize + (pageSize - windowSize % pageSize) % pageSize);
+    }
+
+    /**
+     * @brief Destructor unmaps the file and closes it with no error handling.
+     */
+    ~MappedFile() { Unmap(); }
+
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     */
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Unmap();
+        m_file = std::move(other.m_file);
+        m_length = other.m_length;
+        m_windowSize = other.m_windowSize;
+        m_advice = other.m_advice;
+        m_map = std::exchange(other.m_map, nullptr);
+        m_mapOffset = other.m_mapOffset;
+        m_mapSize = other.m_mapSize;
+        m_offset = other.m_offset;
+        m_bufferOffset = other.m_bufferOffset;
+        return *this;
+    }
+
+    /**
+     * @brief Open and map a file for reading.
+     *
+     * @param path Path to file.  Encoding is assumed to be UTF-8.
+     * @param windowSize Size of the mapped window in bytes.
+     * @return A constructed MappedFile object.
+     * @throws POSIXError if error was encountered.
+     */
+    static MappedFile Open(const char *path, size_t windowSize = DEFAULT_WINDOW_SIZE)
+    {
+        return MappedFile(FilePOSIX::Open(path, O_RDONLY, 0666), windowSize);
+    }
+
+    /**
+     * @brief Return the underlying file.
+     */
+    const FilePOSIX &File() const & noexcept { return m_file; }
+
+    /**
+     * @brief Return the size of the mapped window in bytes.
+     */
+    size_t WindowSize() const noexcept { return m_windowSize; }
+
+    /**
+     * @brief Give the kernel a hint about how the file will be accessed.
+     *        The hint applies to the current window and to every window
+     *        mapped after it.
+     *
+     * @param advice Access pattern hint.
+     * @throws POSIXError if the hint could not be applied.
+     */
+    void Advise(MapAdvice advice)
+    {
+        m_advice = advice;
+        if (m_map != nullptr)
+        {
+            ApplyAdvice();
+        }
+    }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        BufferView data = LexFillBuffer(count);
+        const size_t actualSize = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), actualSize);
+        LexConsumeBuffer(actualSize);
+        return actualSize;
+    }
+
+    BufferView LexFillBuffer(size_t count)
+    {
+        if (m_bufferOffset >= m_length)
+        {
+            // EOF, return nullptr to avoid mapping past the end.
+            return BufferView{nullptr, 0};
+        }
+
+        if (count > BufferSize())
+        {
+            // Grow the buffer up to the end of the file.
+            m_offset = count > m_length - m_bufferOffset ? m_length : m_bufferOffset + count;
+        }
+
+        MapWindow(m_bufferOffset, m_offset);
+        return BufferView{m_map + (m_bufferOffset - m_mapOffset), BufferSize()};
+    }
+
+    void LexConsumeBuffer(size_t count)
+    {
+        if (count > BufferSize())
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        // Shrink the buffer.
+        m_bufferOffset += count;
+    }
+
+    size_t LexSizeHint() const noexcept { return m_bufferOffset < m_length ? m_length - m_bufferOffset : 0; }
+
+    size_t LexLength() const noexcept { return m_length; }
+
+    size_t LexSeek(const SeekPos &pos)
+    {
+        ptrdiff_t offset = 0;
+        switch (pos.whence)
+        {
+        case LexIO::Whence::start:
+            offset = pos.offset;
+            break;
+        case LexIO::Whence::current:
+            offset = static_cast<ptrdiff_t>(m_offset) + pos.offset;
             break;
         case LexIO::Whence::end:
-            whence = SEEK_END;
+            offset = static_cast<ptrdiff_t>(m_length) + pos.offset;
             break;
         }
 
-        const off_t newOffset = lseek(m_fd, static_cast<off_t>(pos.offset), whence);
-        if (newOffset == -1)
+        if (offset < 0)
         {
-            throw POSIXError("Could not seek file.", errno);
+            // Negative offsets are invalid.
+            LEXIO_THROW(std::runtime_error("attempted seek to negative position"));
         }
-        return static_cast<size_t>(newOffset);
+
+        m_offset = static_cast<size_t>(offset);
+        m_bufferOffset = m_offset;
+        return m_offset;
     }
 };
 
+namespace Detail
+{
+
 /**
- * @brief Open a file, calling the appropriate invocation of FilePOSIX::Open.
+ * @brief State shared by a ParallelFileWriter and its sinks.  Sinks own a
+ *        share of it, so the file stays open for as long as any of them
+ *        are alive.
+ */
+struct ParallelFileState
+{
+    FilePOSIX file;
+    std::atomic<size_t> tail;
+    std::atomic<size_t> sinks;
+    std::atomic<bool> failed;
+
+    ParallelFileState(FilePOSIX &&f, size_t start) : file(std::move(f)), tail(start), sinks(0), failed(false) {}
+};
+
+} // namespace Detail
+
+/**
+ * @brief A buffered Writer handed out by a ParallelFileWriter, for use by a
+ *        single thread.
  *
- * @param path Path to file.  Encoding is assumed to be UTF-8.
- * @param mode Mode to open with.
- * @return An opened file.
- * @throws POSIXError if open operation failed.
- * @throws std::runtime_error if invalid mode was passed.
+ * @detail Data is buffered until the buffer is full, then a range exactly
+ *         the size of the buffered data is reserved at the tail of the
+ *         file and written there with pwrite(2), so ranges never overlap.
+ *         The data from a single call to LexWrite is always contiguous in
+ *         the file, but there is no ordering between sinks, or between
+ *         buffers of the same sink written by different threads.
+ *
+ *         A range is reserved before it's written, so a failed write
+ *         leaves a gap in the file.  The writer remembers this and its
+ *         Close throws.
  */
-inline FilePOSIX FileOpen(const char *path, const OpenMode mode)
+class ParallelFileSink
 {
-    switch (mode)
+    std::shared_ptr<Detail::ParallelFileState> m_state;
+    std::unique_ptr<uint8_t[]> m_buffer;
+    size_t m_allocSize = 0;
+    size_t m_size = 0;
+
+    /**
+     * @brief Reserve a range and write all of the passed data into it.
+     */
+    void WriteRange(const uint8_t *src, size_t count)
     {
-    case OpenMode::read:
-        return FilePOSIX::Open(path, O_RDONLY, 0666);
-    case OpenMode::write:
-        return FilePOSIX::Open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
-    case OpenMode::append:
-        return FilePOSIX::Open(path, O_WRONLY | O_CREAT, 0666);
-    case OpenMode::readPlus:
-        return FilePOSIX::Open(path, O_RDWR, 0666);
-    case OpenMode::writePlus:
-        return FilePOSIX::Open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
-    case OpenMode::appendPlus:
-        return FilePOSIX::Open(path, O_RDWR | O_CREAT, 0666);
-    default:
-        throw std::runtime_error("Unknown open mode type.");
+        const int fd = m_state->file.FileHandle();
+        size_t offset = m_state->tail.fetch_add(count, std::memory_order_relaxed);
+        while (count != 0)
+        {
+            const ssize_t bytesWritten = pwrite(fd, src, count, static_cast<off_t>(offset));
+            if (bytesWritten == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                m_state->failed.store(true, std::memory_order_relaxed);
+                LEXIO_THROW(POSIXError("Could not write file.", errno));
+            }
+            else if (bytesWritten == 0)
+            {
+                m_state->failed.store(true, std::memory_order_relaxed);
+                LEXIO_THROW(POSIXError("could not write exact number of bytes", 0));
+            }
+
+            src += bytesWritten;
+            offset += static_cast<size_t>(bytesWritten);
+            count -= static_cast<size_t>(bytesWritten);
+        }
     }
-}
 
-inline size_t Length(const int fd)
-{
-    struct stat st;
-    if (-1 == fstat(fd, &st))
+  public:
+    /**
+     * @brief Default constructor.  The sink isn't attached to a writer, and
+     *        writing to it throws until one is moved into it.
+     */
+    ParallelFileSink() = default;
+
+    /**
+     * @brief Constructor, see ParallelFileWriter::Sink.
+     *
+     * @param state State shared with the writer.
+     * @param bufSize Size of write buffer in bytes.
+     */
+    ParallelFileSink(std::shared_ptr<Detail::ParallelFileState> state, size_t bufSize)
+        : m_state(std::move(state)), m_buffer(::new uint8_t[bufSize]), m_allocSize(bufSize)
     {
-        throw POSIXError("Could not stat file.", errno);
+        m_state->sinks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ParallelFileSink(const ParallelFileSink &) = delete;
+    ParallelFileSink &operator=(const ParallelFileSink &) = delete;
+
+    /**
+     * @brief Move constructor.
+     */
+    ParallelFileSink(ParallelFileSink &&other) noexcept
+        : m_state(std::move(other.m_state)), m_buffer(std::move(other.m_buffer)), m_allocSize(other.m_allocSize),
+          m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    /**
+     * @brief Destructor, which writes out anything still buffered.  Errors
+     *        are lost, so call LexFlush first if they matter.
+     */
+    ~ParallelFileSink() { Detach(); }
+
+    /**
+     * @brief Move assignment operator.
+     */
+    ParallelFileSink &operator=(ParallelFileSink &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Detach();
+        m_state = std::move(other.m_state);
+        m_buffer = std::move(other.m_buffer);
+        m_allocSize = other.m_allocSize;
+        m_size = std::exchange(other.m_size, 0);
+        return *this;
+    }
+
+    /**
+     * @brief Write out anything still buffered and stop counting as one of
+     *        the writer's sinks, like the destructor does.  Errors are lost,
+     *        so call LexFlush first if they matter.
+     */
+    void Detach() noexcept
+    {
+        if (m_state == nullptr)
+        {
+            return;
+        }
+
+        LEXIO_TRY
+        {
+            FlushBuffer();
+        }
+        LEXIO_CATCH_ALL
+        {
+        }
+        m_state->sinks.fetch_sub(1, std::memory_order_release);
+        m_state.reset();
+    }
+
+    /**
+     * @brief Reserve a range for the buffered data and write it out.  The
+     *        buffer is emptied either way, so on failure its contents are
+     *        lost and the range they reserved is left as a gap.
+     *
+     * @throws POSIXError if the write failed.
+     */
+    void FlushBuffer()
+    {
+        if (m_size != 0)
+        {
+            const size_t size = std::exchange(m_size, 0);
+            WriteRange(m_buffer.get(), size);
+        }
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        if (m_state == nullptr)
+        {
+            LEXIO_THROW(std::runtime_error("sink is not attached to a writer"));
+        }
+
+        if (m_size + count > m_allocSize)
+        {
+            FlushBuffer();
+            if (count > m_allocSize)
+            {
+                // Too large to buffer, give it a range of its own.
+                WriteRange(src, count);
+                return count;
+            }
+        }
+
+        std::memcpy(m_buffer.get() + m_size, src, count);
+        m_size += count;
+        return count;
     }
-    return size_t(st.st_size);
-}
+
+    void LexFlush() { FlushBuffer(); }
+};
 
 /**
- * @brief On UNIX, File is a FilePOSIX.
+ * @brief Lets many threads write to one file at once, each through its own
+ *        buffered sink, without serializing on a shared buffer or offset.
+ *
+ * @detail Sinks claim ranges of the file by atomically advancing a shared
+ *         tail offset, then write their buffers into those ranges with
+ *         pwrite(2) independently of each other.  Meant for output where
+ *         each write is a self-contained record and the order of records
+ *         doesn't matter.  Close truncates the file to the reserved length,
+ *         in case it was longer to begin with.
+ *
+ *         Every sink must be destroyed before the writer is closed.  Sinks
+ *         share ownership of the file, so one that outlives the writer
+ *         keeps the file open, but the file is then neither truncated nor
+ *         flushed.
  */
-using File = FilePOSIX;
+class ParallelFileWriter
+{
+    std::shared_ptr<Detail::ParallelFileState> m_state;
+
+  public:
+    static constexpr size_t DEFAULT_SINK_SIZE = 1024 * 1024;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param file File to write to.
+     * @param start Offset to start writing at.
+     */
+    ParallelFileWriter(FilePOSIX &&file, size_t start = 0)
+        : m_state(std::make_shared<Detail::ParallelFileState>(std::move(file), start))
+    {
+    }
+
+    ParallelFileWriter(const ParallelFileWriter &) = delete;
+    ParallelFileWriter &operator=(const ParallelFileWriter &) = delete;
+
+    /**
+     * @brief Destructor, which finalizes the file if Close wasn't called.
+     */
+    ~ParallelFileWriter()
+    {
+        LEXIO_TRY
+        {
+            Close();
+        }
+        LEXIO_CATCH_ALL
+        {
+        }
+    }
+
+    /**
+     * @brief Create a sink for one thread to write through.
+     *
+     * @param bufSize Size of the sink's buffer, which is also the size of
+     *                most ranges it reserves.
+     */
+    ParallelFileSink Sink(size_t bufSize = DEFAULT_SINK_SIZE)
+    {
+        return ParallelFileSink{m_state, bufSize};
+    }
+
+    /**
+     * @brief Reserve a range of the file directly, for callers that want to
+     *        fill it with their own positional writes.
+     *
+     * @param count Size of the range in bytes.
+     * @return Offset of the start of the range.
+     */
+    size_t ReserveRange(size_t count) { return m_state->tail.fetch_add(count, std::memory_order_relaxed); }
+
+    /**
+     * @brief Return the offset of the end of everything reserved so far.
+     */
+    size_t Tail() const { return m_state->tail.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Return the underlying file.
+     */
+    const FilePOSIX &File() const { return m_state->file; }
+
+    /**
+     * @brief Truncate the file to the reserved length, flush it according to
+     *        its SyncPolicy, and close it.
+     *
+     * @throws std::runtime_error if any sinks are still alive, in which
+     *         case nothing is done, or if any sink failed to write a range
+     *         it reserved, in which case the file is closed as it is.
+     * @throws POSIXError if any of the steps failed.
+     */
+    void Close()
+    {
+        FilePOSIX &file = m_state->file;
+        if (file.FileHandle() == -1)
+        {
+            return;
+        }
+        else if (m_state->sinks.load(std::memory_order_acquire) != 0)
+        {
+            LEXIO_THROW(std::runtime_error("can't close while sinks are still alive"));
+        }
+        else if (m_state->failed.load(std::memory_order_relaxed))
+        {
+            file.Close();
+            LEXIO_THROW(std::runtime_error("a sink failed to write its range, the file has gaps"));
+        }
+
+        file.Truncate(Tail());
+        file.LexFlush();
+        file.Close();
+    }
+};
 
 } // namespace LexIO
 
@@ -0,0 +1,505 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+/**
+ * @file pipe.hpp
+ * @brief An in-process pipe between one writing and one reading thread.
+ */
+
+#pragma once
+
+#include "./file.hpp"
+
+#if defined(__linux__)
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#include <atomic>
+#include <climits>
+#include <memory>
+
+namespace LexIO
+{
+
+namespace Detail
+{
+
+/**
+ * @brief Hint to the CPU that we're in a spin loop.
+ */
+inline void CpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief Ring buffer shared by the two ends of a pipe.
+ *
+ * @detail The ring is mapped twice, back to back, so any range of up to
+ *         its capacity starting inside the first mapping is contiguous in
+ *         memory, even if it wraps around the end of the ring.
+ *
+ *         The read and write positions only ever increase, and each is
+ *         written by one side only.  A side that has to wait spins for a
+ *         while, then announces itself and sleeps on a futex, which the
+ *         other side only pays to wake when someone is asleep.
+ */
+class PipeRing
+{
+    static constexpr int SPIN_COUNT = 256;
+
+    uint8_t *m_base = nullptr;
+    size_t m_capacity = 0;
+
+    alignas(64) std::atomic<uint64_t> m_head{0};
+    alignas(64) std::atomic<uint64_t> m_tail{0};
+
+    alignas(64) std::atomic<uint32_t> m_dataSeq{0};
+    std::atomic<uint32_t> m_readerWaiting{0};
+    std::atomic<uint32_t> m_spaceSeq{0};
+    std::atomic<uint32_t> m_writerWaiting{0};
+
+    std::atomic<bool> m_writerClosed{false};
+    std::atomic<bool> m_readerClosed{false};
+
+    static void FutexWait(std::atomic<uint32_t> &word, uint32_t value) noexcept
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+    }
+
+    static void FutexWake(std::atomic<uint32_t> &word) noexcept
+    {
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    /**
+     * @brief Wait until a condition holds, spinning before going to sleep.
+     */
+    template <typename COND>
+    static void Wait(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiting, COND cond)
+    {
+        for (int i = 0; i < SPIN_COUNT; i++)
+        {
+            if (cond())
+            {
+                return;
+            }
+            CpuRelax();
+        }
+
+        // The other side checks the waiting flag after publishing, and we
+        // check the condition after setting it, so one of us sees the
+        // other.  The sequence number catches a wake that comes between
+        // the check and the sleep.
+        while (!cond())
+        {
+            waiting.store(1);
+            const uint32_t value = seq.load();
+            if (!cond())
+            {
+                FutexWait(seq, value);
+            }
+            waiting.store(0);
+        }
+    }
+
+    /**
+     * @brief Wake the other side if it's asleep.
+     */
+    static void Wake(std::atomic<uint32_t> &seq, std::atomic<uint32_t> &waiting) noexcept
+    {
+        if (waiting.load() != 0)
+        {
+            seq.fetch_add(1);
+            FutexWake(seq);
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructor, which maps the ring.
+     *
+     * @param capacity Capacity in bytes, rounded up to a whole number of
+     *                 pages.
+     * @throws POSIXError if the ring couldn't be mapped.
+     */
+    PipeRing(size_t capacity)
+    {
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        m_capacity = Detail::Max<size_t>(1, (capacity + pageSize - 1) / pageSize) * pageSize;
+
+        const int fd = static_cast<int>(syscall(SYS_memfd_create, "lexio-pipe", 0));
+        if (fd == -1)
+        {
+            LEXIO_THROW(POSIXError("Could not create pipe memory.", errno));
+        }
+        else if (ftruncate(fd, static_cast<off_t>(m_capacity)) == -1)
+        {
+            const int err = errno;
+            close(fd);
+            errno = err;
+            LEXIO_THROW(POSIXError("Could not size pipe memory.", errno));
+        }
+
+        // Reserve room for both copies, then map the memory over each half.
+        void *base = mmap(nullptr, m_capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+        {
+            const int err = errno;
+            close(fd);
+            errno = err;
+            LEXIO_THROW(POSIXError("Could not map pipe memory.", errno));
+        }
+
+        uint8_t *bytes = static_cast<uint8_t *>(base);
+        for (uint8_t *half : {bytes, bytes + m_capacity})
+        {
+            if (mmap(half, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+            {
+                const int err = errno;
+                munmap(base, m_capacity * 2);
+                close(fd);
+                errno = err;
+                LEXIO_THROW(POSIXError("Could not map pipe memory.", errno));
+            }
+        }
+
+        // The mappings keep the memory alive.
+        close(fd);
+        m_base = bytes;
+    }
+
+    PipeRing(const PipeRing &) = delete;
+    PipeRing &operator=(const PipeRing &) = delete;
+
+    ~PipeRing()
+    {
+        if (m_base != nullptr)
+        {
+            munmap(m_base, m_capacity * 2);
+        }
+    }
+
+    size_t Capacity() const noexcept { return m_capacity; }
+
+    /**
+     * @brief Wait for at least count bytes of free space, or for the reader
+     *        to go away.
+     *
+     * @return Contiguous view of all free space.
+     * @throws std::runtime_error if the reader end was closed.
+     */
+    MutableBufferView WaitForSpace(size_t count)
+    {
+        const uint64_t head = m_head.load(std::memory_order_relaxed);
+        Wait(m_spaceSeq, m_writerWaiting, [&] {
+            return m_capacity - (head - m_tail.load(std::memory_order_acquire)) >= count ||
+                   m_readerClosed.load(std::memory_order_acquire);
+        });
+        if (m_readerClosed.load(std::memory_order_acquire))
+        {
+            LEXIO_THROW(std::runtime_error("pipe reader was closed"));
+        }
+
+        const size_t used = static_cast<size_t>(head - m_tail.load(std::memory_order_acquire));
+        return MutableBufferView{m_base + head % m_capacity, m_capacity - used};
+    }
+
+    /**
+     * @brief Make count bytes written into free space visible to the
+     *        reader.
+     */
+    void Publish(size_t count)
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + count);
+        Wake(m_dataSeq, m_readerWaiting);
+    }
+
+    /**
+     * @brief Wait for at least count bytes of data, or for the writer to go
+     *        away.
+     *
+     * @return Contiguous view of all readable data.
+     */
+    BufferView WaitForData(size_t count)
+    {
+        const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        Wait(m_dataSeq, m_readerWaiting, [&] {
+            return m_head.load(std::memory_order_acquire) - tail >= count ||
+                   m_writerClosed.load(std::memory_order_acquire);
+        });
+
+        // Data published before the writer closed is still there.
+        const size_t size = static_cast<size_t>(m_head.load(std::memory_order_acquire) - tail);
+        return BufferView{m_base + tail % m_capacity, size};
+    }
+
+    /**
+     * @brief Give count bytes of read data back to the writer.
+     */
+    void Release(size_t count)
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + count);
+        Wake(m_spaceSeq, m_writerWaiting);
+    }
+
+    /**
+     * @brief Signal EOF to the reader.
+     */
+    void CloseWriter() noexcept
+    {
+        m_writerClosed.store(true);
+        m_dataSeq.fetch_add(1);
+        FutexWake(m_dataSeq);
+    }
+
+    /**
+     * @brief Make further writes fail.
+     */
+    void CloseReader() noexcept
+    {
+        m_readerClosed.store(true);
+        m_spaceSeq.fetch_add(1);
+        FutexWake(m_spaceSeq);
+    }
+};
+
+} // namespace Detail
+
+/**
+ * @brief The writing end of an in-process pipe.  Can be used by one thread
+ *        at a time.
+ *
+ * @detail Writes block while the pipe is full, and throw once the reading
+ *         end has been closed.  Reserve and Commit write straight into the
+ *         pipe's memory.
+ */
+class PipeWriter
+{
+    std::shared_ptr<Detail::PipeRing> m_ring;
+    size_t m_reserved = 0;
+
+  public:
+    PipeWriter() = default;
+    PipeWriter(const std::shared_ptr<Detail::PipeRing> &ring) : m_ring(ring) {}
+    PipeWriter(const PipeWriter &) = delete;
+    PipeWriter(PipeWriter &&other) noexcept = default;
+    PipeWriter &operator=(const PipeWriter &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     */
+    PipeWriter &operator=(PipeWriter &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Close();
+        m_ring = std::move(other.m_ring);
+        m_reserved = other.m_reserved;
+        return *this;
+    }
+
+    /**
+     * @brief Destructor, which closes the writing end.
+     */
+    ~PipeWriter() { Close(); }
+
+    /**
+     * @brief Close the writing end, after which the reader sees EOF once it
+     *        has read everything that was written.
+     */
+    void Close() noexcept
+    {
+        if (m_ring != nullptr)
+        {
+            m_ring->CloseWriter();
+            m_ring.reset();
+        }
+    }
+
+    /**
+     * @brief Return the capacity of the pipe in bytes.
+     */
+    size_t Capacity() const { return m_ring->Capacity(); }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        size_t written = 0;
+        while (written != count)
+        {
+            // Take whatever space there is rather than waiting for all of it.
+            const MutableBufferView space = m_ring->WaitForSpace(1);
+            const size_t chunk = Detail::Min(count - written, space.Size());
+            std::memcpy(space.Data(), src + written, chunk);
+            m_ring->Publish(chunk);
+            written += chunk;
+        }
+        return count;
+    }
+
+    MutableBufferView LexReserve(size_t count)
+    {
+        if (count > Capacity())
+        {
+            LEXIO_THROW(std::runtime_error("can't reserve more bytes than pipe capacity"));
+        }
+
+        const MutableBufferView space = m_ring->WaitForSpace(count);
+        m_reserved = space.Size();
+        return space;
+    }
+
+    void LexCommit(size_t count)
+    {
+        if (count > m_reserved)
+        {
+            LEXIO_THROW(std::runtime_error("can't commit more bytes than were reserved"));
+        }
+
+        m_reserved -= count;
+        m_ring->Publish(count);
+    }
+
+    void LexFlush() {}
+};
+
+/**
+ * @brief The reading end of an in-process pipe.  Can be used by one thread
+ *        at a time.
+ *
+ * @detail LexFillBuffer returns a view directly into the pipe's memory,
+ *         contiguous even across the end of the ring, so reads involve no
+ *         copies.  Reads block while the pipe is empty, and return EOF once
+ *         the writing end has been closed and drained.
+ */
+class PipeReader
+{
+    std::shared_ptr<Detail::PipeRing> m_ring;
+    size_t m_buffered = 0;
+
+  public:
+    PipeReader() = default;
+    PipeReader(const std::shared_ptr<Detail::PipeRing> &ring) : m_ring(ring) {}
+    PipeReader(const PipeReader &) = delete;
+    PipeReader(PipeReader &&other) noexcept = default;
+    PipeReader &operator=(const PipeReader &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     */
+    PipeReader &operator=(PipeReader &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        Close();
+        m_ring = std::move(other.m_ring);
+        m_buffered = other.m_buffered;
+        return *this;
+    }
+
+    /**
+     * @brief Destructor, which closes the reading end.
+     */
+    ~PipeReader() { Close(); }
+
+    /**
+     * @brief Close the reading end, after which writes throw.
+     */
+    void Close() noexcept
+    {
+        if (m_ring != nullptr)
+        {
+            m_ring->CloseReader();
+            m_ring.reset();
+        }
+    }
+
+    /**
+     * @brief Return the capacity of the pipe in bytes.
+     */
+    size_t Capacity() const { return m_ring->Capacity(); }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        const BufferView data = LexFillBuffer(count != 0 ? 1 : 0);
+        const size_t actualSize = Detail::Min(count, data.Size());
+        std::memcpy(outDest, data.Data(), actualSize);
+        LexConsumeBuffer(actualSize);
+        return actualSize;
+    }
+
+    BufferView LexFillBuffer(size_t count)
+    {
+        if (count > Capacity())
+        {
+            LEXIO_THROW(std::runtime_error("can't fill buffer past pipe capacity"));
+        }
+
+        const BufferView data = m_ring->WaitForData(count);
+        m_buffered = data.Size();
+        return data;
+    }
+
+    void LexConsumeBuffer(size_t count)
+    {
+        if (count > m_buffered)
+        {
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
+        }
+
+        m_buffered -= count;
+        m_ring->Release(count);
+    }
+};
+
+/**
+ * @brief The two ends of a pipe created with PipeOpen.
+ */
+struct Pipe
+{
+    PipeWriter writer;
+    PipeReader reader;
+};
+
+/**
+ * @brief Create an in-process pipe for passing a stream of bytes from one
+ *        thread to another.
+ *
+ * @param capacity Capacity of the pipe in bytes, rounded up to a whole
+ *                 number of pages.
+ * @return Both ends of the pipe.
+ * @throws POSIXError if the pipe's memory couldn't be mapped.
+ */
+inline Pipe PipeOpen(size_t capacity = 1024 * 1024)
+{
+    auto ring = std::make_shared<Detail::PipeRing>(capacity);
+    return Pipe{PipeWriter{ring}, PipeReader{ring}};
+}
+
+} // namespace LexIO
+
+#endif
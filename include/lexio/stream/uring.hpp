@@ -0,0 +1,872 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+/**
+ * @file uring.hpp
+ * @brief A Linux file stream that does its I/O through io_uring.
+ */
+
+#pragma once
+
+#include "./file.hpp"
+
+#if defined(__linux__)
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace LexIO
+{
+
+/**
+ * @brief The result of a queued IoUringFile operation.
+ */
+struct IoUringCompletion
+{
+    // User data that was passed when the operation was queued.
+    uint64_t userData = 0;
+
+    // Number of bytes transferred, or a negated errno on failure.
+    int32_t result = 0;
+};
+
+namespace Detail
+{
+
+/**
+ * @brief Owns an io_uring instance and its shared ring mappings, talking to
+ *        the kernel with raw system calls.
+ */
+class IoUring
+{
+    int m_ringFd = -1;
+    void *m_sqRing = MAP_FAILED;
+    size_t m_sqRingSize = 0;
+    void *m_cqRing = MAP_FAILED;
+    size_t m_cqRingSize = 0;
+    io_uring_sqe *m_sqes = nullptr;
+    size_t m_sqesSize = 0;
+
+    unsigned *m_sqHead = nullptr;
+    unsigned *m_sqTail = nullptr;
+    unsigned *m_sqArray = nullptr;
+    unsigned m_sqMask = 0;
+    unsigned m_sqEntries = 0;
+
+    unsigned *m_cqHead = nullptr;
+    unsigned *m_cqTail = nullptr;
+    io_uring_cqe *m_cqes = nullptr;
+    unsigned m_cqMask = 0;
+
+    // Entries that have been published to the ring but not yet submitted.
+    unsigned m_toSubmit = 0;
+
+    void Destroy() noexcept
+    {
+        if (m_sqes != nullptr)
+        {
+            munmap(m_sqes, m_sqesSize);
+            m_sqes = nullptr;
+        }
+        if (m_cqRing != MAP_FAILED)
+        {
+            munmap(m_cqRing, m_cqRingSize);
+            m_cqRing = MAP_FAILED;
+        }
+        if (m_sqRing != MAP_FAILED)
+        {
+            munmap(m_sqRing, m_sqRingSize);
+            m_sqRing = MAP_FAILED;
+        }
+        if (m_ringFd != -1)
+        {
+            close(m_ringFd);
+            m_ringFd = -1;
+        }
+    }
+
+    void Swap(IoUring &other) noexcept
+    {
+        std::swap(m_ringFd, other.m_ringFd);
+        std::swap(m_sqRing, other.m_sqRing);
+        std::swap(m_sqRingSize, other.m_sqRingSize);
+        std::swap(m_cqRing, other.m_cqRing);
+        std::swap(m_cqRingSize, other.m_cqRingSize);
+        std::swap(m_sqes, other.m_sqes);
+        std::swap(m_sqesSize, other.m_sqesSize);
+        std::swap(m_sqHead, other.m_sqHead);
+        std::swap(m_sqTail, other.m_sqTail);
+        std::swap(m_sqArray, other.m_sqArray);
+        std::swap(m_sqMask, other.m_sqMask);
+        std::swap(m_sqEntries, other.m_sqEntries);
+        std::swap(m_cqHead, other.m_cqHead);
+        std::swap(m_cqTail, other.m_cqTail);
+        std::swap(m_cqes, other.m_cqes);
+        std::swap(m_cqMask, other.m_cqMask);
+        std::swap(m_toSubmit, other.m_toSubmit);
+    }
+
+    template <typename T>
+    static T *RingPtr(void *ring, size_t offset) noexcept
+    {
+        return reinterpret_cast<T *>(static_cast<uint8_t *>(ring) + offset);
+    }
+
+  public:
+    IoUring() = default;
+    IoUring(const IoUring &) = delete;
+    IoUring &operator=(const IoUring &) = delete;
+    IoUring(IoUring &&other) noexcept { Swap(other); }
+    IoUring &operator=(IoUring &&other) noexcept
+    {
+        Swap(other);
+        return *this;
+    }
+    ~IoUring() { Destroy(); }
+
+    /**
+     * @brief Set up a ring and map its submission and completion queues.
+     *
+     * @param entries Minimum number of submission queue entries.
+     * @return Error with the errno of the failed call, if any.
+     */
+    Error TryInit(unsigned entries) noexcept
+    {
+        Destroy();
+
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        const long fd = syscall(__NR_io_uring_setup, entries, &params);
+        if (fd < 0)
+        {
+            return Error{"Could not set up io_uring.", errno};
+        }
+        m_ringFd = static_cast<int>(fd);
+
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+                        IORING_OFF_SQ_RING);
+        if (m_sqRing == MAP_FAILED)
+        {
+            const int err = errno;
+            Destroy();
+            return Error{"Could not map io_uring.", err};
+        }
+
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+                        IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED)
+        {
+            const int err = errno;
+            Destroy();
+            return Error{"Could not map io_uring.", err};
+        }
+
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void *sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+                          IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            const int err = errno;
+            Destroy();
+            return Error{"Could not map io_uring.", err};
+        }
+        m_sqes = static_cast<io_uring_sqe *>(sqes);
+
+        m_sqHead = RingPtr<unsigned>(m_sqRing, params.sq_off.head);
+        m_sqTail = RingPtr<unsigned>(m_sqRing, params.sq_off.tail);
+        m_sqArray = RingPtr<unsigned>(m_sqRing, params.sq_off.array);
+        m_sqMask = *RingPtr<unsigned>(m_sqRing, params.sq_off.ring_mask);
+        m_sqEntries = params.sq_entries;
+
+        m_cqHead = RingPtr<unsigned>(m_cqRing, params.cq_off.head);
+        m_cqTail = RingPtr<unsigned>(m_cqRing, params.cq_off.tail);
+        m_cqes = RingPtr<io_uring_cqe>(m_cqRing, params.cq_off.cqes);
+        m_cqMask = *RingPtr<unsigned>(m_cqRing, params.cq_off.ring_mask);
+
+        m_toSubmit = 0;
+        return Error{};
+    }
+
+    /**
+     * @brief Return a cleared submission queue entry, or nullptr if the
+     *        queue is full.  The entry must be passed to Publish once it
+     *        is filled in.
+     */
+    io_uring_sqe *NextEntry() noexcept
+    {
+        const unsigned head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        const unsigned tail = *m_sqTail;
+        if (tail - head >= m_sqEntries)
+        {
+            return nullptr;
+        }
+
+        io_uring_sqe *sqe = &m_sqes[tail & m_sqMask];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    /**
+     * @brief Make the entry returned by the last call to NextEntry visible
+     *        to the kernel on the next submission.
+     */
+    void Publish() noexcept
+    {
+        const unsigned tail = *m_sqTail;
+        m_sqArray[tail & m_sqMask] = tail & m_sqMask;
+        __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+        m_toSubmit += 1;
+    }
+
+    /**
+     * @brief Take back the entry published last, if the kernel hasn't
+     *        consumed it yet.
+     *
+     * @return True if the entry was taken back, false if it was already
+     *         submitted.
+     */
+    bool Unpublish() noexcept
+    {
+        if (m_toSubmit == 0)
+        {
+            return false;
+        }
+
+        // The kernel consumes entries in order, so with anything left to
+        // submit the last entry is still ours.
+        __atomic_store_n(m_sqTail, *m_sqTail - 1, __ATOMIC_RELEASE);
+        m_toSubmit -= 1;
+        return true;
+    }
+
+    /**
+     * @brief Submit published entries and optionally wait for completions.
+     *
+     * @param outSubmitted Number of entries the kernel consumed.
+     * @param minComplete Number of completions to wait for, or 0.
+     * @return Error with the errno of the failed call, if any.
+     */
+    Error TryEnter(unsigned &outSubmitted, unsigned minComplete) noexcept
+    {
+        const unsigned flags = minComplete != 0 ? IORING_ENTER_GETEVENTS : 0;
+
+        long submitted = 0;
+        do
+        {
+            submitted = syscall(__NR_io_uring_enter, m_ringFd, m_toSubmit, minComplete, flags, nullptr, 0);
+        } while (submitted == -1 && errno == EINTR);
+
+        if (submitted == -1)
+        {
+            outSubmitted = 0;
+            return Error{"Could not submit to io_uring.", errno};
+        }
+
+        outSubmitted = static_cast<unsigned>(submitted);
+        m_toSubmit -= outSubmitted;
+        return Error{};
+    }
+
+    /**
+     * @brief Pop one completion off of the completion queue.
+     *
+     * @return True if a completion was popped, false if the queue is empty.
+     */
+    bool PopCompletion(IoUringCompletion &outCompletion) noexcept
+    {
+        const unsigned head = *m_cqHead;
+        if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+        {
+            return false;
+        }
+
+        const io_uring_cqe &cqe = m_cqes[head & m_cqMask];
+        outCompletion.userData = cqe.user_data;
+        outCompletion.result = cqe.res;
+        __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     * @brief Call io_uring_register(2) on the ring.
+     */
+    Error TryRegister(unsigned opcode, const void *arg, unsigned count) noexcept
+    {
+        if (syscall(__NR_io_uring_register, m_ringFd, opcode, arg, count) < 0)
+        {
+            return Error{"Could not register with io_uring.", errno};
+        }
+        return Error{};
+    }
+
+    unsigned PendingSubmissions() const noexcept { return m_toSubmit; }
+};
+
+} // namespace Detail
+
+/**
+ * @brief A file stream that does its I/O through an io_uring owned by the
+ *        stream.
+ *
+ * @detail The file is registered with the ring, so no operation pays for a
+ *         file table lookup.  On top of the usual Reader, Writer, and
+ *         Seekable methods, operations can be queued with QueueRead and
+ *         QueueWrite, submitted together with Submit, and collected with
+ *         Reap.  Buffers registered with RegisterBuffers can be used by the
+ *         Fixed variants of the queue methods, which skips pinning their
+ *         pages on every operation.
+ *
+ *         The cursor is tracked in user space, and the offset of the file
+ *         descriptor is never used.  Positional reads and writes use
+ *         pread(2) and pwrite(2), since the ring must not be shared between
+ *         threads.
+ */
+class IoUringFile
+{
+    FilePOSIX m_file;
+    Detail::IoUring m_ring;
+    size_t m_offset = 0;
+    bool m_append = false;
+    bool m_buffersRegistered = false;
+
+    // Completions of queued operations that were popped while waiting for
+    // a synchronous operation to finish.
+    std::vector<IoUringCompletion> m_completions;
+
+    // User data of the last synchronous operation, each one gets its own
+    // value so a stale completion is never mistaken for a newer one.
+    uint64_t m_syncUserData = UINT64_MAX;
+
+    IoUringFile(FilePOSIX &&file) : m_file(std::move(file)) {}
+
+    /**
+     * @brief Get the next free submission entry, submitting what's queued
+     *        if the queue is full.
+     */
+    Error TryNextEntry(io_uring_sqe *&outEntry) noexcept
+    {
+        outEntry = m_ring.NextEntry();
+        if (outEntry == nullptr)
+        {
+            unsigned submitted = 0;
+            const Error err = m_ring.TryEnter(submitted, 0);
+            if (err)
+            {
+                return err;
+            }
+
+            outEntry = m_ring.NextEntry();
+            if (outEntry == nullptr)
+            {
+                return Error{"io_uring submission queue is full.", EBUSY};
+            }
+        }
+        return Error{};
+    }
+
+    static void PrepareEntry(io_uring_sqe &sqe, uint8_t opcode, const uint8_t *buffer, size_t count, size_t offset,
+                             uint64_t userData) noexcept
+    {
+        sqe.opcode = opcode;
+        sqe.flags = IOSQE_FIXED_FILE;
+        sqe.fd = 0;
+        sqe.off = offset;
+        sqe.addr = reinterpret_cast<uintptr_t>(buffer);
+        sqe.len = static_cast<uint32_t>(std::min<size_t>(count, UINT32_MAX));
+        sqe.user_data = userData;
+    }
+
+    /**
+     * @brief Run one operation on the ring and wait for its result.
+     *
+     * @param outResult Result of the operation, a negated errno on failure.
+     */
+    Error TryRunOne(int32_t &outResult, uint8_t opcode, const uint8_t *buffer, size_t count, size_t offset,
+                    uint8_t extraFlags) noexcept
+    {
+        io_uring_sqe *sqe = nullptr;
+        Error err = TryNextEntry(sqe);
+        if (err)
+        {
+            return err;
+        }
+
+        m_syncUserData = m_syncUserData == UINT64_MAX ? RESERVED_USER_DATA : m_syncUserData + 1;
+        PrepareEntry(*sqe, opcode, buffer, count, offset, m_syncUserData);
+        sqe->flags |= extraFlags;
+        m_ring.Publish();
+
+        for (;;)
+        {
+            unsigned submitted = 0;
+            err = m_ring.TryEnter(submitted, 1);
+            if (err)
+            {
+                // Don't leave an entry pointing at the caller's buffer in
+                // the queue.  If the kernel already has it, its completion
+                // is dropped once it shows up.
+                m_ring.Unpublish();
+                return err;
+            }
+
+            IoUringCompletion completion;
+            while (m_ring.PopCompletion(completion))
+            {
+                if (completion.userData == m_syncUserData)
+                {
+                    outResult = completion.result;
+                    return Error{};
+                }
+                else if (completion.userData < RESERVED_USER_DATA)
+                {
+                    m_completions.push_back(completion);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Pop the next completion of a queued operation, dropping those
+     *        of synchronous operations that gave up on waiting.
+     */
+    bool PopQueuedCompletion(IoUringCompletion &outCompletion) noexcept
+    {
+        while (m_ring.PopCompletion(outCompletion))
+        {
+            if (outCompletion.userData < RESERVED_USER_DATA)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Queue(uint8_t opcode, const uint8_t *buffer, size_t count, size_t offset, uint64_t userData, int bufIndex)
+    {
+        if (userData >= RESERVED_USER_DATA)
+        {
+            LEXIO_THROW(std::runtime_error("User data is reserved."));
+        }
+
+        io_uring_sqe *sqe = nullptr;
+        const Error err = TryNextEntry(sqe);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+
+        PrepareEntry(*sqe, opcode, buffer, count, offset, userData);
+        if (bufIndex >= 0)
+        {
+            sqe->buf_index = static_cast<uint16_t>(bufIndex);
+        }
+        m_ring.Publish();
+    }
+
+  public:
+    /**
+     * @brief First user data value of the range used internally.  This
+     *        value and anything above it must not be passed to the queue
+     *        methods.
+     */
+    static constexpr uint64_t RESERVED_USER_DATA = UINT64_C(1) << 63;
+
+    /**
+     * @brief Default number of submission queue entries.
+     */
+    static constexpr unsigned DEFAULT_ENTRIES = 64;
+
+    IoUringFile() = default;
+    IoUringFile(const IoUringFile &) = delete;
+    IoUringFile &operator=(const IoUringFile &) = delete;
+    IoUringFile(IoUringFile &&other) noexcept = default;
+    IoUringFile &operator=(IoUringFile &&other) noexcept = default;
+
+    /**
+     * @brief Open a file and set up a ring for it.
+     *
+     * @param path Path to filename, assumed to be a null-terminated string.
+     * @param flags flags to pass to open(2) call.
+     * @param mode mode to pass to open(2) call.
+     * @param entries Minimum number of operations that can be queued before
+     *                they are submitted.
+     * @return A constructed IoUringFile object.
+     * @throws POSIXError if the file couldn't be opened or io_uring is not
+     *         available.
+     */
+    static IoUringFile Open(const char *path, const int flags, mode_t mode, unsigned entries = DEFAULT_ENTRIES)
+    {
+        IoUringFile file{FilePOSIX::Open(path, flags, mode)};
+        file.m_append = (flags & O_APPEND) != 0;
+
+        Error err = file.m_ring.TryInit(entries);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+
+        const int fd = file.m_file.FileHandle();
+        err = file.m_ring.TryRegister(IORING_REGISTER_FILES, &fd, 1);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+
+        return file;
+    }
+
+    /**
+     * @brief Return the internal fd.  Its offset is not kept in sync with
+     *        the stream.
+     */
+    int FileHandle() const noexcept { return m_file.FileHandle(); }
+
+    /**
+     * @brief Register buffers with the ring for use with QueueReadFixed and
+     *        QueueWriteFixed, replacing any buffers registered before.
+     *
+     * @param bufs Buffers to register.  Their pages are pinned until the
+     *             buffers are replaced or the stream is destroyed.
+     * @param count Number of buffers.
+     * @throws POSIXError if registration failed, for example because the
+     *         buffers exceed RLIMIT_MEMLOCK.
+     */
+    void RegisterBuffers(const MutableBufferView *bufs, size_t count)
+    {
+        if (m_buffersRegistered)
+        {
+            const Error err = m_ring.TryRegister(IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            if (err)
+            {
+                LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+            }
+            m_buffersRegistered = false;
+        }
+
+        std::vector<iovec> iov(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            iov[i].iov_base = bufs[i].Data();
+            iov[i].iov_len = bufs[i].Size();
+        }
+
+        const Error err = m_ring.TryRegister(IORING_REGISTER_BUFFERS, iov.data(), static_cast<unsigned>(count));
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        m_buffersRegistered = true;
+    }
+
+    /**
+     * @brief Queue a read at an absolute offset.  Nothing is sent to the
+     *        kernel until Submit or Reap is called, or the queue fills up.
+     *
+     * @param outDest Destination buffer, which must stay valid until the
+     *                completion is reaped.
+     * @param count Number of bytes to read.
+     * @param offset Offset to read from.
+     * @param userData Value to identify the completion by.
+     * @throws POSIXError if the queue was full and submitting it failed.
+     */
+    void QueueRead(uint8_t *outDest, size_t count, size_t offset, uint64_t userData)
+    {
+        Queue(IORING_OP_READ, outDest, count, offset, userData, -1);
+    }
+
+    /**
+     * @brief Queue a write at an absolute offset.  Same rules as QueueRead.
+     */
+    void QueueWrite(const uint8_t *src, size_t count, size_t offset, uint64_t userData)
+    {
+        Queue(IORING_OP_WRITE, src, count, offset, userData, -1);
+    }
+
+    /**
+     * @brief Queue a read into a registered buffer.
+     *
+     * @param bufIndex Index of the buffer passed to RegisterBuffers.
+     *                 outDest and count must lie within that buffer.
+     */
+    void QueueReadFixed(uint8_t *outDest, size_t count, size_t offset, unsigned bufIndex, uint64_t userData)
+    {
+        Queue(IORING_OP_READ_FIXED, outDest, count, offset, userData, static_cast<int>(bufIndex));
+    }
+
+    /**
+     * @brief Queue a write from a registered buffer.
+     *
+     * @param bufIndex Index of the buffer passed to RegisterBuffers.  src
+     *                 and count must lie within that buffer.
+     */
+    void QueueWriteFixed(const uint8_t *src, size_t count, size_t offset, unsigned bufIndex, uint64_t userData)
+    {
+        Queue(IORING_OP_WRITE_FIXED, src, count, offset, userData, static_cast<int>(bufIndex));
+    }
+
+    /**
+     * @brief Submit all queued operations with a single system call.
+     *
+     * @return Number of operations submitted.
+     * @throws POSIXError if submission failed.
+     */
+    size_t Submit()
+    {
+        unsigned submitted = 0;
+        const Error err = m_ring.TryEnter(submitted, 0);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        return submitted;
+    }
+
+    /**
+     * @brief Collect completions of queued operations, submitting anything
+     *        still queued.
+     *
+     * @param outCompletions Array to store completions in.
+     * @param count Size of the array.
+     * @param minComplete Number of completions to wait for before
+     *                    returning.  Must not exceed the number of
+     *                    operations in flight.
+     * @return Number of completions stored, at least minComplete.
+     * @throws POSIXError if submitting or waiting failed.
+     */
+    size_t Reap(IoUringCompletion *outCompletions, size_t count, size_t minComplete = 0)
+    {
+        minComplete = std::min(minComplete, count);
+
+        size_t reaped = std::min(count, m_completions.size());
+        std::copy(m_completions.begin(), m_completions.begin() + reaped, outCompletions);
+        m_completions.erase(m_completions.begin(), m_completions.begin() + reaped);
+
+        for (;;)
+        {
+            while (reaped < count && PopQueuedCompletion(outCompletions[reaped]))
+            {
+                reaped += 1;
+            }
+
+            if (reaped >= minComplete && m_ring.PendingSubmissions() == 0)
+            {
+                return reaped;
+            }
+
+            unsigned submitted = 0;
+            const unsigned wait = static_cast<unsigned>(minComplete > reaped ? minComplete - reaped : 0);
+            const Error err = m_ring.TryEnter(submitted, wait);
+            if (err)
+            {
+                LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+            }
+        }
+    }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        size_t bytesRead = 0;
+        const Error err = LexTryRead(bytesRead, outDest, count);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        return bytesRead;
+    }
+
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count) noexcept
+    {
+        outRead = 0;
+        int32_t result = 0;
+        do
+        {
+            const Error err = TryRunOne(result, IORING_OP_READ, outDest, count, m_offset, 0);
+            if (err)
+            {
+                return err;
+            }
+        } while (result == -EINTR || result == -EAGAIN);
+
+        if (result < 0)
+        {
+            return Error{"Could not read file.", -result};
+        }
+
+        outRead = static_cast<size_t>(result);
+        m_offset += outRead;
+        return Error{};
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        size_t bytesWritten = 0;
+        const Error err = LexTryWrite(bytesWritten, src, count);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        return bytesWritten;
+    }
+
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count) noexcept
+    {
+        outWritten = 0;
+        int32_t result = 0;
+        do
+        {
+            const Error err = TryRunOne(result, IORING_OP_WRITE, src, count, m_offset, 0);
+            if (err)
+            {
+                return err;
+            }
+        } while (result == -EINTR || result == -EAGAIN);
+
+        if (result < 0)
+        {
+            return Error{"Could not write file.", -result};
+        }
+
+        outWritten = static_cast<size_t>(result);
+        if (m_append)
+        {
+            // The write went to the end of the file, so that's where we are.
+            struct stat st;
+            if (fstat(m_file.FileHandle(), &st) == -1)
+            {
+                return Error{"Could not stat file.", errno};
+            }
+            m_offset = static_cast<size_t>(st.st_size);
+        }
+        else
+        {
+            m_offset += outWritten;
+        }
+        return Error{};
+    }
+
+    /**
+     * @brief Wait for every operation submitted so far, then fsync(2) the
+     *        file.
+     */
+    void LexFlush()
+    {
+        int32_t result = 0;
+        const Error err = TryRunOne(result, IORING_OP_FSYNC, nullptr, 0, 0, IOSQE_IO_DRAIN);
+        if (err)
+        {
+            LEXIO_THROW(POSIXError(err.Message(), err.SysError()));
+        }
+        else if (result < 0)
+        {
+            LEXIO_THROW(POSIXError("Could not flush file.", -result));
+        }
+    }
+
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        return m_file.LexReadAt(outDest, count, offset);
+    }
+
+    size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset)
+    {
+        return m_file.LexWriteAt(src, count, offset);
+    }
+
+    size_t LexSeek(const SeekPos &pos)
+    {
+        ptrdiff_t base = 0;
+        switch (pos.whence)
+        {
+        case LexIO::Whence::start:
+            break;
+        case LexIO::Whence::current:
+            base = static_cast<ptrdiff_t>(m_offset);
+            break;
+        case LexIO::Whence::end:
+            base = static_cast<ptrdiff_t>(m_file.LexLength());
+            break;
+        }
+
+        const ptrdiff_t newOffset = base + pos.offset;
+        if (newOffset < 0)
+        {
+            LEXIO_THROW(POSIXError("Could not seek file.", EINVAL));
+        }
+
+        m_offset = static_cast<size_t>(newOffset);
+        return m_offset;
+    }
+
+    size_t LexLength() const { return m_file.LexLength(); }
+
+    size_t LexSizeHint() const noexcept
+    {
+        struct stat st;
+        if (fstat(m_file.FileHandle(), &st) == -1 || !S_ISREG(st.st_mode))
+        {
+            return 0;
+        }
+
+        const size_t length = static_cast<size_t>(st.st_size);
+        return m_offset < length ? length - m_offset : 0;
+    }
+};
+
+#if (LEXIO_CPLUSPLUS < 201703L)
+constexpr uint64_t IoUringFile::RESERVED_USER_DATA;
+constexpr unsigned IoUringFile::DEFAULT_ENTRIES;
+#endif
+
+/**
+ * @brief Open an IoUringFile using the same modes as FileOpen.
+ *
+ * @param path Path to filename, assumed to be a null-terminated string.
+ * @param mode Mode to open the file with.
+ * @param entries Minimum number of operations that can be queued.
+ * @return A constructed IoUringFile object.
+ * @throws POSIXError if the file couldn't be opened or io_uring is not
+ *         available.
+ */
+inline IoUringFile IoUringFileOpen(const char *path, const OpenMode mode,
+                                   unsigned entries = IoUringFile::DEFAULT_ENTRIES)
+{
+    switch (mode)
+    {
+    case OpenMode::read:
+        return IoUringFile::Open(path, O_RDONLY, 0666, entries);
+    case OpenMode::write:
+        return IoUringFile::Open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666, entries);
+    case OpenMode::append:
+        return IoUringFile::Open(path, O_WRONLY | O_CREAT, 0666, entries);
+    case OpenMode::readPlus:
+        return IoUringFile::Open(path, O_RDWR, 0666, entries);
+    case OpenMode::writePlus:
+        return IoUringFile::Open(path, O_RDWR | O_CREAT | O_TRUNC, 0666, entries);
+    case OpenMode::appendPlus:
+        return IoUringFile::Open(path, O_RDWR | O_CREAT, 0666, entries);
+    default:
+        LEXIO_THROW(std::runtime_error("Unknown open mode type."));
+    }
+}
+
+} // namespace LexIO
+
+#endif // defined(__linux__)
@@ -101,13 +101,27 @@ class VectorStream
     {
         if (count > BufferSize())
         {
-            throw new std::runtime_error("can't consume more bytes than buffer size");
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
         }
 
         // Shrink the buffer.
         m_bufferOffset += count;
     }
 
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+    {
+        outRead = LexRead(outDest, count);
+        return Error{};
+    }
+
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+    {
+        outBuffer = LexFillBuffer(count);
+        return Error{};
+    }
+
+    size_t LexSizeHint() const { return m_bufferOffset < m_container.size() ? m_container.size() - m_bufferOffset : 0; }
+
     size_t LexWrite(const uint8_t *src, size_t count)
     {
         // Writes off the end of the burffer grow the buffer to fit.
@@ -119,8 +133,118 @@ class VectorStream
         return count;
     }
 
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count)
+    {
+        outWritten = LexWrite(src, count);
+        return Error{};
+    }
+
     void LexFlush() {}
 
+    MutableBufferView LexReserve(size_t count)
+    {
+        // Grow the container to fit the reservation, remembering how large
+        // it was so an unused reservation doesn't leave junk behind.  A
+        // repeated reservation keeps the size from before the first one.
+        if (!m_reserved)
+        {
+            m_unreservedSize = m_container.size();
+            m_reserved = true;
+        }
+        const size_t wantedOffset = m_offset + count;
+        m_container.resize(Detail::Max(wantedOffset, m_container.size()));
+        return MutableBufferView{m_container.data() + m_offset, m_container.size() - m_offset};
+    }
+
+    void LexCommit(size_t count)
+    {
+        if (!m_reserved)
+        {
+            LEXIO_THROW(std::runtime_error("can't commit without a reservation"));
+        }
+        else if (m_offset > m_container.size() || count > m_container.size() - m_offset)
+        {
+            LEXIO_THROW(std::runtime_error("can't commit more bytes than were reserved"));
+        }
+
+        m_offset += count;
+        m_bufferOffset = m_offset;
+        m_container.resize(Detail::Max(m_offset, m_unreservedSize));
+        m_reserved = false;
+    }
+
+    size_t LexReadV(const MutableBufferView *bufs, size_t count)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const size_t read = LexRead(bufs[i].Data(), bufs[i].Size());
+            total += read;
+            if (read != bufs[i].Size())
+            {
+                break;
+            }
+        }
+        return total;
+    }
+
+    size_t LexWriteV(const BufferView *bufs, size_t count)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            total += bufs[i].Size();
+        }
+
+        // Grow the buffer once to fit every write.
+        const size_t wantedOffset = m_offset + total;
+        m_container.resize(Detail::Max(wantedOffset, m_container.size()));
+        for (size_t i = 0; i < count; i++)
+        {
+            if (bufs[i].Size() != 0)
+            {
+                std::memcpy(m_container.data() + m_offset, bufs[i].Data(), bufs[i].Size());
+                m_offset += bufs[i].Size();
+            }
+        }
+        m_bufferOffset = m_offset;
+        return total;
+    }
+
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        if (offset >= m_container.size())
+        {
+            return 0;
+        }
+
+        const size_t actualSize = Detail::Min(count, m_container.size() - offset);
+        std::memcpy(outDest, m_container.data() + offset, actualSize);
+        return actualSize;
+    }
+
+    /**
+     * @brief Write data at an absolute offset without moving the cursor.
+     *
+     * @details Unlike LexWrite, positional writes never grow the container,
+     *          since reallocating it would not be safe while other threads
+     *          are accessing it.  Writes past the end of the container are
+     *          truncated, and writes starting at or past the end return 0.
+     */
+    size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset)
+    {
+        if (offset >= m_container.size())
+        {
+            return 0;
+        }
+
+        const size_t actualSize = Detail::Min(count, m_container.size() - offset);
+        std::memcpy(m_container.data() + offset, src, actualSize);
+        return actualSize;
+    }
+
+    size_t LexLength() const { return m_container.size(); }
+
     size_t LexSeek(const SeekPos &pos)
     {
         ptrdiff_t offset = 0;
@@ -140,7 +264,7 @@ class VectorStream
         if (offset < 0)
         {
             // Negative offsets are invalid.
-            throw std::runtime_error("attempted seek to negative position");
+            LEXIO_THROW(std::runtime_error("attempted seek to negative position"));
         }
 
         m_offset = static_cast<size_t>(offset);
@@ -152,6 +276,8 @@ class VectorStream
     container_type m_container;
     size_t m_offset = 0;
     size_t m_bufferOffset = 0;
+    size_t m_unreservedSize = 0;
+    bool m_reserved = false;
 
     size_t BufferSize() const { return m_offset - m_bufferOffset; }
 };
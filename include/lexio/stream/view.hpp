@@ -86,13 +86,27 @@ class ViewStream
     {
         if (count > BufferSize())
         {
-            throw new std::runtime_error("can't consume more bytes than buffer size");
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
         }
 
         // Shrink the buffer.
         m_bufferOffset += count;
     }
 
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+    {
+        outRead = LexRead(outDest, count);
+        return Error{};
+    }
+
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+    {
+        outBuffer = LexFillBuffer(count);
+        return Error{};
+    }
+
+    size_t LexSizeHint() const { return m_bufferOffset < Size() ? Size() - m_bufferOffset : 0; }
+
     size_t LexWrite(const uint8_t *src, size_t count)
     {
         const size_t wantedOffset = m_offset + count;
@@ -104,8 +118,40 @@ class ViewStream
         return actualLength;
     }
 
+    Error LexTryWrite(size_t &outWritten, const uint8_t *src, size_t count)
+    {
+        outWritten = LexWrite(src, count);
+        return Error{};
+    }
+
     void LexFlush() {}
 
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        if (offset >= Size())
+        {
+            return 0;
+        }
+
+        const size_t actualSize = Detail::Min(count, Size() - offset);
+        std::memcpy(outDest, m_start + offset, actualSize);
+        return actualSize;
+    }
+
+    size_t LexWriteAt(const uint8_t *src, size_t count, size_t offset)
+    {
+        if (offset >= Size())
+        {
+            return 0;
+        }
+
+        const size_t actualSize = Detail::Min(count, Size() - offset);
+        std::memcpy(m_start + offset, src, actualSize);
+        return actualSize;
+    }
+
+    size_t LexLength() const { return Size(); }
+
     size_t LexSeek(const SeekPos &pos)
     {
         ptrdiff_t offset = 0;
@@ -125,7 +171,7 @@ class ViewStream
         if (offset < 0)
         {
             // Negative offsets are invalid.
-            throw std::runtime_error("attempted seek to negative position");
+            LEXIO_THROW(std::runtime_error("attempted seek to negative position"));
         }
 
         m_offset = static_cast<size_t>(offset);
@@ -203,13 +249,41 @@ class ConstViewStream
     {
         if (count > BufferSize())
         {
-            throw new std::runtime_error("can't consume more bytes than buffer size");
+            LEXIO_THROW(std::runtime_error("can't consume more bytes than buffer size"));
         }
 
         // Shrink the buffer.
         m_bufferOffset += count;
     }
 
+    Error LexTryRead(size_t &outRead, uint8_t *outDest, size_t count)
+    {
+        outRead = LexRead(outDest, count);
+        return Error{};
+    }
+
+    Error LexTryFillBuffer(BufferView &outBuffer, size_t count)
+    {
+        outBuffer = LexFillBuffer(count);
+        return Error{};
+    }
+
+    size_t LexSizeHint() const { return m_bufferOffset < Size() ? Size() - m_bufferOffset : 0; }
+
+    size_t LexReadAt(uint8_t *outDest, size_t count, size_t offset) const
+    {
+        if (offset >= Size())
+        {
+            return 0;
+        }
+
+        const size_t actualSize = Detail::Min(count, Size() - offset);
+        std::memcpy(outDest, m_start + offset, actualSize);
+        return actualSize;
+    }
+
+    size_t LexLength() const { return Size(); }
+
     size_t LexSeek(const SeekPos &pos)
     {
         ptrdiff_t offset = 0;
@@ -229,7 +303,7 @@ class ConstViewStream
         if (offset < 0)
         {
             // Negative offsets are invalid.
-            throw std::runtime_error("attempted seek to negative position");
+            LEXIO_THROW(std::runtime_error("attempted seek to negative position"));
         }
 
         m_offset = static_cast<size_t>(offset);
@@ -17,49 +17,79 @@
 #pragma once
 
 /**
- * @file core.hpp
+ * @file try.hpp
  * @brief Core interfaces and functions implemented without exceptions.
- * 
- * Since LexIO traits use exceptions, we store the exception in a thread-local
- * global.  Ideally, we would use <expected>, but supporting C++14 means no
- * std::expected or even std::variant without a third-party implementation.
+ *
+ * Errors are stored in a thread-local global.  Streams that implement the
+ * exception-free protocol report a LexIO::Error, which is stored without
+ * allocating or unwinding.  Exceptions thrown by any other stream are caught
+ * and stored instead.  Ideally, we would use <expected>, but supporting C++14
+ * means no std::expected or even std::variant without a third-party
+ * implementation.
  */
 
 #include "./core.hpp"
 
 #include <exception>
+#include <system_error>
 
 namespace LexIO
 {
 
-namespace Detail
+/**
+ * @brief Set the "most recent" error for this thread.  Usually called from
+ *        within a `catch` block of a LexIO function marked `noexcept`.
+ *
+ * @param ex Exception to set as most recent error.
+ */
+inline void SetLastError(std::exception_ptr ex) noexcept
 {
+    Detail::LastError().error = Error::Exception();
+    Detail::LastError().exception = ex;
+}
 
-inline std::exception_ptr &LastError() noexcept
+/**
+ * @brief Set the "most recent" error for this thread from an Error returned
+ *        by the exception-free protocol.
+ *
+ * @param err Error to set as most recent error.
+ */
+inline void SetLastError(const Error &err) noexcept
 {
-    static thread_local std::exception_ptr ex;
-    return ex;
+    Detail::LastError().error = err;
+    if (!err.IsException())
+    {
+        Detail::LastError().exception = nullptr;
+    }
 }
 
-} // namespace Detail
-
 /**
- * @brief Set the "most recent" error for this thread.  Usually called from
- *        within a `catch` block of a LexIO function marked `noexcept`.
+ * @brief Get the most recent error for this thread without throwing it.
  *
- * @param ex Exception to set as most recent error.
+ * @return Most recent error.  If it was caused by an exception, the Error
+ *         only signals that fact, call LexIO::ThrowLastError to inspect it.
  */
-inline void SetLastError(std::exception_ptr ex) noexcept
+inline Error GetLastError() noexcept
 {
-    Detail::LastError() = ex;
+    return Detail::LastError().error;
 }
 
 /**
- * @brief Throw the most recent error for this thread.
+ * @brief Throw the most recent error for this thread.  Errors that carry a
+ *        system error code are thrown as std::system_error.
  */
 [[noreturn]] inline void ThrowLastError()
 {
-    std::rethrow_exception(Detail::LastError());
+    const Detail::LastErrorState &state = Detail::LastError();
+    if (state.error.IsException() && state.exception != nullptr)
+    {
+        std::rethrow_exception(state.exception);
+    }
+    else if (state.error.SysError() != 0)
+    {
+        LEXIO_THROW(std::system_error(state.error.SysError(), std::generic_category(), state.error.Message()));
+    }
+    LEXIO_THROW(std::runtime_error(state.error ? state.error.Message() : "no error"));
 }
 
 /**
@@ -67,9 +97,304 @@ inline void SetLastError(std::exception_ptr ex) noexcept
  */
 inline void ClearLastError() noexcept
 {
-    Detail::LastError() = nullptr;
+    Detail::LastError().error = Error{};
+    Detail::LastError().exception = nullptr;
+}
+
+namespace Detail
+{
+
+/**
+ * @brief Set a failed Error as the most recent error for this thread.
+ *
+ * @return True if the Error represents success, otherwise false.
+ */
+inline bool CheckError(const Error &err) noexcept
+{
+    if (err)
+    {
+        SetLastError(err);
+        return false;
+    }
+    return true;
+}
+
+template <typename TRY_READER>
+inline bool AttemptRead(size_t &outActual, uint8_t *dest, TRY_READER &reader, size_t count, std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        return CheckError(TryReadLoop(outActual, dest, reader, count));
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <typename READER>
+inline bool AttemptRead(size_t &outActual, uint8_t *dest, READER &reader, size_t count, std::false_type) noexcept
+{
+    LEXIO_TRY
+    {
+        outActual = ReadLoop(dest, reader, count);
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+/**
+ * @brief Read until the buffer is full or EOF is hit, using the
+ *        exception-free protocol if the reader implements it.
+ */
+template <typename READER>
+inline bool AttemptRead(size_t &outActual, uint8_t *dest, READER &reader, size_t count) noexcept
+{
+    return AttemptRead(outActual, dest, reader, count, IsTryReader<READER>{});
+}
+
+template <typename TRY_READER>
+inline bool AttemptReadExact(uint8_t *dest, TRY_READER &reader, size_t count, std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        return CheckError(TryReadExactLoop(dest, reader, count));
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <typename READER>
+inline bool AttemptReadExact(uint8_t *dest, READER &reader, size_t count, std::false_type) noexcept
+{
+    LEXIO_TRY
+    {
+        ReadExactLoop(dest, reader, count);
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+/**
+ * @brief Read exactly the requested number of bytes, using the
+ *        exception-free protocol if the reader implements it.
+ */
+template <typename READER>
+inline bool AttemptReadExact(uint8_t *dest, READER &reader, size_t count) noexcept
+{
+    return AttemptReadExact(dest, reader, count, IsTryReader<READER>{});
+}
+
+template <typename TRY_BUFFERED_READER>
+inline bool AttemptFillBuffer(BufferView &outBuffer, TRY_BUFFERED_READER &bufReader, size_t count,
+                              std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        return CheckError(bufReader.LexTryFillBuffer(outBuffer, count));
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <typename BUFFERED_READER>
+inline bool AttemptFillBuffer(BufferView &outBuffer, BUFFERED_READER &bufReader, size_t count,
+                              std::false_type) noexcept
+{
+    LEXIO_TRY
+    {
+        outBuffer = bufReader.LexFillBuffer(count);
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+/**
+ * @brief Fill the buffer of a BufferedReader, using the exception-free
+ *        protocol if the reader implements it.
+ */
+template <typename BUFFERED_READER>
+inline bool AttemptFillBuffer(BufferView &outBuffer, BUFFERED_READER &bufReader, size_t count) noexcept
+{
+    return AttemptFillBuffer(outBuffer, bufReader, count, IsTryBufferedReader<BUFFERED_READER>{});
+}
+
+template <typename TRY_WRITER>
+inline bool AttemptWrite(size_t &outActual, TRY_WRITER &writer, const uint8_t *src, size_t count,
+                         std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        return CheckError(TryWriteLoop(outActual, writer, src, count));
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <typename WRITER>
+inline bool AttemptWrite(size_t &outActual, WRITER &writer, const uint8_t *src, size_t count,
+                         std::false_type) noexcept
+{
+    LEXIO_TRY
+    {
+        outActual = WriteLoop(writer, src, count);
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+/**
+ * @brief Write until the buffer is drained or EOF is hit, using the
+ *        exception-free protocol if the writer implements it.
+ */
+template <typename WRITER>
+inline bool AttemptWrite(size_t &outActual, WRITER &writer, const uint8_t *src, size_t count) noexcept
+{
+    return AttemptWrite(outActual, writer, src, count, IsTryWriter<WRITER>{});
+}
+
+template <typename TRY_WRITER>
+inline bool AttemptWriteExact(TRY_WRITER &writer, const uint8_t *src, size_t count, std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        return CheckError(TryWriteExactLoop(writer, src, count));
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <typename WRITER>
+inline bool AttemptWriteExact(WRITER &writer, const uint8_t *src, size_t count, std::false_type) noexcept
+{
+    LEXIO_TRY
+    {
+        WriteExactLoop(writer, src, count);
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+/**
+ * @brief Write exactly the requested number of bytes, using the
+ *        exception-free protocol if the writer implements it.
+ */
+template <typename WRITER>
+inline bool AttemptWriteExact(WRITER &writer, const uint8_t *src, size_t count) noexcept
+{
+    return AttemptWriteExact(writer, src, count, IsTryWriter<WRITER>{});
+}
+
+template <size_t N, typename BUFFERED_READER>
+LEXIO_FORCEINLINE bool TryLoadExact(uint8_t (&outBuf)[N], BUFFERED_READER &bufReader, std::true_type) noexcept
+{
+    BufferView view;
+    if (!AttemptFillBuffer(view, bufReader, N))
+    {
+        return false;
+    }
+    else if (view.Size() >= N)
+    {
+        // Fast path, copy straight out of the buffer.
+        std::memcpy(&outBuf[0], view.Data(), N);
+        bufReader.LexConsumeBuffer(N);
+        return true;
+    }
+
+    // Buffer came up short, let the read loop sort it out.
+    return AttemptReadExact(&outBuf[0], bufReader, N);
+}
+
+template <size_t N, typename READER>
+LEXIO_FORCEINLINE bool TryLoadExact(uint8_t (&outBuf)[N], READER &reader, std::false_type) noexcept
+{
+    return AttemptReadExact(&outBuf[0], reader, N);
+}
+
+/**
+ * @brief Read exactly N bytes into a small fixed-size buffer, reading
+ *        directly out of the buffer of a BufferedReader when possible.
+ *
+ * @return True if successful, false if not enough bytes could be read, or if
+ *         an error with the read operation was encountered.
+ */
+template <size_t N, typename READER>
+LEXIO_FORCEINLINE bool TryLoadExact(uint8_t (&outBuf)[N], READER &reader) noexcept
+{
+    return TryLoadExact(outBuf, reader, IsBufferedReader<READER>{});
+}
+
+template <size_t N, typename BUFFERED_WRITER, typename ENCODE>
+LEXIO_FORCEINLINE bool TryStoreExact(BUFFERED_WRITER &bufWriter, ENCODE encode, std::true_type) noexcept
+{
+    LEXIO_TRY
+    {
+        StoreExact<N>(bufWriter, encode, std::true_type{});
+        return true;
+    }
+    LEXIO_CATCH_ALL
+    {
+        SetLastError(std::current_exception());
+        return false;
+    }
+}
+
+template <size_t N, typename WRITER, typename ENCODE>
+LEXIO_FORCEINLINE bool TryStoreExact(WRITER &writer, ENCODE encode, std::false_type) noexcept
+{
+    uint8_t buf[N];
+    encode(&buf[0]);
+    return AttemptWriteExact(writer, &buf[0], N);
 }
 
+/**
+ * @brief Write exactly N bytes produced by an encoder, storing directly into
+ *        the reserved space of a BufferedWriter when possible.
+ *
+ * @return True if successful, false if the bytes could not be written, or if
+ *         an error with the write operation was encountered.
+ */
+template <size_t N, typename WRITER, typename ENCODE>
+LEXIO_FORCEINLINE bool TryStoreExact(WRITER &writer, ENCODE encode) noexcept
+{
+    return TryStoreExact<N>(writer, encode, IsBufferedWriter<WRITER>{});
+}
+
+} // namespace Detail
+
 /**
  * @brief Attempt to read data from the current offset, inserting it into
  *        the passed buffer.
@@ -85,12 +410,11 @@ inline void ClearLastError() noexcept
  */
 inline bool TryRawRead(size_t &outActual, uint8_t *outDest, const ReaderRef &reader, size_t count) noexcept
 {
-    try
+    LEXIO_TRY
     {
-        outActual = reader.LexRead(outDest, count);
-        return true;
+        return Detail::CheckError(reader.LexTryRead(outActual, outDest, count));
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -114,16 +438,7 @@ inline bool TryRawRead(size_t &outActual, uint8_t *outDest, const ReaderRef &rea
  */
 inline bool TryFillBuffer(BufferView &outBuffer, const BufferedReaderRef &bufReader, size_t size) noexcept
 {
-    try
-    {
-        outBuffer = bufReader.LexFillBuffer(size);
-        return true;
-    }
-    catch (...)
-    {
-        SetLastError(std::current_exception());
-        return false;
-    }
+    return Detail::AttemptFillBuffer(outBuffer, bufReader, size);
 }
 
 /**
@@ -139,12 +454,12 @@ inline bool TryFillBuffer(BufferView &outBuffer, const BufferedReaderRef &bufRea
  */
 inline bool TryConsumeBuffer(const BufferedReaderRef &bufReader, size_t size) noexcept
 {
-    try
+    LEXIO_TRY
     {
         bufReader.LexConsumeBuffer(size);
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -165,12 +480,11 @@ inline bool TryConsumeBuffer(const BufferedReaderRef &bufReader, size_t size) no
  */
 inline bool TryRawWrite(size_t &outActual, const WriterRef &writer, const uint8_t *src, size_t count) noexcept
 {
-    try
+    LEXIO_TRY
     {
-        outActual = writer.LexWrite(src, count);
-        return true;
+        return Detail::CheckError(writer.LexTryWrite(outActual, src, count));
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -186,12 +500,12 @@ inline bool TryRawWrite(size_t &outActual, const WriterRef &writer, const uint8_
  */
 inline bool TryFlush(const WriterRef &writer) noexcept
 {
-    try
+    LEXIO_TRY
     {
         writer.LexFlush();
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -210,12 +524,12 @@ inline bool TryFlush(const WriterRef &writer) noexcept
  */
 inline bool TrySeek(size_t &outOffset, const SeekableRef &seekable, const SeekPos &pos) noexcept
 {
-    try
+    LEXIO_TRY
     {
         outOffset = seekable.LexSeek(pos);
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -235,12 +549,12 @@ inline bool TrySeek(size_t &outOffset, const SeekableRef &seekable, const SeekPo
  */
 inline size_t TrySeek(size_t &outOffset, const SeekableRef &seekable, ptrdiff_t offset, Whence whence) noexcept
 {
-    try
+    LEXIO_TRY
     {
         outOffset = seekable.LexSeek({offset, whence});
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -264,31 +578,7 @@ inline size_t TrySeek(size_t &outOffset, const SeekableRef &seekable, ptrdiff_t
 template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
 inline bool TryRead(size_t &outActual, BYTE *outDest, const ReaderRef &reader, size_t count) noexcept
 {
-    try
-    {
-        uint8_t *dest = reinterpret_cast<uint8_t *>(outDest);
-        size_t offset = 0, remain = count;
-        while (offset != count)
-        {
-            const size_t read = reader.LexRead(dest + offset, remain);
-            if (read == 0)
-            {
-                outActual = offset;
-                return true;
-            }
-
-            offset += read;
-            remain -= read;
-        }
-
-        outActual = count;
-        return true;
-    }
-    catch (...)
-    {
-        SetLastError(std::current_exception());
-        return false;
-    }
+    return Detail::AttemptRead(outActual, reinterpret_cast<uint8_t *>(outDest), reader, count);
 }
 
 /**
@@ -310,6 +600,48 @@ LEXIO_FORCEINLINE bool TryRead(size_t &outActual, BYTE (&outArray)[N], const Rea
     return TryRead(outActual, outArray, reader, N);
 }
 
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined.
+ *
+ * @param outActual Actual number of bytes read, or 0 if EOF-like condition
+ *                  was encountered.
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader Reader to operate on.
+ * @param count Number of bytes to attempt to read.
+ * @return True if successful, false if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.  To get specific
+ *         error, call LexIO::ThrowLastError.
+ */
+template <typename BYTE, typename READER, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+inline bool TryRead(size_t &outActual, BYTE *outDest, READER &reader, size_t count) noexcept
+{
+    return Detail::AttemptRead(outActual, reinterpret_cast<uint8_t *>(outDest), reader, count);
+}
+
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined.
+ *
+ * @param outActual Actual number of bytes read, or 0 if EOF-like condition
+ *                  was encountered.
+ * @param outArray Output buffer array.
+ * @param reader Reader to operate on.
+ * @return True if successful, false if an error with the read operation was
+ *         encountered.  EOF is _not_ considered an error.  To get specific
+ *         error, call LexIO::ThrowLastError.
+ */
+template <typename BYTE, size_t N, typename READER,
+          typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+LEXIO_FORCEINLINE bool TryRead(size_t &outActual, BYTE (&outArray)[N], READER &reader) noexcept
+{
+    return TryRead(outActual, outArray, reader, N);
+}
+
 /**
  * @brief Read data from the current offset, inserting it into the passed
  *        buffer.  Calls LexIO::RawRead as many times as necessary to fill
@@ -327,28 +659,7 @@ LEXIO_FORCEINLINE bool TryRead(size_t &outActual, BYTE (&outArray)[N], const Rea
 template <typename BYTE, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>>
 inline bool TryReadExact(BYTE *outDest, const ReaderRef &reader, size_t count) noexcept
 {
-    try
-    {
-        uint8_t *dest = reinterpret_cast<uint8_t *>(outDest);
-        size_t offset = 0, remain = count;
-        while (offset != count)
-        {
-            const size_t read = reader.LexRead(dest + offset, remain);
-            if (read == 0)
-            {
-                throw std::runtime_error("could not read exact number of bytes");
-            }
-
-            offset += read;
-            remain -= read;
-        }
-        return true;
-    }
-    catch (...)
-    {
-        SetLastError(std::current_exception());
-        return false;
-    }
+    return Detail::AttemptReadExact(reinterpret_cast<uint8_t *>(outDest), reader, count);
 }
 
 /**
@@ -370,6 +681,48 @@ LEXIO_FORCEINLINE bool TryReadExact(BYTE (&outArray)[N], const ReaderRef &reader
     return TryReadExact(outArray, reader, N);
 }
 
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined, and returns failure if not enough bytes could be
+ *        read.
+ *
+ * @param outDest Pointer to starting byte of output buffer.
+ * @param reader Reader to operate on.
+ * @param count Number of bytes to read.
+ * @return True if successful, false if stream encountered an EOF-like condition
+ *         before enough bytes could be read, or if an error with the read
+ *         operation was encountered.  To get specific error, call
+ *         LexIO::ThrowLastError.
+ */
+template <typename BYTE, typename READER, typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+inline bool TryReadExact(BYTE *outDest, READER &reader, size_t count) noexcept
+{
+    return Detail::AttemptReadExact(reinterpret_cast<uint8_t *>(outDest), reader, count);
+}
+
+/**
+ * @brief Read data from the current offset, inserting it into the passed
+ *        buffer.  Calls the Reader's LexRead directly, allowing the call
+ *        to be inlined, and returns failure if not enough bytes could be
+ *        read.
+ *
+ * @param outArray Output buffer array.
+ * @param reader Reader to operate on.
+ * @return True if successful, false if stream encountered an EOF-like condition
+ *         before enough bytes could be read, or if an error with the read
+ *         operation was encountered.  To get specific error, call
+ *         LexIO::ThrowLastError.
+ */
+template <typename BYTE, size_t N, typename READER,
+          typename = std::enable_if_t<!Detail::IsConstV<BYTE> && sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteReader<READER>>
+LEXIO_FORCEINLINE bool TryReadExact(BYTE (&outArray)[N], READER &reader) noexcept
+{
+    return TryReadExact(outArray, reader, N);
+}
+
 /**
  * @brief Write a buffer of data at the current offset.  Calls LexIO::RawWrite
  *        as many times as necessary to write the entire buffer unless EOF
@@ -387,31 +740,7 @@ LEXIO_FORCEINLINE bool TryReadExact(BYTE (&outArray)[N], const ReaderRef &reader
 template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
 inline bool TryWrite(size_t &outActual, const WriterRef &writer, const BYTE *src, size_t count) noexcept
 {
-    try
-    {
-        const uint8_t *srcByte = reinterpret_cast<const uint8_t *>(src);
-        size_t offset = 0, remain = count;
-        while (offset != count)
-        {
-            const size_t written = writer.LexWrite(srcByte + offset, remain);
-            if (written == 0)
-            {
-                outActual = offset;
-                return true;
-            }
-
-            offset += written;
-            remain -= written;
-        }
-
-        outActual = count;
-        return true;
-    }
-    catch (...)
-    {
-        SetLastError(std::current_exception());
-        return false;
-    }
+    return Detail::AttemptWrite(outActual, writer, reinterpret_cast<const uint8_t *>(src), count);
 }
 
 /**
@@ -435,6 +764,45 @@ LEXIO_FORCEINLINE bool TryWrite(size_t &outActual, const WriterRef &writer, cons
     return TryWrite(outActual, writer, array, N);
 }
 
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined.
+ *
+ * @param outActual Actual number of bytes written, or 0 if EOF-like condition
+ *                  was encountered.
+ * @param writer Writer to operate on.
+ * @param src Pointer to starting byte of input buffer.
+ * @param count Size of input buffer in bytes.
+ * @return True if successful, false if an error with the write operation
+ *         was encountered.  A partial write is _not_ considered an error.
+ *         To get specific error, call LexIO::ThrowLastError.
+ */
+template <typename WRITER, typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+inline bool TryWrite(size_t &outActual, WRITER &writer, const BYTE *src, size_t count) noexcept
+{
+    return Detail::AttemptWrite(outActual, writer, reinterpret_cast<const uint8_t *>(src), count);
+}
+
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined.
+ *
+ * @param outActual Actual number of bytes written, or 0 if EOF-like condition
+ *                  was encountered.
+ * @param writer Writer to operate on.
+ * @param array Input buffer array.
+ * @return True if successful, false if an error with the write operation
+ *         was encountered.  A partial write is _not_ considered an error.
+ *         To get specific error, call LexIO::ThrowLastError.
+ */
+template <typename WRITER, typename BYTE, size_t N, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+LEXIO_FORCEINLINE bool TryWrite(size_t &outActual, WRITER &writer, const BYTE (&array)[N]) noexcept
+{
+    return TryWrite(outActual, writer, array, N);
+}
+
 /**
  * @brief Write a buffer of data at the current offset.  Calls LexIO::RawWrite
  *        as many times as necessary to write the entire buffer, returning
@@ -449,30 +817,9 @@ LEXIO_FORCEINLINE bool TryWrite(size_t &outActual, const WriterRef &writer, cons
  *         LexIO::ThrowLastError.
  */
 template <typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>>
-inline bool TryWriteExact(const WriterRef &writer, const BYTE *src, size_t count)
-{
-    try
-    {
-        const uint8_t *srcByte = reinterpret_cast<const uint8_t *>(src);
-        size_t offset = 0, remain = count;
-        while (offset != count)
-        {
-            const size_t written = writer.LexWrite(srcByte + offset, remain);
-            if (written == 0)
-            {
-                throw std::runtime_error("could not write exact number of bytes");
-            }
-
-            offset += written;
-            remain -= written;
-        }
-        return true;
-    }
-    catch (...)
-    {
-        SetLastError(std::current_exception());
-        return false;
-    }
+inline bool TryWriteExact(const WriterRef &writer, const BYTE *src, size_t count) noexcept
+{
+    return Detail::AttemptWriteExact(writer, reinterpret_cast<const uint8_t *>(src), count);
 }
 
 /**
@@ -488,9 +835,48 @@ inline bool TryWriteExact(const WriterRef &writer, const BYTE *src, size_t count
  *         LexIO::ThrowLastError.
  */
 template <typename BYTE, size_t N, typename = std::enable_if_t<sizeof(BYTE) == 1>>
-LEXIO_FORCEINLINE bool TryWriteExact(const WriterRef &writer, const BYTE (&array)[N])
+LEXIO_FORCEINLINE bool TryWriteExact(const WriterRef &writer, const BYTE (&array)[N]) noexcept
+{
+    return TryWriteExact(writer, array, N);
+}
+
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined, and returns
+ *        failure if not enough bytes could be written.
+ *
+ * @param writer Writer to operate on.
+ * @param src Pointer to starting byte of input buffer.
+ * @param count Size of input buffer in bytes.
+ * @return True if successful, false if stream encountered an EOF-like condition
+ *         before enough bytes could be written, or if an error with the write
+ *         operation was encountered.  To get specific error, call
+ *         LexIO::ThrowLastError.
+ */
+template <typename WRITER, typename BYTE, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+inline bool TryWriteExact(WRITER &writer, const BYTE *src, size_t count) noexcept
+{
+    return Detail::AttemptWriteExact(writer, reinterpret_cast<const uint8_t *>(src), count);
+}
+
+/**
+ * @brief Write a buffer of data at the current offset.  Calls the Writer's
+ *        LexWrite directly, allowing the call to be inlined, and returns
+ *        failure if not enough bytes could be written.
+ *
+ * @param writer Writer to operate on.
+ * @param array Input buffer array.
+ * @return True if successful, false if stream encountered an EOF-like condition
+ *         before enough bytes could be written, or if an error with the write
+ *         operation was encountered.  To get specific error, call
+ *         LexIO::ThrowLastError.
+ */
+template <typename WRITER, typename BYTE, size_t N, typename = std::enable_if_t<sizeof(BYTE) == 1>,
+          typename = Detail::EnableIfConcreteWriter<WRITER>>
+LEXIO_FORCEINLINE bool TryWriteExact(WRITER &writer, const BYTE (&array)[N]) noexcept
 {
-    return WriteExact(writer, array, N);
+    return TryWriteExact(writer, array, N);
 }
 
 /**
@@ -504,12 +890,12 @@ LEXIO_FORCEINLINE bool TryWriteExact(const WriterRef &writer, const BYTE (&array
  */
 inline bool TryTell(size_t &outOffset, const SeekableRef &seekable) noexcept
 {
-    try
+    LEXIO_TRY
     {
         outOffset = seekable.LexSeek({0, Whence::current});
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -527,12 +913,12 @@ inline bool TryTell(size_t &outOffset, const SeekableRef &seekable) noexcept
  */
 inline bool TryRewind(size_t &outOffset, const SeekableRef &seekable) noexcept
 {
-    try
+    LEXIO_TRY
     {
         outOffset = seekable.LexSeek({0, Whence::start});
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
@@ -550,14 +936,12 @@ inline bool TryRewind(size_t &outOffset, const SeekableRef &seekable) noexcept
  */
 inline bool TryLength(size_t &outLength, const SeekableRef &seekable) noexcept
 {
-    try
+    LEXIO_TRY
     {
-        const size_t old = seekable.LexSeek({0, Whence::current});
-        outLength = seekable.LexSeek({0, Whence::end});
-        seekable.LexSeek({ptrdiff_t(old), Whence::start});
+        outLength = seekable.LexLength();
         return true;
     }
-    catch (...)
+    LEXIO_CATCH_ALL
     {
         SetLastError(std::current_exception());
         return false;
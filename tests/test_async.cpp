@@ -0,0 +1,497 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "lexio/async.hpp"
+
+#include "./test.h"
+#include "lexio/lib.hpp"
+#include "lexio/stream/file.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief A reader that reads the test text forever, or throws once a set
+ *        number of bytes have been read.
+ */
+class RepeatStream
+{
+    size_t m_offset = 0;
+    size_t m_limit = SIZE_MAX;
+
+  public:
+    RepeatStream() = default;
+    RepeatStream(size_t limit) : m_limit(limit) {}
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        if (m_offset == m_limit)
+        {
+            throw std::runtime_error("intended");
+        }
+
+        count = LexIO::Detail::Min(count, m_limit - m_offset);
+        for (size_t i = 0; i < count; i++)
+        {
+            outDest[i] = TEST_TEXT_DATA[(m_offset + i) % TEST_TEXT_LENGTH];
+        }
+        m_offset += count;
+        return count;
+    }
+};
+
+/**
+ * @brief A reader that only hands out bytes of the test text once they've
+ *        been released, like a socket waiting on its peer.
+ */
+class GatedStream
+{
+    struct Gate
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t released = 0;
+    };
+
+    std::shared_ptr<Gate> m_gate = std::make_shared<Gate>();
+    size_t m_offset = 0;
+
+  public:
+    void Release(size_t count)
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_gate->mutex};
+            m_gate->released = LexIO::Detail::Min(m_gate->released + count, TEST_TEXT_LENGTH);
+        }
+        m_gate->cv.notify_all();
+    }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        std::unique_lock<std::mutex> lock{m_gate->mutex};
+        m_gate->cv.wait(lock, [&] { return m_gate->released != m_offset || m_offset == TEST_TEXT_LENGTH; });
+
+        count = LexIO::Detail::Min(count, m_gate->released - m_offset);
+        std::memcpy(outDest, &TEST_TEXT_DATA[m_offset], count);
+        m_offset += count;
+        return count;
+    }
+};
+
+//******************************************************************************
+
+TEST(AsyncBufReader, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsBufferedReaderV<LexIO::AsyncBufReader<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsSeekableV<LexIO::AsyncBufReader<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsWriterV<LexIO::AsyncBufReader<LexIO::VectorStream>>);
+}
+
+TEST(AsyncBufReader, Read)
+{
+    for (size_t chunkCount = 2; chunkCount <= 4; chunkCount++)
+    {
+        LexIO::AsyncBufReader<PartialStream<LexIO::VectorStream>> reader{GetVectorStream(), 8, chunkCount};
+        EXPECT_EQ(8, reader.Capacity());
+
+        std::vector<uint8_t> data;
+        uint8_t chunk[5];
+        size_t count = 0;
+        while ((count = LexIO::Read(chunk, reader)) != 0)
+        {
+            data.insert(data.end(), &chunk[0], &chunk[count]);
+        }
+
+        EXPECT_EQ(GetVectorStream().Container(), data);
+        EXPECT_EQ(0, LexIO::Read(chunk, reader));
+    }
+}
+
+TEST(AsyncBufReader, FillBuffer)
+{
+    LexIO::AsyncBufReader<LexIO::VectorStream> reader{GetVectorStream(), 8};
+
+    // Fills that straddle chunks come back as one contiguous buffer.
+    LexIO::BufferView view = LexIO::FillBuffer(reader, 3);
+    ASSERT_EQ(8, view.Size());
+    LexIO::ConsumeBuffer(reader, 6);
+    view = LexIO::FillBuffer(reader, 7);
+    ASSERT_EQ(10, view.Size());
+    EXPECT_EQ(0, std::memcmp(view.Data(), &TEST_TEXT_DATA[6], 10));
+    LexIO::ConsumeBuffer(reader, 7);
+
+    EXPECT_THROW(LexIO::FillBuffer(reader, 9), std::runtime_error);
+    EXPECT_THROW(LexIO::ConsumeBuffer(reader, 4), std::runtime_error);
+
+    // The tail of the stream can be shorter than asked for.
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, reader);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 13, data.size());
+    EXPECT_EQ(0, LexIO::FillBuffer(reader, 8).Size());
+}
+
+TEST(AsyncBufReader, ShortRead)
+{
+    GatedStream stream;
+    GatedStream gate = stream;
+    gate.Release(5);
+    LexIO::AsyncBufReader<GatedStream> reader{std::move(stream), 16};
+
+    // The first bytes are seen before the rest of the chunk arrives.
+    uint8_t data[TEST_TEXT_LENGTH];
+    EXPECT_EQ(5, LexIO::RawRead(&data[0], reader, sizeof(data)));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[0], 5));
+    EXPECT_EQ(0, LexIO::RawRead(&data[0], reader, 0));
+
+    gate.Release(TEST_TEXT_LENGTH);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 5, LexIO::Read(&data[5], reader, TEST_TEXT_LENGTH - 5));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[0], TEST_TEXT_LENGTH));
+    EXPECT_EQ(0, LexIO::Read(data, reader));
+}
+
+TEST(AsyncBufReader, Error)
+{
+    LexIO::AsyncBufReader<RepeatStream> reader{RepeatStream{20}, 8};
+
+    // Data read before the error is still delivered.
+    uint8_t data[20];
+    EXPECT_EQ(16, LexIO::Read(&data[0], reader, 16));
+    EXPECT_EQ(4, LexIO::FillBuffer(reader, 4).Size());
+    EXPECT_THROW(LexIO::FillBuffer(reader, 5), std::runtime_error);
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[0], 16));
+
+    // The error is only reported once.
+    LexIO::ConsumeBuffer(reader, 4);
+    EXPECT_EQ(0, LexIO::Read(&data[0], reader, 1));
+}
+
+TEST(AsyncBufReader, Shutdown)
+{
+    // The I/O thread is blocked waiting for a free chunk when this goes out
+    // of scope, and must be woken up to exit.
+    LexIO::AsyncBufReader<RepeatStream> reader{RepeatStream{}, 16, 3};
+    EXPECT_EQ(16, LexIO::FillBuffer(reader, 8).Size());
+
+    LexIO::AsyncBufReader<RepeatStream> unused{RepeatStream{}, 16, 3};
+}
+
+TEST(AsyncBufReader, Move)
+{
+    LexIO::AsyncBufReader<LexIO::VectorStream> reader{GetVectorStream(), 8};
+    LexIO::ConsumeBuffer(reader, LexIO::FillBuffer(reader, 5).Size() - 1);
+
+    LexIO::AsyncBufReader<LexIO::VectorStream> moved{std::move(reader)};
+    uint8_t data[2];
+    ASSERT_EQ(2, LexIO::Read(data, moved));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[7], 2));
+
+    LexIO::AsyncBufReader<LexIO::VectorStream> assigned{LexIO::VectorStream{}, 8};
+    assigned = std::move(moved);
+    ASSERT_EQ(2, LexIO::Read(data, assigned));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[9], 2));
+
+    EXPECT_THROW((LexIO::AsyncBufReader<LexIO::VectorStream>{LexIO::VectorStream{}, 8, 1}), std::runtime_error);
+}
+
+/**
+ * @brief A writer that appends to a shared vector, so writes can be
+ *        inspected while the I/O thread owns the writer.  Optionally
+ *        blocks every write until released, throws once a set number of
+ *        bytes have been written, and makes flushes slow or fail.
+ */
+class SinkStream
+{
+  public:
+    struct Shared
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<uint8_t> data;
+        size_t flushes = 0;
+        bool blocked = false;
+        size_t limit = SIZE_MAX;
+        std::chrono::milliseconds flushDelay{0};
+        bool failFlush = false;
+    };
+
+  private:
+    std::shared_ptr<Shared> m_shared;
+
+  public:
+    SinkStream(const std::shared_ptr<Shared> &shared) : m_shared(shared) {}
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        std::unique_lock<std::mutex> lock{m_shared->mutex};
+        m_shared->cv.wait(lock, [this] { return !m_shared->blocked; });
+        if (m_shared->data.size() + count > m_shared->limit)
+        {
+            throw std::runtime_error("intended");
+        }
+        m_shared->data.insert(m_shared->data.end(), src, src + count);
+        return count;
+    }
+
+    void LexFlush()
+    {
+        std::this_thread::sleep_for(m_shared->flushDelay);
+        std::lock_guard<std::mutex> lock{m_shared->mutex};
+        if (m_shared->failFlush)
+        {
+            throw std::runtime_error("intended");
+        }
+        m_shared->flushes += 1;
+    }
+};
+
+TEST(AsyncBufWriter, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::AsyncBufWriter<LexIO::VectorStream>>);
+    EXPECT_TRUE(LexIO::IsBufferedWriterV<LexIO::AsyncBufWriter<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsReaderV<LexIO::AsyncBufWriter<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsSeekableV<LexIO::AsyncBufWriter<LexIO::VectorStream>>);
+}
+
+TEST(AsyncBufWriter, Write)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    LexIO::AsyncBufWriter<SinkStream> writer{SinkStream{shared}, 8, 2};
+    EXPECT_EQ(8, writer.Capacity());
+
+    for (size_t i = 0; i < TEST_TEXT_LENGTH; i += 3)
+    {
+        const size_t count = LexIO::Detail::Min<size_t>(3, TEST_TEXT_LENGTH - i);
+        EXPECT_EQ(count, LexIO::Write(writer, &TEST_TEXT_DATA[i], count));
+    }
+    LexIO::Flush(writer);
+
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    EXPECT_EQ(GetVectorStream().Container(), shared->data);
+    EXPECT_EQ(1, shared->flushes);
+}
+
+TEST(AsyncBufWriter, Background)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    shared->blocked = true;
+    LexIO::AsyncBufWriter<SinkStream> writer{SinkStream{shared}, 8, 4};
+
+    // Three buffers can be queued behind a stalled device without blocking
+    // the producer.
+    std::vector<uint8_t> data(24, 'X');
+    EXPECT_EQ(24, LexIO::Write(writer, data.data(), data.size()));
+    {
+        std::lock_guard<std::mutex> lock{shared->mutex};
+        EXPECT_TRUE(shared->data.empty());
+        shared->blocked = false;
+    }
+    shared->cv.notify_all();
+
+    LexIO::Flush(writer);
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    EXPECT_EQ(data, shared->data);
+}
+
+TEST(AsyncBufWriter, Reserve)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    {
+        LexIO::AsyncBufWriter<SinkStream> writer{SinkStream{shared}, 8, 2};
+        LexIO::Write(writer, TEST_TEXT_DATA, 5);
+
+        // Not enough room left in the current buffer, so it's swapped out.
+        LexIO::MutableBufferView view = LexIO::Reserve(writer, 4);
+        ASSERT_EQ(8, view.Size());
+        std::memcpy(view.Data(), &TEST_TEXT_DATA[5], 4);
+        LexIO::Commit(writer, 4);
+
+        EXPECT_THROW(LexIO::Reserve(writer, 9), std::runtime_error);
+        EXPECT_THROW(LexIO::Commit(writer, 5), std::runtime_error);
+    }
+
+    // Destruction writes out the rest.
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[9]), shared->data);
+    EXPECT_EQ(0, shared->flushes);
+}
+
+TEST(AsyncBufWriter, Error)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    shared->limit = 8;
+    LexIO::AsyncBufWriter<SinkStream> writer{SinkStream{shared}, 8, 2};
+
+    // The failure happens on the I/O thread and is reported afterwards.
+    LexIO::Write(writer, TEST_TEXT_DATA, 16);
+    EXPECT_THROW(LexIO::Flush(writer), std::runtime_error);
+    EXPECT_THROW(LexIO::Write(writer, TEST_TEXT_DATA, 1), std::runtime_error);
+    EXPECT_THROW(LexIO::Flush(writer), std::runtime_error);
+
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    EXPECT_EQ(8, shared->data.size());
+    EXPECT_EQ(0, shared->flushes);
+}
+
+TEST(AsyncBufWriter, Move)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    LexIO::AsyncBufWriter<SinkStream> writer{SinkStream{shared}, 8};
+    LexIO::Write(writer, TEST_TEXT_DATA, 3);
+
+    LexIO::AsyncBufWriter<SinkStream> moved{std::move(writer)};
+    LexIO::Write(moved, &TEST_TEXT_DATA[3], 3);
+
+    auto other = std::make_shared<SinkStream::Shared>();
+    LexIO::AsyncBufWriter<SinkStream> assigned{SinkStream{other}, 8};
+    LexIO::Write(assigned, TEST_TEXT_DATA, 2);
+    assigned = std::move(moved);
+    LexIO::Write(assigned, &TEST_TEXT_DATA[6], 3);
+    LexIO::Flush(assigned);
+
+    {
+        std::lock_guard<std::mutex> lock{shared->mutex};
+        EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[9]), shared->data);
+    }
+    {
+        std::lock_guard<std::mutex> lock{other->mutex};
+        EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[2]), other->data);
+    }
+
+    EXPECT_THROW((LexIO::AsyncBufWriter<SinkStream>{SinkStream{shared}, 8, 1}), std::runtime_error);
+}
+
+TEST(GroupCommitWriter, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::GroupCommitWriter<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsBufferedWriterV<LexIO::GroupCommitWriter<LexIO::VectorStream>>);
+    EXPECT_FALSE(LexIO::IsSeekableV<LexIO::GroupCommitWriter<LexIO::VectorStream>>);
+}
+
+TEST(GroupCommitWriter, Commit)
+{
+    constexpr size_t THREADS = 8;
+    constexpr size_t RECORDS = 50;
+
+    auto shared = std::make_shared<SinkStream::Shared>();
+    shared->flushDelay = std::chrono::milliseconds(1);
+    LexIO::GroupCommitWriter<SinkStream> writer{SinkStream{shared}};
+
+    // Each record is a thread number and a sequence number, repeated so a
+    // torn record would show up.
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREADS; t++)
+    {
+        threads.emplace_back([&writer, t] {
+            for (size_t i = 0; i < RECORDS; i++)
+            {
+                const uint8_t record[4] = {uint8_t(t), uint8_t(i), uint8_t(t), uint8_t(i)};
+                writer.Commit(&record[0], sizeof(record));
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    ASSERT_EQ(THREADS * RECORDS * 4, shared->data.size());
+    std::vector<size_t> next(THREADS);
+    for (size_t i = 0; i < shared->data.size(); i += 4)
+    {
+        const uint8_t *record = &shared->data[i];
+        ASSERT_LT(record[0], THREADS);
+        EXPECT_EQ(record[0], record[2]);
+        EXPECT_EQ(record[1], record[3]);
+        EXPECT_EQ(next[record[0]]++, record[1]);
+    }
+
+    // Commits were grouped, with one flush per batch.
+    EXPECT_EQ(shared->flushes, writer.BatchCount());
+    EXPECT_LT(writer.BatchCount(), THREADS * RECORDS);
+}
+
+TEST(GroupCommitWriter, Ticket)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    LexIO::GroupCommitWriter<SinkStream> writer{SinkStream{shared}, 4};
+
+    // Records larger than a batch still go through.
+    const uint64_t first = writer.Append(TEST_TEXT_DATA, 10);
+    const uint64_t second = writer.Append(&TEST_TEXT_DATA[10], 3);
+    EXPECT_LT(first, second);
+    writer.WaitDurable(second);
+    writer.WaitDurable(first);
+
+    LexIO::Write(writer, &TEST_TEXT_DATA[13], 2);
+    LexIO::Flush(writer);
+
+    std::lock_guard<std::mutex> lock{shared->mutex};
+    EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[15]), shared->data);
+    EXPECT_GE(shared->flushes, 2);
+}
+
+TEST(GroupCommitWriter, Error)
+{
+    auto shared = std::make_shared<SinkStream::Shared>();
+    LexIO::GroupCommitWriter<SinkStream> writer{SinkStream{shared}};
+    writer.Commit(TEST_TEXT_DATA, 4);
+
+    {
+        std::lock_guard<std::mutex> lock{shared->mutex};
+        shared->failFlush = true;
+    }
+    const uint64_t ticket = writer.Append(TEST_TEXT_DATA, 4);
+    EXPECT_THROW(writer.WaitDurable(ticket), std::runtime_error);
+    EXPECT_THROW(writer.Append(TEST_TEXT_DATA, 4), std::runtime_error);
+
+    // Records that made it before the failure are still durable.
+    EXPECT_NO_THROW(writer.WaitDurable(4));
+    EXPECT_EQ(1, writer.BatchCount());
+}
+
+#if !defined(_WIN32)
+
+TEST(GroupCommitWriter, File)
+{
+    char filename[] = "/tmp/lexXXXXXX";
+    const int fd = mkstemp(filename);
+    ASSERT_NE(-1, fd);
+    close(fd);
+
+    {
+        auto file = LexIO::FileOpen(filename, LexIO::OpenMode::write);
+        LexIO::SyncPolicy policy;
+        policy.mode = LexIO::SyncMode::fdatasync;
+        file.SetSyncPolicy(policy);
+
+        LexIO::GroupCommitWriter<LexIO::File> writer{std::move(file)};
+        for (size_t i = 0; i < TEST_TEXT_LENGTH; i += 5)
+        {
+            writer.Commit(&TEST_TEXT_DATA[i], LexIO::Detail::Min<size_t>(5, TEST_TEXT_LENGTH - i));
+        }
+    }
+
+    auto file = LexIO::FileOpen(filename, LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, file);
+    unlink(filename);
+    EXPECT_EQ(GetVectorStream().Container(), data);
+}
+
+#endif
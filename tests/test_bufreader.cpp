@@ -43,6 +43,18 @@ TEST(GenericBufReader, FulfillSeekable)
     EXPECT_TRUE(LexIO::IsSeekableV<VectorBufReader>);
 }
 
+TEST(GenericBufReader, SizeHint)
+{
+    auto bufReader = VectorBufReader{GetVectorStream()};
+    EXPECT_TRUE(LexIO::IsSizeHintV<VectorBufReader>);
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::SizeHint(bufReader));
+
+    // Buffered data counts towards the hint.
+    LexIO::FillBuffer(bufReader, 8);
+    LexIO::ConsumeBuffer(bufReader, 3);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 3, LexIO::SizeHint(bufReader));
+}
+
 TEST(GenericBufReader, DefCtor)
 {
     auto bufReader = VectorBufReader{};
@@ -358,3 +370,176 @@ TEST(GenericBufReader, ConsumeBufferTooLarge)
     LexIO::FillBuffer(bufReader, 8);
     EXPECT_ANY_THROW(LexIO::ConsumeBuffer(bufReader, 12));
 }
+
+TEST(GenericBufReader, ConsumeBufferThenRefill)
+{
+    auto bufReader = VectorBufReader{GetVectorStream()};
+
+    // Consume most of the buffer a few bytes at a time.
+    LexIO::FillBuffer(bufReader, 16);
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto test = LexIO::FillBuffer(bufReader, 4);
+        EXPECT_EQ(test.Data()[0], ::TEST_TEXT_DATA[i * 4]);
+        LexIO::ConsumeBuffer(bufReader, 4);
+    }
+
+    // The remaining data should be moved out of the way to make room.
+    auto test = LexIO::FillBuffer(bufReader, 16);
+    EXPECT_EQ(test.Size(), 16);
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(test.Data()[i], ::TEST_TEXT_DATA[12 + i]);
+    }
+}
+
+//******************************************************************************
+
+using VectorFixedBufReader = LexIO::FixedBufReader<LexIO::VectorStream>;
+using VectorFixedBufReaderNoCopy = LexIO::FixedBufReader<NoCopyStream<LexIO::VectorStream>>;
+
+TEST(FixedBufReader, FulfillBufferedReader)
+{
+    EXPECT_TRUE(LexIO::IsBufferedReaderV<VectorFixedBufReader>);
+}
+
+TEST(FixedBufReader, CopyCtor_CopyAssign)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+    LexIO::FillBuffer(bufReader, 8);
+    LexIO::ConsumeBuffer(bufReader, 4);
+    VectorFixedBufReader copyReader{bufReader};
+    auto copyTest = LexIO::FillBuffer(copyReader, 8);
+
+    EXPECT_EQ(copyTest.Data()[0], 'q');
+    EXPECT_EQ(copyTest.Data()[7], 'r');
+
+    auto assignReader = VectorFixedBufReader{};
+    assignReader = bufReader;
+    auto assignTest = LexIO::FillBuffer(assignReader, 8);
+
+    EXPECT_EQ(assignTest.Data()[0], 'q');
+    EXPECT_EQ(assignTest.Data()[7], 'r');
+}
+
+TEST(FixedBufReader, MoveCtor_MoveAssign)
+{
+    auto bufReader = VectorFixedBufReaderNoCopy{GetVectorStream(), 16};
+    LexIO::FillBuffer(bufReader, 8);
+    VectorFixedBufReaderNoCopy moveReader{std::move(bufReader)};
+    auto moveTest = LexIO::FillBuffer(moveReader, 8);
+
+    EXPECT_EQ(moveTest.Data()[0], 'T');
+    EXPECT_EQ(moveTest.Data()[7], 'c');
+
+    auto assignReader = VectorFixedBufReaderNoCopy{};
+    assignReader = std::move(moveReader);
+    auto assignTest = LexIO::FillBuffer(assignReader, 8);
+
+    EXPECT_EQ(assignTest.Data()[0], 'T');
+    EXPECT_EQ(assignTest.Data()[7], 'c');
+}
+
+TEST(FixedBufReader, ReadAhead)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    // A small read should fill the entire buffer at once.
+    uint8_t data[4] = {0};
+    EXPECT_EQ(4, LexIO::Read(data, bufReader));
+    EXPECT_EQ(data[0], 'T');
+    EXPECT_EQ(data[3], ' ');
+    EXPECT_EQ(12, LexIO::GetBuffer(bufReader).Size());
+}
+
+TEST(FixedBufReader, ReadAheadDisabled)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16, 0};
+
+    uint8_t data[4] = {0};
+    EXPECT_EQ(4, LexIO::Read(data, bufReader));
+    EXPECT_EQ(0, LexIO::GetBuffer(bufReader).Size());
+}
+
+TEST(FixedBufReader, ReadBypass)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    // A read larger than the buffer should not touch it.
+    uint8_t data[24] = {0};
+    EXPECT_EQ(24, LexIO::Read(data, bufReader));
+    EXPECT_EQ(data[0], 'T');
+    EXPECT_EQ(data[23], 'p');
+    EXPECT_EQ(0, LexIO::GetBuffer(bufReader).Size());
+
+    // Subsequent small reads are buffered again.
+    EXPECT_EQ(4, LexIO::Read(data, bufReader, 4));
+    EXPECT_EQ(data[0], 's');
+    EXPECT_EQ(12, LexIO::GetBuffer(bufReader).Size());
+}
+
+TEST(FixedBufReader, FillBufferCompact)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    LexIO::FillBuffer(bufReader, 16);
+    LexIO::ConsumeBuffer(bufReader, 12);
+
+    // Remaining data is moved to the front to make room.
+    auto test = LexIO::FillBuffer(bufReader, 16);
+    EXPECT_EQ(test.Size(), 16);
+    for (size_t i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(test.Data()[i], ::TEST_TEXT_DATA[12 + i]);
+    }
+}
+
+TEST(FixedBufReader, FillBufferEOF)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 64};
+
+    auto test = LexIO::FillBuffer(bufReader, 64);
+    EXPECT_EQ(test.Size(), TEST_TEXT_LENGTH);
+    EXPECT_EQ(test.Data()[TEST_TEXT_LENGTH - 1], '\n');
+}
+
+TEST(FixedBufReader, FillBufferTooLarge)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    EXPECT_ANY_THROW(LexIO::FillBuffer(bufReader, 17));
+}
+
+TEST(FixedBufReader, TryFillBuffer)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    LexIO::BufferView test;
+    EXPECT_FALSE(bufReader.LexTryFillBuffer(test, 16));
+    EXPECT_EQ(test.Size(), 16);
+    EXPECT_EQ(test.Data()[0], 'T');
+
+    // Overfilling is reported as an error instead of thrown.
+    const LexIO::Error err = bufReader.LexTryFillBuffer(test, 17);
+    EXPECT_TRUE(err);
+    EXPECT_STREQ(err.Message(), "can't fill buffer past its capacity");
+}
+
+TEST(FixedBufReader, ConsumeBufferTooLarge)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    LexIO::FillBuffer(bufReader, 8);
+    EXPECT_ANY_THROW(LexIO::ConsumeBuffer(bufReader, 17));
+}
+
+TEST(FixedBufReader, FillBufferSeek)
+{
+    auto bufReader = VectorFixedBufReader{GetVectorStream(), 16};
+
+    LexIO::FillBuffer(bufReader, 4);
+    LexIO::Seek(bufReader, 8, LexIO::Whence::start);
+    auto view = LexIO::FillBuffer(bufReader, 4);
+    EXPECT_EQ(view.Data()[0], 'k');
+    EXPECT_EQ(view.Data()[3], 'r');
+}
@@ -26,6 +26,87 @@ using VectorBufWriterNoCopy = LexIO::FixedBufWriter<NoCopyStream<LexIO::VectorSt
 #pragma clang diagnostic ignored "-Wself-move"
 #endif
 
+class FlushCountStream
+{
+    LexIO::VectorStream m_stream;
+    size_t m_flushes = 0;
+
+  public:
+    size_t Flushes() const { return m_flushes; }
+    const LexIO::VectorStream &Stream() const { return m_stream; }
+
+    size_t LexWrite(const uint8_t *src, const size_t count) { return m_stream.LexWrite(src, count); }
+    void LexFlush() { m_flushes += 1; }
+};
+
+class CallCountStream
+{
+    LexIO::VectorStream m_stream;
+    size_t m_writes = 0;
+    size_t m_writeVs = 0;
+
+  public:
+    size_t Writes() const { return m_writes; }
+    size_t WriteVs() const { return m_writeVs; }
+    const LexIO::VectorStream &Stream() const { return m_stream; }
+
+    size_t LexWrite(const uint8_t *src, const size_t count)
+    {
+        m_writes += 1;
+        return m_stream.LexWrite(src, count);
+    }
+
+    size_t LexWriteV(const LexIO::BufferView *bufs, const size_t count)
+    {
+        m_writeVs += 1;
+        return m_stream.LexWriteV(bufs, count);
+    }
+
+    void LexFlush() {}
+};
+
+/**
+ * @brief A VectoredWriter that accepts a limited number of bytes and then
+ *        reports EOF-like conditions, like a full pipe or socket, or throws
+ *        like a pipe whose reader went away.
+ */
+class LimitStream
+{
+    LexIO::VectorStream m_stream;
+
+    size_t *m_limit = nullptr;
+    bool m_throws = false;
+
+  public:
+    LimitStream(size_t *limit, bool throws = false) : m_limit(limit), m_throws(throws) {}
+
+    const LexIO::VectorStream &Stream() const { return m_stream; }
+
+    size_t LexWrite(const uint8_t *src, const size_t count)
+    {
+        if (m_throws && *m_limit == 0 && count != 0)
+        {
+            throw std::runtime_error("limit reached");
+        }
+
+        const size_t written = m_stream.LexWrite(src, LexIO::Detail::Min(count, *m_limit));
+        *m_limit -= written;
+        return written;
+    }
+
+    size_t LexWriteV(const LexIO::BufferView *bufs, const size_t count)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count && (i == 0 || *m_limit != 0); i++)
+        {
+            total += LexWrite(bufs[i].Data(), bufs[i].Size());
+        }
+        return total;
+    }
+
+    void LexFlush() {}
+};
+
 //******************************************************************************
 
 TEST(FixedBufWriter, FulfillWriter)
@@ -132,6 +213,17 @@ TEST(FixedBufWriter, Write)
     EXPECT_EQ(::TEST_TEXT_LENGTH, LexIO::Length(stream));
 }
 
+TEST(FixedBufWriter, Length)
+{
+    auto bufWriter = VectorBufWriter{LexIO::VectorStream{}, 16};
+    EXPECT_TRUE(LexIO::IsSizedV<VectorBufWriter>);
+
+    // Length includes data that hasn't been flushed yet.
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[0], 8);
+    EXPECT_EQ(8, LexIO::Length(bufWriter));
+    EXPECT_EQ(8, LexIO::Tell(bufWriter));
+}
+
 TEST(FixedBufWriter, WriteSmallBuffer)
 {
     auto stream = LexIO::VectorStream{};
@@ -177,3 +269,163 @@ TEST(FixedBufWriter, Seek)
         EXPECT_EQ(bufWriter.Writer().Container()[i], data[i]);
     }
 }
+
+TEST(FixedBufWriter, DrainWithoutFlush)
+{
+    auto bufWriter = LexIO::FixedBufWriter<FlushCountStream>{FlushCountStream{}, 16};
+
+    // Overflowing the buffer drains it, but must not flush the wrapped writer.
+    for (size_t i = 0; i < TEST_TEXT_LENGTH; i += 5)
+    {
+        LexIO::Write(bufWriter, &::TEST_TEXT_DATA[i], 5);
+    }
+    EXPECT_EQ(0, bufWriter.Writer().Flushes());
+    EXPECT_LT(0, bufWriter.Writer().Stream().Container().size());
+
+    bufWriter.FlushBuffer();
+    EXPECT_EQ(0, bufWriter.Writer().Flushes());
+    EXPECT_EQ(TEST_TEXT_LENGTH, bufWriter.Writer().Stream().Container().size());
+
+    LexIO::Flush(bufWriter);
+    EXPECT_EQ(1, bufWriter.Writer().Flushes());
+}
+
+TEST(FixedBufWriter, WriteGathered)
+{
+    auto bufWriter = LexIO::FixedBufWriter<CallCountStream>{CallCountStream{}, 16};
+
+    // An overflowing write goes out with the buffer in a single call.
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[0], 5);
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[5], 20);
+    EXPECT_EQ(0, bufWriter.Writer().Writes());
+    EXPECT_EQ(1, bufWriter.Writer().WriteVs());
+
+    const auto &vec = bufWriter.Writer().Stream().Container();
+    ASSERT_EQ(25, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 25));
+}
+
+TEST(FixedBufWriter, WriteV)
+{
+    auto bufWriter = LexIO::FixedBufWriter<CallCountStream>{CallCountStream{}, 16};
+
+    // Small gathered writes are buffered.
+    const LexIO::BufferView small[] = {{&::TEST_TEXT_DATA[0], 4}, {&::TEST_TEXT_DATA[4], 6}};
+    EXPECT_EQ(10, LexIO::WriteV(bufWriter, &small[0], 2));
+    EXPECT_EQ(0, bufWriter.Writer().WriteVs());
+
+    // Large gathered writes go out with the buffer in a single call.
+    const LexIO::BufferView large[] = {{&::TEST_TEXT_DATA[10], 10}, {&::TEST_TEXT_DATA[20], 25}};
+    EXPECT_EQ(35, LexIO::WriteV(bufWriter, &large[0], 2));
+    EXPECT_EQ(1, bufWriter.Writer().WriteVs());
+
+    const auto &vec = bufWriter.Writer().Stream().Container();
+    ASSERT_EQ(TEST_TEXT_LENGTH, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], TEST_TEXT_LENGTH));
+}
+
+TEST(FixedBufWriter, WriteGatheredShort)
+{
+    size_t limit = 5;
+    auto bufWriter = LexIO::FixedBufWriter<LimitStream>{LimitStream{&limit}, 16};
+
+    // The gathered write only gets part of the buffer out, and draining the
+    // rest fails.
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[0], 12);
+    EXPECT_THROW(LexIO::Write(bufWriter, &::TEST_TEXT_DATA[12], 20), std::runtime_error);
+
+    // Once the writer has room again, the rest of the buffer is written
+    // exactly once.
+    limit = 100;
+    bufWriter.FlushBuffer();
+    const auto &vec = bufWriter.Writer().Stream().Container();
+    ASSERT_EQ(12, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 12));
+
+    EXPECT_EQ(20, LexIO::Write(bufWriter, &::TEST_TEXT_DATA[12], 20));
+    bufWriter.FlushBuffer();
+    ASSERT_EQ(32, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 32));
+}
+
+TEST(FixedBufWriter, FlushBufferThrows)
+{
+    size_t limit = 5;
+    auto bufWriter = LexIO::FixedBufWriter<LimitStream>{LimitStream{&limit, true}, 16};
+
+    // Part of the buffer goes out before the writer throws.
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[0], 12);
+    EXPECT_THROW(bufWriter.FlushBuffer(), std::runtime_error);
+
+    // Retrying only writes what's left.
+    limit = 100;
+    bufWriter.FlushBuffer();
+    const auto &vec = bufWriter.Writer().Stream().Container();
+    ASSERT_EQ(12, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 12));
+}
+
+TEST(FixedBufWriter, WriteGatheredThrows)
+{
+    size_t limit = 5;
+    auto bufWriter = LexIO::FixedBufWriter<LimitStream>{LimitStream{&limit, true}, 16};
+    const auto &vec = bufWriter.Writer().Stream().Container();
+
+    // The gathered write gets part of the buffer out before the writer
+    // throws, the rest of the buffer is written exactly once.
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[0], 12);
+    EXPECT_THROW(LexIO::Write(bufWriter, &::TEST_TEXT_DATA[12], 20), std::runtime_error);
+    limit = 100;
+    bufWriter.FlushBuffer();
+    ASSERT_EQ(12, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 12));
+
+    // Same, but the whole buffer and part of the passed data get out.
+    limit = 15;
+    LexIO::Write(bufWriter, &::TEST_TEXT_DATA[12], 12);
+    EXPECT_THROW(LexIO::Write(bufWriter, &::TEST_TEXT_DATA[24], 20), std::runtime_error);
+    limit = 100;
+    bufWriter.FlushBuffer();
+    ASSERT_EQ(27, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], 27));
+}
+
+TEST(FixedBufWriter, WriteVUnvectored)
+{
+    auto bufWriter = LexIO::FixedBufWriter<FlushCountStream>{FlushCountStream{}, 16};
+
+    const LexIO::BufferView bufs[] = {
+        {&::TEST_TEXT_DATA[0], 4}, {&::TEST_TEXT_DATA[4], 20}, {&::TEST_TEXT_DATA[24], 21}};
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::WriteV(bufWriter, &bufs[0], 3));
+    bufWriter.FlushBuffer();
+
+    const auto &vec = bufWriter.Writer().Stream().Container();
+    ASSERT_EQ(TEST_TEXT_LENGTH, vec.size());
+    EXPECT_EQ(0, std::memcmp(vec.data(), &::TEST_TEXT_DATA[0], TEST_TEXT_LENGTH));
+}
+
+TEST(FixedBufWriter, ReserveCommit)
+{
+    auto bufWriter = LexIO::FixedBufWriter<CallCountStream>{CallCountStream{}, 8};
+    EXPECT_TRUE(LexIO::IsBufferedWriterV<decltype(bufWriter)>);
+
+    LexIO::MutableBufferView view = LexIO::Reserve(bufWriter, 4);
+    EXPECT_EQ(8, view.Size());
+    std::memcpy(view.Data(), "XYZZ", 4);
+    LexIO::Commit(bufWriter, 4);
+    EXPECT_EQ(0, bufWriter.Writer().Writes());
+
+    // Reservation doesn't fit behind the buffered data, so it's drained.
+    view = LexIO::Reserve(bufWriter, 6);
+    EXPECT_EQ(1, bufWriter.Writer().Writes());
+    EXPECT_EQ(8, view.Size());
+    view.Data()[0] = 'Y';
+    LexIO::Commit(bufWriter, 1);
+    LexIO::Flush(bufWriter);
+
+    const std::vector<uint8_t> expected = {'X', 'Y', 'Z', 'Z', 'Y'};
+    EXPECT_EQ(expected, bufWriter.Writer().Stream().Container());
+
+    EXPECT_ANY_THROW(LexIO::Reserve(bufWriter, 9));
+    EXPECT_ANY_THROW(LexIO::Commit(bufWriter, 9));
+}
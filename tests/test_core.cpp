@@ -19,6 +19,7 @@
 #include "./test.h"
 #include "lexio/serialize/int.hpp"
 #include <array>
+#include <cerrno>
 
 #if defined(__clang__)
 #pragma clang diagnostic ignored "-Wself-assign-overloaded"
@@ -100,6 +101,141 @@ TEST(Seekable, IsSeekableV)
 
 //******************************************************************************
 
+struct GoodPositionalReader
+{
+    size_t LexReadAt(uint8_t *, const size_t, const size_t) { return 0; }
+};
+
+TEST(PositionalReader, IsPositionalReader)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReader<GoodPositionalReader>::value);
+}
+
+TEST(PositionalReader, IsPositionalReaderV)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<GoodPositionalReader>);
+    EXPECT_FALSE(LexIO::IsPositionalReaderV<GoodReader>);
+}
+
+//******************************************************************************
+
+struct GoodPositionalWriter
+{
+    size_t LexWriteAt(const uint8_t *, const size_t, const size_t) { return 0; }
+};
+
+TEST(PositionalWriter, IsPositionalWriter)
+{
+    EXPECT_TRUE(LexIO::IsPositionalWriter<GoodPositionalWriter>::value);
+}
+
+TEST(PositionalWriter, IsPositionalWriterV)
+{
+    EXPECT_TRUE(LexIO::IsPositionalWriterV<GoodPositionalWriter>);
+    EXPECT_FALSE(LexIO::IsPositionalWriterV<GoodWriter>);
+}
+
+//******************************************************************************
+
+struct GoodVectoredReader : public GoodReader
+{
+    size_t LexReadV(const LexIO::MutableBufferView *, const size_t) { return 0; }
+};
+
+TEST(VectoredReader, IsVectoredReader)
+{
+    EXPECT_TRUE(LexIO::IsVectoredReader<GoodVectoredReader>::value);
+}
+
+TEST(VectoredReader, IsVectoredReaderV)
+{
+    EXPECT_TRUE(LexIO::IsVectoredReaderV<GoodVectoredReader>);
+    EXPECT_FALSE(LexIO::IsVectoredReaderV<GoodReader>);
+}
+
+//******************************************************************************
+
+struct GoodVectoredWriter : public GoodWriter
+{
+    size_t LexWriteV(const LexIO::BufferView *, const size_t) { return 0; }
+};
+
+TEST(VectoredWriter, IsVectoredWriter)
+{
+    EXPECT_TRUE(LexIO::IsVectoredWriter<GoodVectoredWriter>::value);
+}
+
+TEST(VectoredWriter, IsVectoredWriterV)
+{
+    EXPECT_TRUE(LexIO::IsVectoredWriterV<GoodVectoredWriter>);
+    EXPECT_FALSE(LexIO::IsVectoredWriterV<GoodWriter>);
+}
+
+//******************************************************************************
+
+struct GoodBufferedWriter : public GoodWriter
+{
+    LexIO::MutableBufferView LexReserve(const size_t) { return LexIO::MutableBufferView{}; }
+    void LexCommit(const size_t) {}
+};
+
+TEST(BufferedWriter, IsBufferedWriter)
+{
+    EXPECT_TRUE(LexIO::IsBufferedWriter<GoodBufferedWriter>::value);
+}
+
+TEST(BufferedWriter, IsBufferedWriterV)
+{
+    EXPECT_TRUE(LexIO::IsBufferedWriterV<GoodBufferedWriter>);
+    EXPECT_FALSE(LexIO::IsBufferedWriterV<GoodWriter>);
+}
+
+//******************************************************************************
+
+struct GoodTryStream : public GoodBufferedReader, public GoodWriter
+{
+    LexIO::Error LexTryRead(size_t &, uint8_t *, const size_t) { return LexIO::Error{}; }
+    LexIO::Error LexTryFillBuffer(LexIO::BufferView &, const size_t) { return LexIO::Error{}; }
+    LexIO::Error LexTryWrite(size_t &, const uint8_t *, const size_t) { return LexIO::Error{}; }
+};
+
+TEST(TryReader, IsTryReaderV)
+{
+    EXPECT_TRUE(LexIO::IsTryReader<GoodTryStream>::value);
+    EXPECT_TRUE(LexIO::IsTryReaderV<GoodTryStream>);
+    EXPECT_FALSE(LexIO::IsTryReaderV<GoodReader>);
+}
+
+TEST(TryBufferedReader, IsTryBufferedReaderV)
+{
+    EXPECT_TRUE(LexIO::IsTryBufferedReader<GoodTryStream>::value);
+    EXPECT_TRUE(LexIO::IsTryBufferedReaderV<GoodTryStream>);
+    EXPECT_FALSE(LexIO::IsTryBufferedReaderV<GoodBufferedReader>);
+}
+
+TEST(TryWriter, IsTryWriterV)
+{
+    EXPECT_TRUE(LexIO::IsTryWriter<GoodTryStream>::value);
+    EXPECT_TRUE(LexIO::IsTryWriterV<GoodTryStream>);
+    EXPECT_FALSE(LexIO::IsTryWriterV<GoodWriter>);
+}
+
+TEST(Error, Error)
+{
+    constexpr LexIO::Error ok{};
+    EXPECT_FALSE(ok);
+    EXPECT_EQ(ok.Message(), nullptr);
+
+    const LexIO::Error err{"intended", EIO};
+    EXPECT_TRUE(err);
+    EXPECT_STREQ(err.Message(), "intended");
+    EXPECT_EQ(err.SysError(), EIO);
+    EXPECT_FALSE(err.IsException());
+    EXPECT_TRUE(LexIO::Error::Exception().IsException());
+}
+
+//******************************************************************************
+
 struct BadReaderMissingClass
 {
 };
@@ -186,9 +322,7 @@ TEST(BufferedReaderRef, CopyCtor)
 TEST(BufferedReaderRef, ManualCtor)
 {
     auto test = GoodBufferedReader{};
-    LexIO::BufferedReaderRef ref(&test, LexIO::Detail::WrapRead<GoodBufferedReader>,
-                                 LexIO::Detail::WrapFillBuffer<GoodBufferedReader>,
-                                 LexIO::Detail::WrapConsumeBuffer<GoodBufferedReader>);
+    LexIO::BufferedReaderRef ref(&test, &LexIO::Detail::VTableFor<GoodBufferedReader>::value);
 }
 
 TEST(BufferedReaderRef, CopyAssign)
@@ -239,7 +373,7 @@ TEST(UnbufferedReaderRef, CopyCtor)
 TEST(UnbufferedReaderRef, ManualCtor)
 {
     auto test = GoodReader{};
-    LexIO::UnbufferedReaderRef ref(&test, LexIO::Detail::WrapRead<GoodReader>);
+    LexIO::UnbufferedReaderRef ref(&test, &LexIO::Detail::VTableFor<GoodReader>::value);
 }
 
 TEST(UnbufferedReaderRef, CopyAssign)
@@ -285,7 +419,7 @@ TEST(WriterRef, CopyCtor)
 TEST(WriterRef, ManualCtor)
 {
     auto test = GoodWriter{};
-    LexIO::WriterRef ref(&test, LexIO::Detail::WrapWrite<GoodWriter>, LexIO::Detail::WrapFlush<GoodWriter>);
+    LexIO::WriterRef ref(&test, &LexIO::Detail::VTableFor<GoodWriter>::value);
 }
 
 TEST(WriterRef, CopyAssign)
@@ -329,7 +463,7 @@ TEST(SeekableRef, CopyCtor)
 TEST(WriterRef, SeekableCtor)
 {
     auto test = GoodSeekable{};
-    LexIO::SeekableRef ref(&test, LexIO::Detail::WrapSeek<GoodSeekable>);
+    LexIO::SeekableRef ref(&test, &LexIO::Detail::VTableFor<GoodSeekable>::value);
 }
 
 TEST(SeekableRef, CopyAssign)
@@ -359,6 +493,333 @@ TEST(SeekableRef, Call)
 
 //******************************************************************************
 
+struct GoodReadSeeker : public GoodReader, public GoodSeekable
+{
+};
+
+struct GoodStream : public GoodReader, public GoodWriter, public GoodSeekable
+{
+};
+
+TEST(ReadSeekRef, CopyCtor)
+{
+    auto test = GoodReadSeeker{};
+    LexIO::ReadSeekRef ref(test);
+    LexIO::ReadSeekRef copy(ref);
+}
+
+TEST(ReadSeekRef, ManualCtor)
+{
+    auto test = GoodReadSeeker{};
+    LexIO::ReadSeekRef ref(&test, &LexIO::Detail::VTableFor<GoodReadSeeker>::value);
+}
+
+TEST(ReadSeekRef, CopyAssign)
+{
+    auto test = GoodReadSeeker{};
+    LexIO::ReadSeekRef ref(test);
+    LexIO::ReadSeekRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(ReadSeekRef, Accept)
+{
+    auto test = GoodReadSeeker{};
+    LexIO::ReadSeekRef ref(test);
+
+    EXPECT_NO_THROW(AcceptReader(ref));
+    EXPECT_NO_THROW(AcceptSeekable(ref));
+}
+
+TEST(ReadSeekRef, Call)
+{
+    uint8_t buffer[4] = {0};
+    auto test = GoodReadSeeker{};
+    LexIO::ReadSeekRef ref(test);
+
+    EXPECT_EQ(LexIO::RawRead(&buffer[0], ref, sizeof(buffer)), 0);
+    EXPECT_EQ(LexIO::Seek(ref, LexIO::SeekPos{}), 0);
+}
+
+TEST(StreamRef, CopyCtor)
+{
+    auto test = GoodStream{};
+    LexIO::StreamRef ref(test);
+    LexIO::StreamRef copy(ref);
+}
+
+TEST(StreamRef, ManualCtor)
+{
+    auto test = GoodStream{};
+    LexIO::StreamRef ref(&test, &LexIO::Detail::VTableFor<GoodStream>::value);
+}
+
+TEST(StreamRef, CopyAssign)
+{
+    auto test = GoodStream{};
+    LexIO::StreamRef ref(test);
+    LexIO::StreamRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(StreamRef, Accept)
+{
+    auto test = GoodStream{};
+    LexIO::StreamRef ref(test);
+
+    EXPECT_NO_THROW(AcceptReader(ref));
+    EXPECT_NO_THROW(AcceptWriter(ref));
+    EXPECT_NO_THROW(AcceptSeekable(ref));
+    EXPECT_NO_THROW(LexIO::ReadSeekRef{ref});
+}
+
+TEST(StreamRef, Call)
+{
+    uint8_t buffer[4] = {0};
+    auto test = GoodStream{};
+    LexIO::StreamRef ref(test);
+
+    EXPECT_EQ(LexIO::RawRead(&buffer[0], ref, sizeof(buffer)), 0);
+    EXPECT_EQ(LexIO::RawWrite(ref, &buffer[0], sizeof(buffer)), 0);
+    EXPECT_NO_THROW(LexIO::Flush(ref));
+    EXPECT_EQ(LexIO::Seek(ref, LexIO::SeekPos{}), 0);
+}
+
+TEST(StreamRef, VectorStream)
+{
+    auto stream = GetVectorStream();
+    const LexIO::StreamRef ref{stream};
+    static_assert(sizeof(ref) == sizeof(void *) * 2, "Refs should be two pointers wide");
+
+    uint8_t buffer[3] = {0};
+    LexIO::Seek(ref, 4, LexIO::Whence::start);
+    EXPECT_EQ(LexIO::Read(buffer, ref), 3);
+    EXPECT_EQ(buffer[0], 'q');
+    LexIO::Write(ref, buffer);
+    EXPECT_EQ(LexIO::Tell(ref), 10);
+}
+
+//******************************************************************************
+
+static void AcceptPositionalReader(LexIO::PositionalReaderRef) {}
+
+TEST(PositionalReaderRef, CopyCtor)
+{
+    auto test = GoodPositionalReader{};
+    LexIO::PositionalReaderRef ref(test);
+    LexIO::PositionalReaderRef copy(ref);
+}
+
+TEST(PositionalReaderRef, ManualCtor)
+{
+    auto test = GoodPositionalReader{};
+    LexIO::PositionalReaderRef ref(&test, &LexIO::Detail::VTableFor<GoodPositionalReader>::value);
+}
+
+TEST(PositionalReaderRef, CopyAssign)
+{
+    auto test = GoodPositionalReader{};
+    LexIO::PositionalReaderRef ref(test);
+    LexIO::PositionalReaderRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(PositionalReaderRef, Accept)
+{
+    auto test = GoodPositionalReader{};
+    LexIO::PositionalReaderRef ref(test);
+
+    EXPECT_NO_THROW(AcceptPositionalReader(ref));
+}
+
+TEST(PositionalReaderRef, Call)
+{
+    uint8_t buffer[4];
+    auto test = GoodPositionalReader{};
+    LexIO::PositionalReaderRef ref(test);
+
+    EXPECT_EQ(LexIO::ReadAt(&buffer[0], ref, sizeof(buffer), 0), 0);
+}
+
+//******************************************************************************
+
+static void AcceptPositionalWriter(LexIO::PositionalWriterRef) {}
+
+TEST(PositionalWriterRef, CopyCtor)
+{
+    auto test = GoodPositionalWriter{};
+    LexIO::PositionalWriterRef ref(test);
+    LexIO::PositionalWriterRef copy(ref);
+}
+
+TEST(PositionalWriterRef, ManualCtor)
+{
+    auto test = GoodPositionalWriter{};
+    LexIO::PositionalWriterRef ref(&test, &LexIO::Detail::VTableFor<GoodPositionalWriter>::value);
+}
+
+TEST(PositionalWriterRef, CopyAssign)
+{
+    auto test = GoodPositionalWriter{};
+    LexIO::PositionalWriterRef ref(test);
+    LexIO::PositionalWriterRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(PositionalWriterRef, Accept)
+{
+    auto test = GoodPositionalWriter{};
+    LexIO::PositionalWriterRef ref(test);
+
+    EXPECT_NO_THROW(AcceptPositionalWriter(ref));
+}
+
+TEST(PositionalWriterRef, Call)
+{
+    uint8_t buffer[4] = {0};
+    auto test = GoodPositionalWriter{};
+    LexIO::PositionalWriterRef ref(test);
+
+    EXPECT_EQ(LexIO::WriteAt(ref, &buffer[0], sizeof(buffer), 0), 0);
+}
+
+//******************************************************************************
+
+TEST(VectoredReaderRef, CopyCtor)
+{
+    auto test = GoodVectoredReader{};
+    LexIO::VectoredReaderRef ref(test);
+    LexIO::VectoredReaderRef copy(ref);
+}
+
+TEST(VectoredReaderRef, ManualCtor)
+{
+    auto test = GoodVectoredReader{};
+    LexIO::VectoredReaderRef ref(&test, &LexIO::Detail::VTableFor<GoodVectoredReader>::value);
+}
+
+TEST(VectoredReaderRef, CopyAssign)
+{
+    auto test = GoodVectoredReader{};
+    LexIO::VectoredReaderRef ref(test);
+    LexIO::VectoredReaderRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(VectoredReaderRef, Accept)
+{
+    auto test = GoodVectoredReader{};
+    LexIO::VectoredReaderRef ref(test);
+
+    EXPECT_NO_THROW(AcceptReader(ref));
+}
+
+TEST(VectoredReaderRef, Call)
+{
+    uint8_t buffer[4];
+    auto test = GoodVectoredReader{};
+    LexIO::VectoredReaderRef ref(test);
+
+    const LexIO::MutableBufferView bufs[] = {{&buffer[0], 2}, {&buffer[2], 2}};
+    EXPECT_EQ(LexIO::RawRead(&buffer[0], ref, sizeof(buffer)), 0);
+    EXPECT_EQ(LexIO::ReadV(&bufs[0], ref, 2), 0);
+}
+
+//******************************************************************************
+
+TEST(VectoredWriterRef, CopyCtor)
+{
+    auto test = GoodVectoredWriter{};
+    LexIO::VectoredWriterRef ref(test);
+    LexIO::VectoredWriterRef copy(ref);
+}
+
+TEST(VectoredWriterRef, ManualCtor)
+{
+    auto test = GoodVectoredWriter{};
+    LexIO::VectoredWriterRef ref(&test, &LexIO::Detail::VTableFor<GoodVectoredWriter>::value);
+}
+
+TEST(VectoredWriterRef, CopyAssign)
+{
+    auto test = GoodVectoredWriter{};
+    LexIO::VectoredWriterRef ref(test);
+    LexIO::VectoredWriterRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(VectoredWriterRef, Accept)
+{
+    auto test = GoodVectoredWriter{};
+    LexIO::VectoredWriterRef ref(test);
+
+    EXPECT_NO_THROW(AcceptWriter(ref));
+}
+
+TEST(VectoredWriterRef, Call)
+{
+    uint8_t buffer[4] = {0};
+    auto test = GoodVectoredWriter{};
+    LexIO::VectoredWriterRef ref(test);
+
+    const LexIO::BufferView bufs[] = {{&buffer[0], 2}, {&buffer[2], 2}};
+    EXPECT_EQ(LexIO::RawWrite(ref, &buffer[0], sizeof(buffer)), 0);
+    EXPECT_NO_THROW(LexIO::Flush(ref));
+    EXPECT_EQ(LexIO::WriteV(ref, &bufs[0], 2), 0);
+}
+
+//******************************************************************************
+
+TEST(BufferedWriterRef, CopyCtor)
+{
+    auto test = GoodBufferedWriter{};
+    LexIO::BufferedWriterRef ref(test);
+    LexIO::BufferedWriterRef copy(ref);
+}
+
+TEST(BufferedWriterRef, ManualCtor)
+{
+    auto test = GoodBufferedWriter{};
+    LexIO::BufferedWriterRef ref(&test, &LexIO::Detail::VTableFor<GoodBufferedWriter>::value);
+}
+
+TEST(BufferedWriterRef, CopyAssign)
+{
+    auto test = GoodBufferedWriter{};
+    LexIO::BufferedWriterRef ref(test);
+    LexIO::BufferedWriterRef copy(test);
+    copy = ref;
+    copy = copy;
+}
+
+TEST(BufferedWriterRef, Accept)
+{
+    auto test = GoodBufferedWriter{};
+    LexIO::BufferedWriterRef ref(test);
+
+    EXPECT_NO_THROW(AcceptWriter(ref));
+}
+
+TEST(BufferedWriterRef, Call)
+{
+    uint8_t buffer[4] = {0};
+    auto test = GoodBufferedWriter{};
+    LexIO::BufferedWriterRef ref(test);
+
+    EXPECT_EQ(LexIO::RawWrite(ref, &buffer[0], sizeof(buffer)), 0);
+    EXPECT_NO_THROW(LexIO::Flush(ref));
+    EXPECT_EQ(LexIO::Reserve(ref, 0).Size(), 0);
+    EXPECT_NO_THROW(LexIO::Commit(ref, 0));
+}
+
+//******************************************************************************
+
 TEST(Reader, RawRead)
 {
     auto stream = GetVectorStream();
@@ -706,3 +1167,178 @@ TEST(Seekable, Length)
 
     EXPECT_EQ(LexIO::Length(stream), TEST_TEXT_LENGTH);
 }
+
+struct CountingSeekStream
+{
+    size_t seeks = 0;
+    size_t LexSeek(const LexIO::SeekPos &)
+    {
+        seeks += 1;
+        return 0;
+    }
+};
+
+struct CountingSizedStream : public CountingSeekStream
+{
+    size_t LexLength() { return 42; }
+};
+
+TEST(Seekable, LengthSized)
+{
+    EXPECT_TRUE(LexIO::IsSizedV<CountingSizedStream>);
+    EXPECT_TRUE(LexIO::IsSizedV<LexIO::VectorStream>);
+    EXPECT_FALSE(LexIO::IsSizedV<CountingSeekStream>);
+
+    CountingSizedStream sized;
+    EXPECT_EQ(42, LexIO::Length(sized));
+    EXPECT_EQ(0, sized.seeks);
+
+    // Streams that aren't Sized still work, by seeking.
+    CountingSeekStream unsized;
+    LexIO::Length(unsized);
+    EXPECT_EQ(3, unsized.seeks);
+}
+
+//******************************************************************************
+
+TEST(PositionalReader, ReadAt)
+{
+    LexIO::VectorStream stream = GetVectorStream();
+
+    uint8_t buffer[5] = {0};
+    EXPECT_EQ(LexIO::ReadAt(&buffer[0], stream, sizeof(buffer), 4), 5);
+    EXPECT_EQ(std::memcmp(&buffer[0], "quick", 5), 0);
+    EXPECT_EQ(LexIO::Tell(stream), 0);
+}
+
+TEST(PositionalReader, ReadAtPartial)
+{
+    LexIO::VectorStream stream = GetVectorStream();
+
+    uint8_t buffer[8] = {0};
+    EXPECT_EQ(LexIO::ReadAt(&buffer[0], stream, sizeof(buffer), TEST_TEXT_LENGTH - 5), 5);
+    EXPECT_EQ(std::memcmp(&buffer[0], "dog.\n", 5), 0);
+    EXPECT_EQ(LexIO::ReadAt(&buffer[0], stream, sizeof(buffer), TEST_TEXT_LENGTH + 4), 0);
+}
+
+TEST(PositionalWriter, WriteAt)
+{
+    LexIO::VectorStream stream = GetVectorStream();
+
+    const uint8_t data[] = {'X', 'Y', 'Z'};
+    EXPECT_EQ(LexIO::WriteAt(stream, &data[0], sizeof(data), 4), 3);
+    EXPECT_EQ(LexIO::Tell(stream), 0);
+    EXPECT_EQ(stream.Container()[3], ' ');
+    EXPECT_EQ(stream.Container()[4], 'X');
+    EXPECT_EQ(stream.Container()[5], 'Y');
+    EXPECT_EQ(stream.Container()[6], 'Z');
+    EXPECT_EQ(stream.Container()[7], 'c');
+}
+
+//******************************************************************************
+
+/**
+ * @brief Vectored stream that only services the first buffer, three bytes
+ *        at a time.
+ */
+class ShortVectoredStream
+{
+    LexIO::VectorStream m_stream;
+
+  public:
+    ShortVectoredStream(LexIO::VectorStream &&stream) : m_stream(stream) {}
+
+    const LexIO::VectorStream &Stream() const { return m_stream; }
+
+    size_t LexRead(uint8_t *outDest, const size_t count) { return m_stream.LexRead(outDest, count); }
+
+    size_t LexReadV(const LexIO::MutableBufferView *bufs, const size_t count)
+    {
+        return count == 0 ? 0 : m_stream.LexRead(bufs[0].Data(), std::min<size_t>(bufs[0].Size(), 3));
+    }
+
+    size_t LexWrite(const uint8_t *src, const size_t count) { return m_stream.LexWrite(src, count); }
+
+    size_t LexWriteV(const LexIO::BufferView *bufs, const size_t count)
+    {
+        return count == 0 ? 0 : m_stream.LexWrite(bufs[0].Data(), std::min<size_t>(bufs[0].Size(), 3));
+    }
+
+    void LexFlush() {}
+};
+
+TEST(VectoredReader, ReadV)
+{
+    LexIO::VectorStream stream = GetVectorStream();
+
+    uint8_t first[4] = {0}, second[6] = {0};
+    const LexIO::MutableBufferView bufs[] = {{&first[0], 4}, {nullptr, 0}, {&second[0], 6}};
+    EXPECT_EQ(LexIO::ReadV(&bufs[0], stream, 3), 10);
+    EXPECT_EQ(std::memcmp(&first[0], "The ", 4), 0);
+    EXPECT_EQ(std::memcmp(&second[0], "quick ", 6), 0);
+    EXPECT_EQ(LexIO::Tell(stream), 10);
+}
+
+TEST(VectoredReader, ReadVPartial)
+{
+    ShortVectoredStream stream{GetVectorStream()};
+
+    uint8_t first[4] = {0}, second[6] = {0};
+    const LexIO::MutableBufferView bufs[] = {{&first[0], 4}, {&second[0], 6}};
+    EXPECT_EQ(LexIO::ReadV(&bufs[0], stream, 2), 10);
+    EXPECT_EQ(std::memcmp(&first[0], "The ", 4), 0);
+    EXPECT_EQ(std::memcmp(&second[0], "quick ", 6), 0);
+}
+
+TEST(VectoredReader, ReadVFallback)
+{
+    PartialVectorStream stream{GetVectorStream()};
+
+    uint8_t first[4] = {0}, second[6] = {0};
+    const LexIO::MutableBufferView bufs[] = {{&first[0], 4}, {&second[0], 6}};
+    EXPECT_EQ(LexIO::ReadV(&bufs[0], stream, 2), 10);
+    EXPECT_EQ(std::memcmp(&first[0], "The ", 4), 0);
+    EXPECT_EQ(std::memcmp(&second[0], "quick ", 6), 0);
+}
+
+TEST(VectoredReader, ReadVEOF)
+{
+    LexIO::VectorStream stream = GetVectorStream();
+    LexIO::Seek(stream, 5, LexIO::Whence::end);
+
+    uint8_t first[4] = {0}, second[6] = {0};
+    const LexIO::MutableBufferView bufs[] = {{&first[0], 4}, {&second[0], 6}};
+    EXPECT_EQ(LexIO::ReadV(&bufs[0], stream, 2), 5);
+    EXPECT_EQ(std::memcmp(&first[0], "dog.", 4), 0);
+    EXPECT_EQ(second[0], '\n');
+}
+
+TEST(VectoredWriter, WriteV)
+{
+    LexIO::VectorStream stream;
+
+    const LexIO::BufferView bufs[] = {{&TEST_TEXT_DATA[0], 4}, {nullptr, 0}, {&TEST_TEXT_DATA[4], 6}};
+    EXPECT_EQ(LexIO::WriteV(stream, &bufs[0], 3), 10);
+    ASSERT_EQ(stream.Container().size(), 10);
+    EXPECT_EQ(std::memcmp(stream.Container().data(), &TEST_TEXT_DATA[0], 10), 0);
+}
+
+TEST(VectoredWriter, WriteVPartial)
+{
+    ShortVectoredStream stream{LexIO::VectorStream{}};
+
+    const LexIO::BufferView bufs[] = {{&TEST_TEXT_DATA[0], 4}, {&TEST_TEXT_DATA[4], 6}};
+    EXPECT_EQ(LexIO::WriteV(stream, &bufs[0], 2), 10);
+    ASSERT_EQ(stream.Stream().Container().size(), 10);
+    EXPECT_EQ(std::memcmp(stream.Stream().Container().data(), &TEST_TEXT_DATA[0], 10), 0);
+}
+
+TEST(VectoredWriter, WriteVFallback)
+{
+    PartialVectorStream stream{LexIO::VectorStream{}};
+
+    const LexIO::BufferView bufs[] = {{&TEST_TEXT_DATA[0], 4}, {&TEST_TEXT_DATA[4], 6}};
+    EXPECT_EQ(LexIO::WriteV(stream, &bufs[0], 2), 10);
+    ASSERT_EQ(stream.Stream().Container().size(), 10);
+    EXPECT_EQ(std::memcmp(stream.Stream().Container().data(), &TEST_TEXT_DATA[0], 10), 0);
+}
@@ -0,0 +1,222 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "lexio/direct.hpp"
+
+#include "./test.h"
+#include "lexio/lib.hpp"
+#include "lexio/stream/file.hpp"
+
+constexpr size_t TEST_ALIGNMENT = 16;
+
+/**
+ * @brief A VectorStream that counts operations a direct I/O file would
+ *        reject.
+ */
+class AlignCheckStream
+{
+    LexIO::VectorStream m_stream;
+
+    void Check(const uint8_t *buffer, size_t count)
+    {
+        const size_t offset = LexIO::Tell(m_stream);
+        if (reinterpret_cast<uintptr_t>(buffer) % TEST_ALIGNMENT != 0 || count % TEST_ALIGNMENT != 0 ||
+            offset % TEST_ALIGNMENT != 0)
+        {
+            unaligned += 1;
+        }
+    }
+
+  public:
+    size_t unaligned = 0;
+
+    AlignCheckStream() = default;
+    AlignCheckStream(LexIO::VectorStream &&stream) : m_stream(std::move(stream)) {}
+
+    const LexIO::VectorStream &Stream() const { return m_stream; }
+
+    size_t LexRead(uint8_t *outDest, size_t count)
+    {
+        Check(outDest, count);
+        return LexIO::Read(outDest, m_stream, count);
+    }
+
+    size_t LexWrite(const uint8_t *src, size_t count)
+    {
+        Check(src, count);
+        return LexIO::Write(m_stream, src, count);
+    }
+
+    void LexFlush() {}
+
+    size_t LexSeek(const LexIO::SeekPos &pos) { return LexIO::Seek(m_stream, pos); }
+};
+
+//******************************************************************************
+
+TEST(AlignedBuffer, Alloc)
+{
+    LexIO::AlignedBuffer buffer{100};
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(buffer.Data()) % LexIO::DEFAULT_DIRECT_ALIGNMENT);
+    EXPECT_EQ(LexIO::DEFAULT_DIRECT_ALIGNMENT, buffer.Size());
+
+    LexIO::AlignedBuffer small{100, 64};
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(small.Data()) % 64);
+    EXPECT_EQ(128, small.Size());
+
+    LexIO::AlignedBuffer moved{std::move(small)};
+    EXPECT_EQ(nullptr, small.Data());
+    EXPECT_EQ(128, moved.Size());
+
+    EXPECT_THROW(LexIO::AlignedBuffer(100, 48), std::runtime_error);
+    EXPECT_THROW(LexIO::AlignedBuffer(4096, 0), std::runtime_error);
+}
+
+TEST(DirectReader, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsBufferedReaderV<LexIO::DirectReader<LexIO::File>>);
+    EXPECT_TRUE(LexIO::IsSeekableV<LexIO::DirectReader<LexIO::File>>);
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::DirectWriter<LexIO::File>>);
+}
+
+TEST(DirectReader, Read)
+{
+    LexIO::DirectReader<AlignCheckStream> reader{GetVectorStream(), 32, TEST_ALIGNMENT};
+    EXPECT_EQ(32, reader.Capacity());
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[7];
+    size_t count = 0;
+    while ((count = LexIO::Read(chunk, reader)) != 0)
+    {
+        data.insert(data.end(), &chunk[0], &chunk[count]);
+    }
+
+    EXPECT_EQ(GetVectorStream().Container(), data);
+    EXPECT_EQ(0, reader.Reader().unaligned);
+}
+
+TEST(DirectReader, FillBuffer)
+{
+    LexIO::DirectReader<AlignCheckStream> reader{GetVectorStream(), 16, TEST_ALIGNMENT};
+
+    // Leave a few bytes near the end of the buffer, so filling has to move
+    // them back while keeping the next read aligned.
+    EXPECT_EQ(32, LexIO::FillBuffer(reader, 5).Size());
+    LexIO::ConsumeBuffer(reader, 29);
+    const LexIO::BufferView view = LexIO::FillBuffer(reader, 12);
+    ASSERT_EQ(16, view.Size());
+    EXPECT_EQ(0, std::memcmp(view.Data(), &TEST_TEXT_DATA[29], 16));
+    EXPECT_THROW(LexIO::FillBuffer(reader, 17), std::runtime_error);
+    EXPECT_EQ(0, reader.Reader().unaligned);
+    EXPECT_THROW((LexIO::DirectReader<AlignCheckStream>{GetVectorStream(), 16, 0}), std::runtime_error);
+}
+
+TEST(DirectReader, Seek)
+{
+    LexIO::DirectReader<AlignCheckStream> reader{GetVectorStream(), 32, TEST_ALIGNMENT};
+
+    uint8_t data[4];
+    EXPECT_EQ(21, LexIO::Seek(reader, 21, LexIO::Whence::start));
+    EXPECT_EQ(4, LexIO::Read(data, reader));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[21], 4));
+
+    EXPECT_EQ(27, LexIO::Seek(reader, 2, LexIO::Whence::current));
+    EXPECT_EQ(4, LexIO::Read(data, reader));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[27], 4));
+
+    EXPECT_EQ(3, LexIO::Seek(reader, -28, LexIO::Whence::current));
+    EXPECT_EQ(4, LexIO::Read(data, reader));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[3], 4));
+
+    EXPECT_EQ(TEST_TEXT_LENGTH - 2, LexIO::Seek(reader, 2, LexIO::Whence::end));
+    EXPECT_EQ(2, LexIO::Read(data, reader));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[TEST_TEXT_LENGTH - 2], 2));
+    EXPECT_EQ(0, LexIO::Read(data, reader));
+
+    EXPECT_THROW(LexIO::Seek(reader, -100, LexIO::Whence::current), std::runtime_error);
+    EXPECT_EQ(0, reader.Reader().unaligned);
+}
+
+TEST(DirectWriter, Write)
+{
+    AlignCheckStream stream;
+    {
+        LexIO::DirectWriter<AlignCheckStream> writer{std::move(stream), 32, TEST_ALIGNMENT};
+        for (size_t i = 0; i < TEST_TEXT_LENGTH; i += 5)
+        {
+            LexIO::Write(writer, &TEST_TEXT_DATA[i], LexIO::Detail::Min<size_t>(5, TEST_TEXT_LENGTH - i));
+        }
+
+        // Only whole blocks are written on flush.
+        LexIO::Flush(writer);
+        EXPECT_EQ(32, writer.Writer().Stream().Container().size());
+        EXPECT_EQ(0, writer.Writer().unaligned);
+
+        writer.Close();
+        EXPECT_EQ(GetVectorStream().Container(), writer.Writer().Stream().Container());
+        EXPECT_EQ(1, writer.Writer().unaligned);
+        EXPECT_THROW(LexIO::Write(writer, TEST_TEXT_DATA, 1), std::runtime_error);
+    }
+}
+
+#if !defined(_WIN32)
+
+TEST(DirectWriter, File)
+{
+    char filename[] = "/tmp/lexXXXXXX";
+    const int fd = mkstemp(filename);
+    ASSERT_NE(-1, fd);
+    close(fd);
+
+    std::vector<uint8_t> data(3 * LexIO::DEFAULT_DIRECT_ALIGNMENT + 123);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    LexIO::OpenOptions options;
+    options.direct = true;
+
+    std::vector<uint8_t> readBack;
+    try
+    {
+        {
+            auto file = LexIO::FileOpen(filename, LexIO::OpenMode::write, options);
+            LexIO::DirectWriter<LexIO::File> writer{std::move(file), 2 * LexIO::DEFAULT_DIRECT_ALIGNMENT};
+            LexIO::Write(writer, data.data(), data.size());
+        }
+
+        auto file = LexIO::FileOpen(filename, LexIO::OpenMode::read, options);
+        LexIO::DirectReader<LexIO::File> reader{std::move(file)};
+        EXPECT_EQ(data.size(), LexIO::Length(reader));
+        LexIO::ReadToEOF(std::back_inserter(readBack), reader);
+    }
+    catch (const LexIO::POSIXError &e)
+    {
+        unlink(filename);
+        if (e.GetError() == EINVAL)
+        {
+            GTEST_SKIP() << "filesystem does not support direct I/O";
+        }
+        throw;
+    }
+
+    unlink(filename);
+    EXPECT_EQ(data, readBack);
+}
+
+#endif
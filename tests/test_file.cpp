@@ -17,6 +17,11 @@
 #include "lexio/stream/file.hpp"
 
 #include "./test.h"
+#include "lexio/bufwriter.hpp"
+#include "lexio/lib.hpp"
+#include <atomic>
+#include <limits>
+#include <thread>
 
 //******************************************************************************
 
@@ -177,6 +182,21 @@ TEST(File, Length)
 #endif
 }
 
+TEST(File, LengthSized)
+{
+    EXPECT_TRUE(LexIO::IsSizedV<LexIO::File>);
+    EXPECT_TRUE(LexIO::IsSizedV<LexIO::GenericBufReader<LexIO::File>>);
+
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    LexIO::Seek(file, 4, LexIO::Whence::start);
+#if defined(_WIN32)
+    EXPECT_EQ(47, LexIO::Length(file));
+#else
+    EXPECT_EQ(45, LexIO::Length(file));
+#endif
+    EXPECT_EQ(4, LexIO::Tell(file));
+}
+
 TEST(File, ReadMode)
 {
     constexpr const char *firstLine = "The quick brown fox";
@@ -237,6 +257,1018 @@ TEST(File, WriteMode)
     }
 }
 
+#if !defined(_WIN32)
+
+TEST(File, FulfillTry)
+{
+    EXPECT_TRUE(LexIO::IsTryReaderV<LexIO::File>);
+    EXPECT_TRUE(LexIO::IsTryWriterV<LexIO::File>);
+}
+
+TEST(File, TryReadError)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+
+    uint8_t readBuffer[32] = {0x00};
+    size_t read = 0;
+    const LexIO::Error err = file.LexTryRead(read, &readBuffer[0], sizeof(readBuffer));
+    EXPECT_TRUE(err);
+    EXPECT_EQ(EBADF, err.SysError());
+    EXPECT_EQ(0, read);
+
+    size_t written = 0;
+    EXPECT_FALSE(file.LexTryWrite(written, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH, written);
+}
+
+static std::vector<uint8_t> ReadFile(const std::string &filename)
+{
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(std::back_inserter(data), file);
+    return data;
+}
+
+TEST(File, FulfillFileDescriptor)
+{
+    EXPECT_TRUE(LexIO::IsFileDescriptorV<LexIO::File>);
+    EXPECT_TRUE(LexIO::IsFileDescriptorV<LexIO::GenericBufReader<LexIO::File>>);
+    EXPECT_TRUE(LexIO::IsFileDescriptorV<LexIO::FixedBufWriter<LexIO::File>>);
+    EXPECT_FALSE(LexIO::IsFileDescriptorV<LexIO::GenericBufReader<LexIO::VectorStream>>);
+
+    // Refs always claim a descriptor, and report -1 when there isn't one.
+    EXPECT_TRUE(LexIO::IsFileDescriptorV<LexIO::GenericBufReader<LexIO::ReaderRef>>);
+    LexIO::VectorStream stream;
+    LexIO::GenericBufReader<LexIO::ReaderRef> bufReader{LexIO::ReaderRef{stream}};
+    EXPECT_EQ(-1, bufReader.LexFileDescriptor());
+
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    EXPECT_EQ(file.FileHandle(), LexIO::ReaderRef{file}.LexFileDescriptor());
+}
+
+TEST(File, Copy)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    {
+        auto src = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+        auto dest = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        EXPECT_EQ(LexIO::Length(src), LexIO::Copy(dest, src));
+    }
+
+    EXPECT_EQ(ReadFile(LEXIO_TEST_DIR "/test_file.txt"), ReadFile(filename));
+}
+
+TEST(File, CopyBuffered)
+{
+    std::string srcname = TempFile();
+    ScopeDelete deleteSrc{srcname};
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    // Large enough that more than one buffer's worth is left after draining.
+    std::vector<uint8_t> data(100000);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    {
+        auto file = LexIO::FileOpen(srcname.c_str(), LexIO::OpenMode::write);
+        LexIO::WriteExact(file, data.data(), data.size());
+    }
+
+    {
+        auto src = LexIO::GenericBufReader<LexIO::File>{LexIO::FileOpen(srcname.c_str(), LexIO::OpenMode::read)};
+        auto dest = LexIO::FixedBufWriter<LexIO::File>{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write)};
+
+        // Leave data buffered on both sides, which must be kept in order.
+        LexIO::FillBuffer(src, 16);
+        LexIO::ConsumeBuffer(src, 4);
+        LexIO::Write(dest, {'X', 'Y'});
+
+        EXPECT_EQ(data.size() - 4, LexIO::Copy(dest, src));
+        LexIO::Flush(dest);
+    }
+
+    std::vector<uint8_t> expected{'X', 'Y'};
+    expected.insert(expected.end(), data.begin() + 4, data.end());
+    EXPECT_EQ(expected, ReadFile(filename));
+}
+
+TEST(File, SizeHint)
+{
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    const size_t length = LexIO::Length(file);
+    EXPECT_EQ(length, LexIO::SizeHint(file));
+
+    LexIO::Seek(file, 4, LexIO::Whence::start);
+    EXPECT_EQ(length - 4, LexIO::SizeHint(file));
+    EXPECT_EQ(4, LexIO::Tell(file));
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(length - 4, LexIO::ReadToEOF(data, file));
+    EXPECT_EQ(0, LexIO::SizeHint(file));
+}
+
+TEST(File, CopyDescriptorPipe)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    int fds[2] = {-1, -1};
+    ASSERT_EQ(0, pipe(fds));
+    ASSERT_EQ(ssize_t(TEST_TEXT_LENGTH), write(fds[1], TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    close(fds[1]);
+
+    {
+        auto dest = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Detail::CopyDescriptor(dest.LexFileDescriptor(), fds[0]));
+    }
+    close(fds[0]);
+
+    EXPECT_EQ(GetVectorStream().Container(), ReadFile(filename));
+}
+
+TEST(File, CopyDescriptorRange)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    int fds[2] = {-1, -1};
+    ASSERT_EQ(0, pipe(fds));
+    ASSERT_EQ(ssize_t(TEST_TEXT_LENGTH), write(fds[1], TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    close(fds[1]);
+
+    {
+        // Only the asked-for count is copied, to the offset and not the
+        // cursor of the destination.
+        auto dest = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        size_t copied = 0;
+        size_t destOffset = 3;
+        const LexIO::Error err =
+            LexIO::Detail::TryCopyDescriptorRange(copied, dest.LexFileDescriptor(), &destOffset, fds[0], nullptr, 10);
+        EXPECT_FALSE(err);
+        EXPECT_EQ(10, copied);
+        EXPECT_EQ(13, destOffset);
+        EXPECT_EQ(0, LexIO::Tell(dest));
+    }
+    close(fds[0]);
+
+    std::vector<uint8_t> expected(3, 0);
+    expected.insert(expected.end(), &TEST_TEXT_DATA[0], &TEST_TEXT_DATA[10]);
+    EXPECT_EQ(expected, ReadFile(filename));
+}
+
+TEST(File, SyncPolicy)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+    EXPECT_EQ(LexIO::SyncMode::fsync, file.GetSyncPolicy().mode);
+
+    for (auto mode : {LexIO::SyncMode::fsync, LexIO::SyncMode::fdatasync, LexIO::SyncMode::syncFileRange,
+                      LexIO::SyncMode::none})
+    {
+        LexIO::SyncPolicy policy;
+        policy.mode = mode;
+        file.SetSyncPolicy(policy);
+
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+        EXPECT_NO_THROW(LexIO::Flush(file));
+    }
+
+    EXPECT_EQ(TEST_TEXT_LENGTH * 4, LexIO::Length(file));
+}
+
+TEST(File, SyncPolicyThresholds)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+
+    LexIO::SyncPolicy policy;
+    policy.mode = LexIO::SyncMode::fdatasync;
+    policy.everyBytes = 16;
+    file.SetSyncPolicy(policy);
+
+    // Every 16th byte syncs, and nothing else does.
+    size_t syncs = 0;
+    for (size_t i = 0; i < TEST_TEXT_LENGTH; i++)
+    {
+        EXPECT_EQ(1, LexIO::Write(file, &TEST_TEXT_DATA[i], 1));
+        if (file.UnsyncedBytes() == 0)
+        {
+            syncs += 1;
+            EXPECT_EQ(0, (i + 1) % 16);
+        }
+    }
+    EXPECT_EQ(TEST_TEXT_LENGTH / 16, syncs);
+    EXPECT_EQ(TEST_TEXT_LENGTH % 16, file.UnsyncedBytes());
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Length(file));
+
+    // Writes only sync on time once the interval has passed.
+    policy.everyBytes = 0;
+    policy.everyTime = std::chrono::hours{1};
+    file.SetSyncPolicy(policy);
+    LexIO::Write(file, TEST_TEXT_DATA, 1);
+    EXPECT_EQ(TEST_TEXT_LENGTH % 16 + 1, file.UnsyncedBytes());
+
+    policy.everyTime = std::chrono::milliseconds{1};
+    file.SetSyncPolicy(policy);
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    LexIO::Write(file, TEST_TEXT_DATA, 1);
+    EXPECT_EQ(0, file.UnsyncedBytes());
+}
+
+TEST(File, FulfillPositional)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<LexIO::File>);
+    EXPECT_TRUE(LexIO::IsPositionalWriterV<LexIO::File>);
+}
+
+TEST(File, ReadAt)
+{
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    LexIO::Seek(file, 8, LexIO::Whence::start);
+
+    uint8_t data[5] = {0};
+    EXPECT_EQ(5, LexIO::ReadAt(&data[0], file, sizeof(data), 4));
+    EXPECT_EQ(0, std::memcmp(&data[0], "quick", 5));
+    EXPECT_EQ(0, LexIO::ReadAt(&data[0], file, sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(8, LexIO::Tell(file));
+}
+
+TEST(File, ReadAtThreaded)
+{
+    constexpr size_t THREAD_COUNT = 4;
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatches{0};
+    for (size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back([&file, &mismatches, t]() {
+            for (size_t i = t; i < TEST_TEXT_LENGTH; i += THREAD_COUNT)
+            {
+                uint8_t byte = 0;
+                if (LexIO::ReadAt(&byte, file, 1, i) != 1 || byte != TEST_TEXT_DATA[i])
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(0, LexIO::Tell(file));
+}
+
+TEST(File, WriteAt)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+
+    const uint8_t data[] = {'X', 'Y', 'Z'};
+    EXPECT_EQ(3, LexIO::WriteAt(file, &data[0], sizeof(data), 4));
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+
+    // Positional writes past the end extend the file.
+    EXPECT_EQ(3, LexIO::WriteAt(file, &data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH + 3, LexIO::Length(file));
+
+    auto readFile = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    uint8_t readBuffer[8] = {0};
+    EXPECT_EQ(8, LexIO::Read(readBuffer, readFile));
+    EXPECT_EQ(0, std::memcmp(&readBuffer[0], "The XYZc", 8));
+}
+
+TEST(File, FulfillVectored)
+{
+    EXPECT_TRUE(LexIO::IsVectoredReaderV<LexIO::File>);
+    EXPECT_TRUE(LexIO::IsVectoredWriterV<LexIO::File>);
+}
+
+TEST(File, ReadV_WriteV)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+    const LexIO::BufferView writeBufs[] = {{&TEST_TEXT_DATA[0], 20}, {&TEST_TEXT_DATA[20], TEST_TEXT_LENGTH - 20}};
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::WriteV(file, &writeBufs[0], 2));
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+
+    auto readFile = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    uint8_t first[20] = {0}, second[TEST_TEXT_LENGTH] = {0};
+    const LexIO::MutableBufferView readBufs[] = {{&first[0], sizeof(first)}, {&second[0], sizeof(second)}};
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::ReadV(&readBufs[0], readFile, 2));
+    EXPECT_EQ(0, std::memcmp(&first[0], &TEST_TEXT_DATA[0], 20));
+    EXPECT_EQ(0, std::memcmp(&second[0], &TEST_TEXT_DATA[20], TEST_TEXT_LENGTH - 20));
+}
+
+TEST(File, OffsetCache)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::writePlus);
+    EXPECT_FALSE(file.GetOffsetCache());
+    file.SetOffsetCache(true);
+    EXPECT_TRUE(file.GetOffsetCache());
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Length(file));
+
+    // The kernel offset is left alone while the cache is in use.
+    EXPECT_EQ(0, lseek(file.FileHandle(), 0, SEEK_CUR));
+
+    EXPECT_EQ(4, LexIO::Seek(file, 4, LexIO::Whence::start));
+    EXPECT_EQ(8, LexIO::Seek(file, 4, LexIO::Whence::current));
+    EXPECT_EQ(TEST_TEXT_LENGTH - 8, LexIO::SizeHint(file));
+    EXPECT_THROW(LexIO::Seek(file, -9, LexIO::Whence::current), LexIO::POSIXError);
+
+    uint8_t buffer[5] = {0};
+    EXPECT_EQ(5, LexIO::Read(buffer, file));
+    EXPECT_EQ(0, std::memcmp(&buffer[0], &TEST_TEXT_DATA[8], 5));
+    EXPECT_EQ(13, LexIO::Tell(file));
+
+    const LexIO::BufferView writeBufs[] = {{&TEST_TEXT_DATA[0], 2}, {&TEST_TEXT_DATA[2], 2}};
+    EXPECT_EQ(4, LexIO::WriteV(file, &writeBufs[0], 2));
+    EXPECT_EQ(17, LexIO::Tell(file));
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Seek(file, 0, LexIO::Whence::end));
+
+    // Disabling the cache hands the offset back to the kernel.
+    LexIO::Seek(file, 13, LexIO::Whence::start);
+    file.SetOffsetCache(false);
+    EXPECT_EQ(13, lseek(file.FileHandle(), 0, SEEK_CUR));
+    EXPECT_EQ(5, LexIO::Read(buffer, file));
+    EXPECT_EQ(0, std::memcmp(&buffer[0], &TEST_TEXT_DATA[0], 4));
+    EXPECT_EQ(18, lseek(file.FileHandle(), 0, SEEK_CUR));
+}
+
+TEST(File, OffsetCacheAppend)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::File::Open(filename.c_str(), O_RDWR | O_APPEND, 0666);
+    file.SetOffsetCache(true);
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+
+    // Appends ignore the offset, and Tell must follow them to the new end.
+    LexIO::Rewind(file);
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH * 2, LexIO::Tell(file));
+    EXPECT_EQ(TEST_TEXT_LENGTH * 2, LexIO::Length(file));
+
+    uint8_t buffer[4] = {0};
+    LexIO::Seek(file, TEST_TEXT_LENGTH, LexIO::Whence::start);
+    EXPECT_EQ(4, LexIO::Read(buffer, file));
+    EXPECT_EQ(0, std::memcmp(&buffer[0], &TEST_TEXT_DATA[0], 4));
+}
+
+TEST(File, OffsetCacheCopy)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    {
+        auto src = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+        auto dest = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        src.SetOffsetCache(true);
+        dest.SetOffsetCache(true);
+
+        // Copying through the fd must start from, and update, the cached offsets.
+        LexIO::Seek(src, 4, LexIO::Whence::start);
+        LexIO::Write(dest, {'X', 'Y'});
+        EXPECT_EQ(LexIO::Length(src) - 4, LexIO::Copy(dest, src));
+        EXPECT_EQ(LexIO::Length(src), LexIO::Tell(src));
+        EXPECT_EQ(LexIO::Length(src) - 2, LexIO::Tell(dest));
+    }
+
+    std::vector<uint8_t> expected = ReadFile(LEXIO_TEST_DIR "/test_file.txt");
+    expected.erase(expected.begin(), expected.begin() + 2);
+    expected[0] = 'X';
+    expected[1] = 'Y';
+    EXPECT_EQ(expected, ReadFile(filename));
+}
+
+TEST(File, OffsetCachePipe)
+{
+    int fds[2] = {-1, -1};
+    ASSERT_EQ(0, pipe(fds));
+
+    {
+        // There is no offset to cache on a pipe.
+        const std::string path = "/dev/fd/" + std::to_string(fds[0]);
+        auto file = LexIO::File::Open(path.c_str(), O_RDONLY, 0);
+        EXPECT_THROW(file.SetOffsetCache(true), LexIO::POSIXError);
+        EXPECT_FALSE(file.GetOffsetCache());
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(File, Advise)
+{
+    auto file = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    for (auto hint : {LexIO::AccessHint::sequential, LexIO::AccessHint::random, LexIO::AccessHint::willNeed,
+                      LexIO::AccessHint::dontNeed, LexIO::AccessHint::noReuse, LexIO::AccessHint::normal})
+    {
+        EXPECT_NO_THROW(file.Advise(hint));
+    }
+    EXPECT_NO_THROW(file.Advise(LexIO::AccessHint::willNeed, 4, 8));
+    EXPECT_NO_THROW(file.Readahead(0, LexIO::Length(file)));
+
+    LexIO::File closed;
+    EXPECT_THROW(closed.Readahead(0, 1), LexIO::POSIXError);
+#if defined(POSIX_FADV_NORMAL)
+    EXPECT_THROW(closed.Advise(LexIO::AccessHint::sequential), LexIO::POSIXError);
+#endif
+}
+
+static size_t AllocatedBytes(const LexIO::File &file)
+{
+    struct stat st;
+    if (fstat(file.FileHandle(), &st) == -1)
+    {
+        throw std::runtime_error("could not stat file");
+    }
+    return size_t(st.st_blocks) * 512;
+}
+
+TEST(File, Preallocate)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::writePlus);
+    LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    try
+    {
+        file.Preallocate(TEST_TEXT_LENGTH, 65536, true);
+    }
+    catch (const LexIO::POSIXError &e)
+    {
+        if (e.GetError() == EOPNOTSUPP)
+        {
+            GTEST_SKIP() << "filesystem does not support preallocation";
+        }
+        throw;
+    }
+
+    // Space is reserved past the end without changing the size.
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Length(file));
+#if defined(__linux__)
+    EXPECT_GE(AllocatedBytes(file), 65536);
+#endif
+
+    file.Preallocate(0, 100);
+    EXPECT_EQ(100, LexIO::Length(file));
+
+    uint8_t data[100];
+    EXPECT_EQ(100, LexIO::ReadAt(&data[0], file, sizeof(data), 0));
+    EXPECT_EQ(0, std::memcmp(&data[0], TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_EQ(std::vector<uint8_t>(100 - TEST_TEXT_LENGTH), std::vector<uint8_t>(&data[TEST_TEXT_LENGTH], &data[100]));
+
+    file.Truncate(10);
+    EXPECT_EQ(10, LexIO::Length(file));
+}
+
+TEST(File, PreallocateStep)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    constexpr size_t STEP = 1024 * 1024;
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+    file.SetPreallocateStep(STEP);
+    EXPECT_EQ(STEP, file.GetPreallocateStep());
+
+    {
+        LexIO::FixedBufWriter<LexIO::File> writer{std::move(file), 4096};
+        std::vector<uint8_t> chunk(1000, 'X');
+        for (size_t i = 0; i < 300; i++)
+        {
+            LexIO::WriteExact(writer, chunk.data(), chunk.size());
+        }
+        LexIO::Flush(writer);
+
+        if (writer.Writer().GetPreallocateStep() == 0)
+        {
+            GTEST_SKIP() << "filesystem does not support preallocation";
+        }
+
+        // A step ahead of the cursor is reserved, but the size is what we
+        // wrote.
+        EXPECT_EQ(300000, LexIO::Length(writer));
+#if defined(__linux__)
+        EXPECT_GE(AllocatedBytes(writer.Writer()), 300000 + STEP / 2);
+#endif
+    }
+
+    // Closing gave back what wasn't used.
+    auto reopened = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    EXPECT_EQ(300000, LexIO::Length(reopened));
+#if defined(__linux__)
+    EXPECT_LT(AllocatedBytes(reopened), 300000 + STEP / 2);
+#endif
+}
+
+/**
+ * @brief Write a 2MiB file with data at the start and in the middle, and
+ *        holes everywhere else.
+ */
+static void WriteSparseFile(LexIO::File &file)
+{
+    const std::vector<uint8_t> block(4096, 'A');
+    LexIO::WriteAt(file, block.data(), block.size(), 0);
+    LexIO::WriteAt(file, block.data(), block.size(), 1024 * 1024);
+    file.Truncate(2 * 1024 * 1024);
+}
+
+TEST(File, DataExtents)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::writePlus);
+    WriteSparseFile(file);
+    LexIO::Seek(file, 123, LexIO::Whence::start);
+
+    std::vector<uint8_t> data;
+    LexIO::FileExtent extent;
+    size_t offset = 0;
+    while (file.NextDataExtent(extent, offset))
+    {
+        ASSERT_GE(extent.offset, offset);
+        ASSERT_NE(0, extent.length);
+        offset = extent.offset + extent.length;
+        data.resize(offset);
+        LexIO::ReadAt(&data[extent.offset], file, extent.length, extent.offset);
+    }
+
+    // Extents cover every byte of data, however coarse the filesystem is.
+    EXPECT_LE(offset, 2 * 1024 * 1024);
+    EXPECT_EQ(4096 * 2, size_t(std::count(data.begin(), data.end(), 'A')));
+    EXPECT_EQ('A', data[1024 * 1024]);
+    EXPECT_FALSE(file.NextDataExtent(extent, 2 * 1024 * 1024));
+
+    // Looking for extents doesn't move the cursor.
+    EXPECT_EQ(123, LexIO::Tell(file));
+}
+
+TEST(File, CopySparse)
+{
+    std::string srcName = TempFile(), destName = TempFile();
+    ScopeDelete deleteSrc{srcName}, deleteDest{destName};
+
+    auto src = LexIO::FileOpen(srcName.c_str(), LexIO::OpenMode::writePlus);
+    WriteSparseFile(src);
+    LexIO::Rewind(src);
+
+    auto dest = LexIO::FileOpen(destName.c_str(), LexIO::OpenMode::writePlus);
+    EXPECT_EQ(2 * 1024 * 1024, LexIO::CopySparse(dest, src));
+    EXPECT_EQ(2 * 1024 * 1024, LexIO::Tell(src));
+    EXPECT_EQ(2 * 1024 * 1024, LexIO::Tell(dest));
+
+    std::vector<uint8_t> srcData, destData;
+    LexIO::Rewind(src);
+    LexIO::Rewind(dest);
+    LexIO::ReadToEOF(srcData, src);
+    LexIO::ReadToEOF(destData, dest);
+    EXPECT_EQ(srcData, destData);
+
+    // Holes stay holes, if the source had any.
+#if defined(__linux__)
+    if (AllocatedBytes(src) < 1024 * 1024)
+    {
+        EXPECT_LT(AllocatedBytes(dest), 1024 * 1024);
+    }
+#endif
+}
+
+TEST(File, CopySparseOverwrite)
+{
+    std::string srcName = TempFile(), destName = TempFile();
+    ScopeDelete deleteSrc{srcName}, deleteDest{destName};
+
+    auto src = LexIO::FileOpen(srcName.c_str(), LexIO::OpenMode::writePlus);
+    WriteSparseFile(src);
+    LexIO::Seek(src, 1024 * 1024 - 100, LexIO::Whence::start);
+
+    // Copy over existing data, starting partway through both files.
+    auto dest = LexIO::FileOpen(destName.c_str(), LexIO::OpenMode::writePlus);
+    const std::vector<uint8_t> filler(3 * 1024 * 1024, 'Z');
+    LexIO::Write(dest, filler.data(), filler.size());
+    LexIO::Seek(dest, 10, LexIO::Whence::start);
+
+    const size_t count = 1024 * 1024 + 100;
+    EXPECT_EQ(count, LexIO::CopySparse(dest, src));
+    EXPECT_EQ(10 + count, LexIO::Tell(dest));
+    EXPECT_EQ(3 * 1024 * 1024, LexIO::Length(dest));
+
+    std::vector<uint8_t> expected(filler.size(), 'Z');
+    std::fill(expected.begin() + 10, expected.begin() + 10 + count, 0);
+    std::fill(expected.begin() + 110, expected.begin() + 110 + 4096, 'A');
+
+    std::vector<uint8_t> destData;
+    LexIO::Rewind(dest);
+    LexIO::ReadToEOF(destData, dest);
+    EXPECT_EQ(expected, destData);
+}
+
+#if defined(__linux__)
+
+/**
+ * @brief Count the pages of a file that are in the page cache.
+ */
+static size_t ResidentPages(const std::string &filename, size_t length)
+{
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    void *map = mmap(nullptr, length, PROT_READ, MAP_SHARED, file.FileHandle(), 0);
+    if (map == MAP_FAILED)
+    {
+        throw std::runtime_error("could not map file");
+    }
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<unsigned char> pages((length + pageSize - 1) / pageSize);
+    const int ok = mincore(map, length, pages.data());
+    munmap(map, length);
+    if (ok == -1)
+    {
+        throw std::runtime_error("could not get page residency");
+    }
+    return size_t(std::count_if(pages.begin(), pages.end(), [](unsigned char page) { return page & 1; }));
+}
+
+TEST(File, DropBehind)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    constexpr size_t LENGTH = 1024 * 1024;
+    constexpr size_t WINDOW = 64 * 1024;
+    std::vector<uint8_t> data(LENGTH);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 3);
+    }
+
+    {
+        auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        LexIO::WriteExact(file, data.data(), data.size());
+        LexIO::Flush(file);
+        file.Advise(LexIO::AccessHint::dontNeed);
+    }
+
+    if (ResidentPages(filename, LENGTH) != 0)
+    {
+        // tmpfs and friends keep their pages no matter what.
+        GTEST_SKIP() << "filesystem ignores POSIX_FADV_DONTNEED";
+    }
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    file.SetDropBehind(WINDOW);
+    EXPECT_EQ(WINDOW, file.GetDropBehind());
+
+    LexIO::GenericBufReader<LexIO::File> reader{std::move(file)};
+    std::vector<uint8_t> readBack;
+    LexIO::ReadToEOF(std::back_inserter(readBack), reader);
+    EXPECT_EQ(data, readBack);
+
+    // The kernel skips pages it is still busy with, so only expect most of
+    // the file to be gone.
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    EXPECT_LT(ResidentPages(filename, LENGTH), LENGTH / pageSize / 2);
+}
+
+#endif
+
+//******************************************************************************
+
+TEST(MappedFile, FulfillBufferedReader)
+{
+    EXPECT_TRUE(LexIO::IsBufferedReaderV<LexIO::MappedFile>);
+}
+
+TEST(MappedFile, FulfillSeekable)
+{
+    EXPECT_TRUE(LexIO::IsSeekableV<LexIO::MappedFile>);
+}
+
+TEST(MappedFile, MoveCtor_MoveAssign)
+{
+    auto file = LexIO::MappedFile::Open(LEXIO_TEST_DIR "/test_file.txt");
+    LexIO::FillBuffer(file, 4);
+
+    LexIO::MappedFile moveFile{std::move(file)};
+    auto test = LexIO::FillBuffer(moveFile, 4);
+    EXPECT_EQ(test.Data()[0], 'T');
+
+    LexIO::MappedFile assignFile;
+    assignFile = std::move(moveFile);
+    test = LexIO::FillBuffer(assignFile, 4);
+    EXPECT_EQ(test.Data()[0], 'T');
+}
+
+TEST(MappedFile, Read)
+{
+    auto file = LexIO::MappedFile::Open(LEXIO_TEST_DIR "/test_file.txt");
+
+    uint8_t data[TEST_TEXT_LENGTH] = {0};
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Read(data, file));
+    EXPECT_EQ(0, std::memcmp(&data[0], &TEST_TEXT_DATA[0], TEST_TEXT_LENGTH));
+    EXPECT_EQ(0, LexIO::Read(data, file));
+}
+
+TEST(MappedFile, FillBufferZeroCopy)
+{
+    auto file = LexIO::MappedFile::Open(LEXIO_TEST_DIR "/test_file.txt");
+
+    auto first = LexIO::FillBuffer(file, 8);
+    EXPECT_EQ(first.Size(), 8);
+    LexIO::ConsumeBuffer(file, 4);
+
+    // The view should point into the same mapping, four bytes later.
+    auto second = LexIO::FillBuffer(file, 8);
+    EXPECT_EQ(second.Data(), first.Data() + 4);
+    EXPECT_EQ(second.Data()[0], 'q');
+    EXPECT_EQ(second.Size(), 8);
+
+    // Filling past the end only returns what's left.
+    auto rest = LexIO::FillBuffer(file, 1024);
+    EXPECT_EQ(rest.Size(), TEST_TEXT_LENGTH - 4);
+    EXPECT_EQ(rest.Data()[rest.Size() - 1], '\n');
+}
+
+TEST(MappedFile, FillBufferSlidingWindow)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    // Write a file spanning several pages of a repeating pattern.
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t fileSize = pageSize * 4 + 123;
+    {
+        auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        for (size_t i = 0; i < fileSize; i++)
+        {
+            const uint8_t byte = uint8_t(i % 251);
+            LexIO::Write(file, &byte, 1);
+        }
+    }
+
+    // A single page window must slide to cover fills that straddle pages.
+    auto file = LexIO::MappedFile::Open(filename.c_str(), 1);
+    EXPECT_EQ(pageSize, file.WindowSize());
+    file.Advise(LexIO::MapAdvice::sequential);
+
+    size_t total = 0;
+    for (;;)
+    {
+        auto view = LexIO::FillBuffer(file, 100);
+        if (view.Size() == 0)
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < view.Size(); i++)
+        {
+            ASSERT_EQ(view.Data()[i], uint8_t((total + i) % 251));
+        }
+        LexIO::ConsumeBuffer(file, view.Size());
+        total += view.Size();
+    }
+    EXPECT_EQ(fileSize, total);
+
+    // Fills larger than the window map as much as is needed.
+    EXPECT_EQ(pageSize, LexIO::Seek(file, ptrdiff_t(pageSize), LexIO::Whence::start));
+    auto view = LexIO::FillBuffer(file, pageSize * 2);
+    EXPECT_EQ(pageSize * 2, view.Size());
+    EXPECT_EQ(view.Data()[pageSize * 2 - 1], uint8_t((pageSize * 3 - 1) % 251));
+}
+
+TEST(MappedFile, Seek)
+{
+    auto file = LexIO::MappedFile::Open(LEXIO_TEST_DIR "/test_file.txt");
+    file.Advise(LexIO::MapAdvice::random);
+
+    EXPECT_EQ(8, LexIO::Seek(file, 8, LexIO::Whence::start));
+    auto view = LexIO::FillBuffer(file, 4);
+    EXPECT_EQ(view.Data()[0], 'k');
+
+    EXPECT_EQ(TEST_TEXT_LENGTH - 5, LexIO::Seek(file, -5, LexIO::Whence::end));
+    view = LexIO::FillBuffer(file, 4);
+    EXPECT_EQ(view.Data()[0], 'd');
+
+    EXPECT_ANY_THROW(LexIO::Seek(file, -1, LexIO::Whence::start));
+
+    // Seeking past the end reads nothing.
+    LexIO::Seek(file, 1024, LexIO::Whence::start);
+    EXPECT_EQ(0, LexIO::FillBuffer(file, 4).Size());
+}
+
+TEST(MappedFile, Empty)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    auto file = LexIO::MappedFile::Open(filename.c_str());
+    EXPECT_EQ(0, LexIO::FillBuffer(file, 4).Size());
+}
+
+TEST(ParallelFileWriter, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::ParallelFileSink>);
+    EXPECT_FALSE(LexIO::IsSeekableV<LexIO::ParallelFileSink>);
+
+    LexIO::ParallelFileSink sink;
+    EXPECT_THROW(LexIO::Write(sink, TEST_TEXT_DATA, TEST_TEXT_LENGTH), std::runtime_error);
+}
+
+TEST(ParallelFileWriter, Write)
+{
+    constexpr size_t THREADS = 8;
+    constexpr size_t RECORDS = 1000;
+    constexpr size_t RECORD_SIZE = 10;
+    constexpr size_t LARGE_SIZE = 200;
+    constexpr uint8_t LARGE_MARKER = 0xFF;
+
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    {
+        LexIO::ParallelFileWriter writer{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write)};
+
+        // Each thread writes small records, plus one too large for its
+        // buffer in the middle.
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; t++)
+        {
+            threads.emplace_back([&writer, t] {
+                LexIO::ParallelFileSink sink = writer.Sink(64);
+                for (size_t i = 0; i < RECORDS; i++)
+                {
+                    uint8_t record[RECORD_SIZE] = {uint8_t(t), uint8_t(i), uint8_t(i >> 8)};
+                    LexIO::Write(sink, &record[0], sizeof(record));
+                    if (i == RECORDS / 2)
+                    {
+                        std::vector<uint8_t> large(LARGE_SIZE, uint8_t(t));
+                        large[0] = LARGE_MARKER;
+                        LexIO::Write(sink, large.data(), large.size());
+                    }
+                }
+                LexIO::Flush(sink);
+            });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(THREADS * (RECORDS * RECORD_SIZE + LARGE_SIZE), writer.Tail());
+        writer.Close();
+    }
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, file);
+    ASSERT_EQ(THREADS * (RECORDS * RECORD_SIZE + LARGE_SIZE), data.size());
+
+    // Records are whole, and each thread's records are in order.
+    std::vector<size_t> next(THREADS), large(THREADS);
+    for (size_t i = 0; i < data.size();)
+    {
+        if (data[i] == LARGE_MARKER)
+        {
+            ASSERT_LT(data[i + 1], THREADS);
+            large[data[i + 1]] += 1;
+            i += LARGE_SIZE;
+            continue;
+        }
+
+        const uint8_t *record = &data[i];
+        ASSERT_LT(record[0], THREADS);
+        EXPECT_EQ(next[record[0]]++, size_t(record[1]) | size_t(record[2]) << 8);
+        i += RECORD_SIZE;
+    }
+    EXPECT_EQ(std::vector<size_t>(THREADS, RECORDS), next);
+    EXPECT_EQ(std::vector<size_t>(THREADS, 1), large);
+}
+
+TEST(ParallelFileWriter, Finalize)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    {
+        auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write);
+        const std::vector<uint8_t> filler(1000, 'Z');
+        LexIO::Write(file, filler.data(), filler.size());
+    }
+
+    {
+        // Start past a header, which is filled in by hand.
+        LexIO::ParallelFileWriter writer{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::readPlus), 4};
+        EXPECT_EQ(4, writer.ReserveRange(3));
+        EXPECT_EQ(7, writer.Tail());
+        ASSERT_EQ(7, pwrite(writer.File().FileHandle(), TEST_TEXT_DATA, 7, 0));
+
+        LexIO::ParallelFileSink sink = writer.Sink();
+        LexIO::Write(sink, &TEST_TEXT_DATA[7], 5);
+    }
+
+    // The destructors wrote out the sink and cut the file down to size.
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, file);
+    EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[12]), data);
+}
+
+TEST(ParallelFileWriter, LiveSinks)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    LexIO::ParallelFileSink late;
+    {
+        LexIO::ParallelFileWriter writer{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write)};
+        LexIO::ParallelFileSink sink = writer.Sink();
+        LexIO::Write(sink, &TEST_TEXT_DATA[0], 5);
+        LexIO::Flush(sink);
+
+        // Closing with a sink around fails, and leaves the file alone.
+        EXPECT_THROW(writer.Close(), std::runtime_error);
+        EXPECT_NE(-1, writer.File().FileHandle());
+        sink.Detach();
+        EXPECT_THROW(LexIO::Write(sink, TEST_TEXT_DATA, 1), std::runtime_error);
+        writer.Close();
+        EXPECT_EQ(-1, writer.File().FileHandle());
+    }
+
+    {
+        // A sink that outlives its writer keeps the file open.
+        LexIO::ParallelFileWriter writer{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write)};
+        late = writer.Sink();
+    }
+    LexIO::Write(late, &TEST_TEXT_DATA[0], 7);
+    LexIO::Flush(late);
+    late = LexIO::ParallelFileSink{};
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, file);
+    EXPECT_EQ(std::vector<uint8_t>(&TEST_TEXT_DATA[0], &TEST_TEXT_DATA[7]), data);
+}
+
+TEST(ParallelFileWriter, FailedSink)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    // No file can be that large, so every write fails.
+    const size_t start = size_t(std::numeric_limits<off_t>::max()) - 1;
+    LexIO::ParallelFileWriter writer{LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::write), start};
+    {
+        LexIO::ParallelFileSink sink = writer.Sink(4);
+        EXPECT_THROW(LexIO::Write(sink, TEST_TEXT_DATA, TEST_TEXT_LENGTH), LexIO::POSIXError);
+    }
+
+    try
+    {
+        writer.Close();
+        FAIL() << "expected an exception";
+    }
+    catch (const std::runtime_error &ex)
+    {
+        EXPECT_STREQ(ex.what(), "a sink failed to write its range, the file has gaps");
+    }
+    EXPECT_EQ(-1, writer.File().FileHandle());
+}
+
+#endif
+
 #if defined(_WIN32)
 
 TEST(File, Error)
@@ -16,6 +16,9 @@
 
 #include "lexio/serialize/int.hpp"
 
+#include "lexio/bufreader.hpp"
+#include "lexio/bufwriter.hpp"
+
 #include "./test.h"
 
 static ErrorStream g_errorStream;
@@ -650,3 +653,83 @@ TEST(Int, TryWrite64BE_Write64BE)
         EXPECT_ANY_THROW(LexIO::Write64BE(buffer, -4822678189205112));
     }
 }
+
+TEST(Int, RefOverloads)
+{
+    LexIO::VectorStream buffer;
+    const LexIO::WriterRef writer{buffer};
+    EXPECT_EQ(LexIO::TryWriteU32LE(writer, 0xDEADBEEF), true);
+    EXPECT_NO_THROW(LexIO::Write16BE(writer, -2));
+    EXPECT_EQ(LexIO::TryWriteU8(g_errorStream, 0x88), false);
+
+    LexIO::Rewind(buffer);
+    const LexIO::ReaderRef reader{buffer};
+    uint32_t test = 0;
+    EXPECT_EQ(LexIO::TryReadU32LE(test, reader), true);
+    EXPECT_EQ(test, 0xDEADBEEF);
+    EXPECT_EQ(LexIO::Read16BE(reader), -2);
+    EXPECT_ANY_THROW(LexIO::ReadU8(reader));
+
+    LexIO::Rewind(buffer);
+    LexIO::BufferedReaderRef bufReader{buffer};
+    EXPECT_EQ(LexIO::ReadU32LE(bufReader), 0xDEADBEEF);
+}
+
+
+TEST(Int, BufferedFastPath)
+{
+    LexIO::VectorStream buffer;
+    LexIO::WriteU8(buffer, 0x42);
+    LexIO::WriteU32LE(buffer, 0xDEADBEEF);
+    LexIO::WriteU64BE(buffer, 0x0102030405060708);
+    LexIO::WriteU16LE(buffer, 0xBEEF);
+    LexIO::WriteU8(buffer, 0xFF);
+
+    // Values straddle the four-byte reads done by PartialStream.
+    LexIO::Rewind(buffer);
+    LexIO::GenericBufReader<PartialStream<LexIO::VectorStream>> bufReader{
+        PartialStream<LexIO::VectorStream>{std::move(buffer)}};
+    EXPECT_EQ(LexIO::ReadU8(bufReader), 0x42);
+    EXPECT_EQ(LexIO::ReadU32LE(bufReader), 0xDEADBEEF);
+    EXPECT_EQ(LexIO::ReadU64BE(bufReader), 0x0102030405060708);
+    uint16_t test = 0;
+    EXPECT_EQ(LexIO::TryReadU16LE(test, bufReader), true);
+    EXPECT_EQ(test, 0xBEEF);
+
+    // Only a single byte remains, the buffer comes up short.
+    uint32_t test32 = 0;
+    EXPECT_EQ(LexIO::TryReadU32LE(test32, bufReader), false);
+    EXPECT_ANY_THROW(LexIO::ReadU16LE(bufReader));
+}
+
+TEST(Int, BufferedWriterStore)
+{
+    LexIO::FixedBufWriter<LexIO::VectorStream> bufWriter{LexIO::VectorStream{}, 8};
+    LexIO::WriteU32LE(bufWriter, 0xDEADBEEF);
+    LexIO::WriteU64BE(bufWriter, 0x0102030405060708);
+    const LexIO::BufferedWriterRef ref{bufWriter};
+    EXPECT_EQ(LexIO::TryWriteU16BE(ref, 0xBEEF), true);
+    LexIO::Flush(bufWriter);
+
+    const std::vector<uint8_t> expected = {0xEF, 0xBE, 0xAD, 0xDE, 0x01, 0x02, 0x03,
+                                           0x04, 0x05, 0x06, 0x07, 0x08, 0xBE, 0xEF};
+    EXPECT_EQ(expected, bufWriter.Writer().Container());
+}
+
+TEST(Int, EncodeRecord)
+{
+    // A whole record is encoded into a single reservation.
+    LexIO::VectorStream stream;
+    const LexIO::MutableBufferView view = LexIO::Reserve(stream, 19);
+    uint8_t *cursor = view.Data();
+    cursor = LexIO::EncodeU8(cursor, 0x88);
+    cursor = LexIO::Encode16BE(cursor, -2);
+    cursor = LexIO::EncodeU32LE(cursor, 0xDEADBEEF);
+    cursor = LexIO::EncodeU64BE(cursor, 0x0102030405060708);
+    cursor = LexIO::EncodeFloat32LE(cursor, 1.0f);
+    LexIO::Commit(stream, static_cast<size_t>(cursor - view.Data()));
+
+    const std::vector<uint8_t> expected = {0x88, 0xFF, 0xFE, 0xEF, 0xBE, 0xAD, 0xDE, 0x01, 0x02, 0x03,
+                                           0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x80, 0x3F};
+    EXPECT_EQ(expected, stream.Container());
+}
@@ -18,6 +18,8 @@
 
 #include "./test.h"
 
+#include <deque>
+
 TEST(Lib, ReadToEOF)
 {
     auto stream = GetVectorStream();
@@ -63,6 +65,61 @@ TEST(Lib, BufferedReadToEOF)
     EXPECT_EQ(*(data.end() - 1), '\n');
 }
 
+TEST(Lib, ReadToEOFContainer)
+{
+    auto stream = GetVectorStream();
+    LexIO::Seek(stream, 4, LexIO::Whence::start);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 4, LexIO::SizeHint(stream));
+
+    std::vector<uint8_t> data{'X'};
+    const size_t bytes = LexIO::ReadToEOF(data, stream);
+    EXPECT_EQ(bytes, TEST_TEXT_LENGTH - 4);
+    EXPECT_EQ(data.size(), TEST_TEXT_LENGTH - 3);
+    EXPECT_EQ(data[0], 'X');
+    EXPECT_EQ(data[1], 'q');
+    EXPECT_EQ(*(data.end() - 1), '\n');
+}
+
+TEST(Lib, ReadToEOFContainerNoHint)
+{
+    // Several times larger than the initial allocation, read 4 bytes at a time.
+    std::vector<uint8_t> source(40000);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<uint8_t>(i);
+    }
+    auto stream = PartialStream<LexIO::VectorStream>{LexIO::VectorStream{source}};
+    EXPECT_FALSE(LexIO::IsSizeHintV<decltype(stream)>);
+
+    std::string data;
+    const size_t bytes = LexIO::ReadToEOF(data, stream);
+    EXPECT_EQ(bytes, source.size());
+    EXPECT_EQ(0, std::memcmp(data.data(), source.data(), source.size()));
+}
+
+TEST(Lib, ReadToEOFContainerEmpty)
+{
+    auto stream = LexIO::VectorStream{};
+    const LexIO::ReaderRef reader{stream};
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(0, LexIO::ReadToEOF(data, reader));
+    EXPECT_TRUE(data.empty());
+}
+
+TEST(Lib, ReadToEOFContainerError)
+{
+    ErrorStream stream;
+    std::string data{"XYZ"};
+    EXPECT_THROW(LexIO::ReadToEOF(data, stream), std::runtime_error);
+    EXPECT_EQ("XYZ", data);
+
+    // Containers that aren't contiguous go through an iterator instead.
+    EXPECT_TRUE(LexIO::Detail::IsByteContainer<std::vector<uint8_t>>::value);
+    EXPECT_TRUE(LexIO::Detail::IsByteContainer<std::string>::value);
+    EXPECT_FALSE(LexIO::Detail::IsByteContainer<std::deque<uint8_t>>::value);
+}
+
 TEST(Lib, BufferedReadUntil)
 {
     auto bufReader = GetVectorStream();
@@ -111,3 +168,13 @@ TEST(Lib, BufferedCopy)
     EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Copy(dest, src));
     EXPECT_EQ(src.Container(), cDest.Container());
 }
+
+TEST(Lib, UnbufferedCopy)
+{
+    auto src = PartialStream<LexIO::VectorStream>{GetVectorStream()};
+    LexIO::VectorStream dest;
+    const LexIO::VectorStream &cDest = dest;
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Copy(dest, src));
+    EXPECT_EQ(src.Stream().Container(), cDest.Container());
+}
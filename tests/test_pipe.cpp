@@ -0,0 +1,160 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "lexio/stream/pipe.hpp"
+
+#include "./test.h"
+#include "lexio/lib.hpp"
+
+#if defined(__linux__)
+
+#include <thread>
+
+//******************************************************************************
+
+TEST(Pipe, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::PipeWriter>);
+    EXPECT_TRUE(LexIO::IsBufferedReaderV<LexIO::PipeReader>);
+}
+
+TEST(Pipe, Capacity)
+{
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    LexIO::Pipe pipe = LexIO::PipeOpen(1);
+    EXPECT_EQ(pageSize, pipe.writer.Capacity());
+    EXPECT_EQ(pageSize, pipe.reader.Capacity());
+
+    EXPECT_THROW(LexIO::FillBuffer(pipe.reader, pageSize + 1), std::runtime_error);
+    EXPECT_THROW(pipe.writer.LexReserve(pageSize + 1), std::runtime_error);
+}
+
+TEST(Pipe, ReadWrite)
+{
+    LexIO::Pipe pipe = LexIO::PipeOpen(1);
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(pipe.writer, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+
+    uint8_t data[TEST_TEXT_LENGTH];
+    EXPECT_EQ(10, LexIO::Read(data, pipe.reader, 10));
+    EXPECT_EQ(0, std::memcmp(data, TEST_TEXT_DATA, 10));
+
+    // Closing the writer still lets the reader drain what was written.
+    pipe.writer.Close();
+    EXPECT_EQ(TEST_TEXT_LENGTH - 10, LexIO::Read(data, pipe.reader));
+    EXPECT_EQ(0, std::memcmp(data, &TEST_TEXT_DATA[10], TEST_TEXT_LENGTH - 10));
+    EXPECT_EQ(0, LexIO::Read(data, pipe.reader));
+}
+
+TEST(Pipe, Wraparound)
+{
+    LexIO::Pipe pipe = LexIO::PipeOpen(1);
+    const size_t capacity = pipe.writer.Capacity();
+
+    // Move the positions to just before the end of the ring.
+    std::vector<uint8_t> filler(capacity - 10);
+    LexIO::Write(pipe.writer, filler.data(), filler.size());
+    LexIO::ConsumeBuffer(pipe.reader, LexIO::FillBuffer(pipe.reader, filler.size()).Size());
+
+    // Both sides see one contiguous view across the end.
+    LexIO::MutableBufferView space = pipe.writer.LexReserve(capacity);
+    ASSERT_EQ(capacity, space.Size());
+    std::memcpy(space.Data(), TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    pipe.writer.LexCommit(TEST_TEXT_LENGTH);
+    EXPECT_THROW(pipe.writer.LexCommit(capacity), std::runtime_error);
+
+    LexIO::BufferView view = LexIO::FillBuffer(pipe.reader, TEST_TEXT_LENGTH);
+    ASSERT_EQ(TEST_TEXT_LENGTH, view.Size());
+    EXPECT_EQ(0, std::memcmp(view.Data(), TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+    EXPECT_THROW(LexIO::ConsumeBuffer(pipe.reader, TEST_TEXT_LENGTH + 1), std::runtime_error);
+    LexIO::ConsumeBuffer(pipe.reader, TEST_TEXT_LENGTH);
+}
+
+TEST(Pipe, Transfer)
+{
+    constexpr size_t TRANSFER_SIZE = 4 * 1024 * 1024 + 7;
+    LexIO::Pipe pipe = LexIO::PipeOpen(64 * 1024);
+
+    std::thread producer([&] {
+        uint8_t chunk[1000];
+        for (size_t i = 0; i < TRANSFER_SIZE; i += sizeof(chunk))
+        {
+            const size_t count = LexIO::Detail::Min(sizeof(chunk), TRANSFER_SIZE - i);
+            for (size_t j = 0; j < count; j++)
+            {
+                chunk[j] = static_cast<uint8_t>((i + j) % 251);
+            }
+            LexIO::Write(pipe.writer, chunk, count);
+        }
+        pipe.writer.Close();
+    });
+
+    // Ask for uneven amounts so reads straddle the end of the ring.
+    size_t total = 0;
+    size_t mismatches = 0;
+    for (;;)
+    {
+        LexIO::BufferView view = LexIO::FillBuffer(pipe.reader, 1 + total % 5000);
+        if (view.Size() == 0)
+        {
+            break;
+        }
+        const size_t count = LexIO::Detail::Min<size_t>(view.Size(), 3000);
+        for (size_t j = 0; j < count; j++)
+        {
+            mismatches += view.Data()[j] != static_cast<uint8_t>((total + j) % 251);
+        }
+        LexIO::ConsumeBuffer(pipe.reader, count);
+        total += count;
+    }
+
+    producer.join();
+    EXPECT_EQ(TRANSFER_SIZE, total);
+    EXPECT_EQ(0, mismatches);
+}
+
+TEST(Pipe, ReaderClosed)
+{
+    LexIO::Pipe pipe = LexIO::PipeOpen(1);
+    const size_t capacity = pipe.writer.Capacity();
+
+    // A writer blocked on a full pipe is woken up by the reader closing.
+    std::thread producer([&] {
+        std::vector<uint8_t> data(capacity * 2);
+        EXPECT_THROW(LexIO::Write(pipe.writer, data.data(), data.size()), std::runtime_error);
+    });
+    EXPECT_EQ(capacity, LexIO::FillBuffer(pipe.reader, capacity).Size());
+    pipe.reader.Close();
+    producer.join();
+
+    EXPECT_THROW(LexIO::Write(pipe.writer, TEST_TEXT_DATA, 1), std::runtime_error);
+}
+
+TEST(Pipe, Move)
+{
+    LexIO::Pipe pipe = LexIO::PipeOpen();
+    LexIO::PipeWriter writer{std::move(pipe.writer)};
+    LexIO::PipeReader reader;
+    reader = std::move(pipe.reader);
+
+    LexIO::Write(writer, TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    writer = LexIO::PipeWriter{};
+
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(std::back_inserter(data), reader);
+    EXPECT_EQ(GetVectorStream().Container(), data);
+}
+
+#endif
@@ -17,7 +17,10 @@
 #include "lexio/try.hpp"
 
 #include "./test.h"
+#include "lexio/bufwriter.hpp"
 #include "lexio/serialize/int.hpp"
+#include "lexio/serialize/tryint.hpp"
+#include <cerrno>
 
 using PartialVectorStream = PartialStream<LexIO::VectorStream>;
 
@@ -27,6 +30,34 @@ struct ScopeClearError
     ~ScopeClearError() { LexIO::ClearLastError(); }
 };
 
+/**
+ * @brief A stream that reports errors through the Try protocol and throws
+ *        from the plain one.
+ */
+class TryErrorStream
+{
+  public:
+    size_t LexRead(uint8_t *, const size_t) { throw std::runtime_error("intended"); }
+    LexIO::BufferView LexFillBuffer(const size_t) { throw std::runtime_error("intended"); }
+    void LexConsumeBuffer(const size_t) {}
+    size_t LexWrite(const uint8_t *, const size_t) { throw std::runtime_error("intended"); }
+    void LexFlush() {}
+
+    LexIO::Error LexTryRead(size_t &outRead, uint8_t *, const size_t)
+    {
+        outRead = 0;
+        return LexIO::Error{"intended", EIO};
+    }
+
+    LexIO::Error LexTryFillBuffer(LexIO::BufferView &, const size_t) { return LexIO::Error{"intended", EIO}; }
+
+    LexIO::Error LexTryWrite(size_t &outWritten, const uint8_t *, const size_t)
+    {
+        outWritten = 0;
+        return LexIO::Error{"intended", EIO};
+    }
+};
+
 //******************************************************************************
 
 TEST(Reader, TryRawRead)
@@ -377,3 +408,71 @@ TEST(Seekable, TryLength)
     EXPECT_TRUE(LexIO::TryLength(out, stream));
     EXPECT_EQ(out, TEST_TEXT_LENGTH);
 }
+
+//******************************************************************************
+
+TEST(Error, TryReadError)
+{
+    auto onExit = ScopeClearError{};
+    auto stream = TryErrorStream{};
+
+    uint8_t buffer[5] = {0};
+    size_t out = 0;
+    EXPECT_FALSE(LexIO::TryRead(out, buffer, stream));
+    EXPECT_STREQ(LexIO::GetLastError().Message(), "intended");
+    EXPECT_EQ(LexIO::GetLastError().SysError(), EIO);
+    EXPECT_THROW(LexIO::ThrowLastError(), std::system_error);
+}
+
+TEST(Error, TryReadExactEOF)
+{
+    auto onExit = ScopeClearError{};
+    uint8_t streamBuf[2] = {0};
+    auto stream = GetViewStream(streamBuf);
+
+    uint32_t out = 0;
+    EXPECT_FALSE(LexIO::TryReadU32LE(out, stream));
+    EXPECT_STREQ(LexIO::GetLastError().Message(), "could not read exact number of bytes");
+    EXPECT_FALSE(LexIO::GetLastError().IsException());
+    EXPECT_THROW(LexIO::ThrowLastError(), std::runtime_error);
+}
+
+TEST(Error, TryWriteError)
+{
+    auto onExit = ScopeClearError{};
+    auto stream = LexIO::FixedBufWriter<TryErrorStream>{4};
+
+    const uint8_t data[] = {'X', 'Y', 'Z', 'Z', 'Y'};
+    EXPECT_FALSE(LexIO::TryWriteExact(stream, data));
+    EXPECT_EQ(LexIO::GetLastError().SysError(), EIO);
+}
+
+TEST(Error, TryBufReaderError)
+{
+    auto onExit = ScopeClearError{};
+    auto stream = LexIO::GenericBufReader<TryErrorStream>{};
+
+    uint32_t out = 0;
+    EXPECT_FALSE(LexIO::TryReadU32LE(out, stream));
+    EXPECT_EQ(LexIO::GetLastError().SysError(), EIO);
+}
+
+TEST(Error, RefKeepsException)
+{
+    auto onExit = ScopeClearError{};
+    auto stream = ErrorStream{};
+    const LexIO::ReaderRef ref{stream};
+
+    uint8_t buffer[5] = {0};
+    EXPECT_FALSE(LexIO::TryReadExact(buffer, ref));
+    EXPECT_TRUE(LexIO::GetLastError().IsException());
+    try
+    {
+        LexIO::ThrowLastError();
+        FAIL() << "expected an exception";
+    }
+    catch (const std::runtime_error &ex)
+    {
+        EXPECT_STREQ(ex.what(), "intended");
+    }
+}
@@ -0,0 +1,242 @@
+//
+// Copyright 2023 Lexi Mayfield
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "lexio/stream/uring.hpp"
+
+#include "./test.h"
+#include "lexio/lib.hpp"
+
+#if defined(__linux__)
+
+//******************************************************************************
+
+static std::string TempFile()
+{
+    char filename[] = "/tmp/lexXXXXXX";
+    int fd = mkstemp(filename);
+    if (fd == -1)
+    {
+        throw std::runtime_error("could not get temporary name");
+    }
+    close(fd);
+    return std::string(filename);
+}
+
+class ScopeDelete
+{
+    std::string m_filename;
+
+  public:
+    ScopeDelete(const std::string &filename) : m_filename(filename) {}
+    ~ScopeDelete() { unlink(m_filename.c_str()); }
+};
+
+// Kernels without io_uring, or with it disabled by policy, fail setup.
+#define OPEN_OR_SKIP(file, path, mode)                                                                                 \
+    LexIO::IoUringFile file;                                                                                           \
+    try                                                                                                                \
+    {                                                                                                                  \
+        file = LexIO::IoUringFileOpen(path, mode);                                                                     \
+    }                                                                                                                  \
+    catch (const LexIO::POSIXError &e)                                                                                 \
+    {                                                                                                                  \
+        if (e.GetError() == ENOSYS || e.GetError() == EPERM)                                                           \
+        {                                                                                                              \
+            GTEST_SKIP() << "io_uring is not available";                                                               \
+        }                                                                                                              \
+        throw;                                                                                                         \
+    }
+
+//******************************************************************************
+
+TEST(IoUringFile, Fulfill)
+{
+    EXPECT_TRUE(LexIO::IsReaderV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsWriterV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsSeekableV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsSizedV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsPositionalWriterV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsTryReaderV<LexIO::IoUringFile>);
+    EXPECT_TRUE(LexIO::IsTryWriterV<LexIO::IoUringFile>);
+}
+
+TEST(IoUringFile, Read)
+{
+    OPEN_OR_SKIP(file, LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+
+    const size_t length = LexIO::Length(file);
+    EXPECT_EQ(length, LexIO::SizeHint(file));
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(length, LexIO::ReadToEOF(data, file));
+    EXPECT_EQ(length, LexIO::Tell(file));
+
+    auto posix = LexIO::FileOpen(LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+    std::vector<uint8_t> expected;
+    LexIO::ReadToEOF(expected, posix);
+    EXPECT_EQ(expected, data);
+
+    uint8_t buffer[4] = {0};
+    EXPECT_EQ(2, LexIO::Seek(file, 2, LexIO::Whence::start));
+    EXPECT_EQ(4, LexIO::Read(buffer, file));
+    EXPECT_EQ(0, std::memcmp(&buffer[0], &expected[2], 4));
+    EXPECT_EQ(length - 1, LexIO::Seek(file, -1, LexIO::Whence::end));
+    EXPECT_THROW(LexIO::Seek(file, -1, LexIO::Whence::start), LexIO::POSIXError);
+}
+
+TEST(IoUringFile, WriteFlush)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    {
+        OPEN_OR_SKIP(file, filename.c_str(), LexIO::OpenMode::writePlus);
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH));
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+        EXPECT_NO_THROW(LexIO::Flush(file));
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Length(file));
+
+        uint8_t buffer[5] = {0};
+        EXPECT_EQ(5, LexIO::ReadAt(&buffer[0], file, sizeof(buffer), 4));
+        EXPECT_EQ(0, std::memcmp(&buffer[0], &TEST_TEXT_DATA[4], 5));
+        EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Tell(file));
+    }
+
+    auto file = LexIO::FileOpen(filename.c_str(), LexIO::OpenMode::read);
+    std::vector<uint8_t> data;
+    LexIO::ReadToEOF(data, file);
+    EXPECT_EQ(GetVectorStream().Container(), data);
+}
+
+TEST(IoUringFile, Append)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    LexIO::IoUringFile file;
+    try
+    {
+        file = LexIO::IoUringFile::Open(filename.c_str(), O_RDWR | O_APPEND, 0666);
+    }
+    catch (const LexIO::POSIXError &e)
+    {
+        if (e.GetError() == ENOSYS || e.GetError() == EPERM)
+        {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+        throw;
+    }
+
+    LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    LexIO::Rewind(file);
+    LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    EXPECT_EQ(TEST_TEXT_LENGTH * 2, LexIO::Tell(file));
+    EXPECT_EQ(TEST_TEXT_LENGTH * 2, LexIO::Length(file));
+}
+
+TEST(IoUringFile, Batch)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    OPEN_OR_SKIP(file, filename.c_str(), LexIO::OpenMode::writePlus);
+
+    // More operations than the queue holds, so Queue has to submit early.
+    constexpr size_t COUNT = LexIO::IoUringFile::DEFAULT_ENTRIES * 2 + 3;
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        file.QueueWrite(&TEST_TEXT_DATA[i % TEST_TEXT_LENGTH], 1, i, i);
+    }
+
+    std::vector<LexIO::IoUringCompletion> completions(COUNT);
+    size_t reaped = 0;
+    while (reaped < COUNT)
+    {
+        reaped += file.Reap(&completions[reaped], COUNT - reaped, 1);
+    }
+
+    std::vector<bool> seen(COUNT);
+    for (const auto &completion : completions)
+    {
+        ASSERT_LT(completion.userData, COUNT);
+        EXPECT_EQ(1, completion.result);
+        seen[completion.userData] = true;
+    }
+    EXPECT_EQ(COUNT, size_t(std::count(seen.begin(), seen.end(), true)));
+    EXPECT_EQ(COUNT, LexIO::Length(file));
+
+    // Queued reads complete alongside synchronous ones.
+    uint8_t first[8] = {0}, second[8] = {0};
+    file.QueueRead(&first[0], sizeof(first), 0, 1);
+    EXPECT_EQ(1, file.Submit());
+    uint8_t sync[8] = {0};
+    EXPECT_EQ(8, LexIO::Read(sync, file));
+    file.QueueRead(&second[0], sizeof(second), 8, 2);
+
+    LexIO::IoUringCompletion out[2];
+    EXPECT_EQ(2, file.Reap(&out[0], 2, 2));
+    EXPECT_EQ(0, std::memcmp(&first[0], &TEST_TEXT_DATA[0], 8));
+    EXPECT_EQ(0, std::memcmp(&second[0], &TEST_TEXT_DATA[8], 8));
+    EXPECT_EQ(0, std::memcmp(&sync[0], &TEST_TEXT_DATA[0], 8));
+
+    EXPECT_THROW(file.QueueRead(&first[0], 1, 0, LexIO::IoUringFile::RESERVED_USER_DATA), std::runtime_error);
+    EXPECT_THROW(file.QueueRead(&first[0], 1, 0, UINT64_MAX), std::runtime_error);
+}
+
+TEST(IoUringFile, RegisteredBuffers)
+{
+    std::string filename = TempFile();
+    ScopeDelete deleteMe{filename};
+
+    OPEN_OR_SKIP(file, filename.c_str(), LexIO::OpenMode::writePlus);
+
+    std::vector<uint8_t> writeBuf(TEST_TEXT_DATA, TEST_TEXT_DATA + TEST_TEXT_LENGTH);
+    std::vector<uint8_t> readBuf(TEST_TEXT_LENGTH);
+    const LexIO::MutableBufferView bufs[] = {{writeBuf.data(), writeBuf.size()}, {readBuf.data(), readBuf.size()}};
+    file.RegisterBuffers(&bufs[0], 2);
+
+    file.QueueWriteFixed(writeBuf.data(), writeBuf.size(), 0, 0, 1);
+    LexIO::IoUringCompletion out;
+    ASSERT_EQ(1, file.Reap(&out, 1, 1));
+    EXPECT_EQ(int32_t(TEST_TEXT_LENGTH), out.result);
+
+    file.QueueReadFixed(readBuf.data() + 5, 10, 5, 1, 2);
+    ASSERT_EQ(1, file.Reap(&out, 1, 1));
+    EXPECT_EQ(2, out.userData);
+    EXPECT_EQ(10, out.result);
+    EXPECT_EQ(0, std::memcmp(readBuf.data() + 5, &TEST_TEXT_DATA[5], 10));
+
+    // Registering again replaces the old set.
+    file.RegisterBuffers(&bufs[1], 1);
+    file.QueueReadFixed(readBuf.data(), readBuf.size(), 0, 0, 3);
+    ASSERT_EQ(1, file.Reap(&out, 1, 1));
+    EXPECT_EQ(int32_t(TEST_TEXT_LENGTH), out.result);
+    EXPECT_EQ(writeBuf, readBuf);
+}
+
+TEST(IoUringFile, Error)
+{
+    OPEN_OR_SKIP(file, LEXIO_TEST_DIR "/test_file.txt", LexIO::OpenMode::read);
+
+    size_t written = 0;
+    const LexIO::Error err = file.LexTryWrite(written, TEST_TEXT_DATA, TEST_TEXT_LENGTH);
+    EXPECT_TRUE(err);
+    EXPECT_EQ(EBADF, err.SysError());
+    EXPECT_THROW(LexIO::Write(file, TEST_TEXT_DATA, TEST_TEXT_LENGTH), LexIO::POSIXError);
+}
+
+#endif
@@ -487,3 +487,22 @@ TEST(Varint, SVarint64Bytes)
     EXPECT_EQ(10, LexIO::SVarint64Bytes(0 - 0x8000000000000000));
     EXPECT_EQ(10, LexIO::SVarint64Bytes(0x7fffffffffffffff));
 }
+
+//******************************************************************************
+
+TEST(Varint, RefOverloads)
+{
+    LexIO::VectorStream buffer;
+    const LexIO::WriterRef writer{buffer};
+    EXPECT_EQ(LexIO::TryWriteUVarint32(writer, 0xbbaa9988), true);
+    EXPECT_NO_THROW(LexIO::WriteSVarint64(writer, -2));
+
+    LexIO::Rewind(buffer);
+    const LexIO::ReaderRef reader{buffer};
+    uint32_t test = 0;
+    EXPECT_EQ(LexIO::TryReadUVarint32(test, reader), true);
+    EXPECT_EQ(test, 0xbbaa9988);
+    EXPECT_EQ(LexIO::ReadSVarint64(reader), -2);
+    EXPECT_ANY_THROW(LexIO::ReadUVarint32(reader));
+}
+
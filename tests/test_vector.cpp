@@ -40,6 +40,18 @@ TEST(VectorStream, FulfillSeekable)
     EXPECT_TRUE(LexIO::IsSeekableV<LexIO::VectorStream>);
 }
 
+TEST(VectorStream, FulfillPositional)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<LexIO::VectorStream>);
+    EXPECT_TRUE(LexIO::IsPositionalWriterV<LexIO::VectorStream>);
+}
+
+TEST(VectorStream, FulfillVectored)
+{
+    EXPECT_TRUE(LexIO::IsVectoredReaderV<LexIO::VectorStream>);
+    EXPECT_TRUE(LexIO::IsVectoredWriterV<LexIO::VectorStream>);
+}
+
 TEST(VectorStream, DefCtor)
 {
     auto vecStream = LexIO::VectorStream{};
@@ -402,3 +414,141 @@ TEST(VectorStream, Seek_Negative)
 
     EXPECT_ANY_THROW(LexIO::Seek(vecStream, -1, LexIO::Whence::current));
 }
+
+TEST(VectorStream, ReadAt)
+{
+    auto vecStream = GetVectorStream();
+    LexIO::Seek(vecStream, 8, LexIO::Whence::start);
+
+    uint8_t data[5] = {0};
+    EXPECT_EQ(5, vecStream.LexReadAt(&data[0], sizeof(data), 20));
+    EXPECT_EQ(data[0], 'j');
+    EXPECT_EQ(data[4], 's');
+    EXPECT_EQ(2, vecStream.LexReadAt(&data[0], sizeof(data), TEST_TEXT_LENGTH - 2));
+    EXPECT_EQ(0, vecStream.LexReadAt(&data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(8, LexIO::Tell(vecStream));
+}
+
+TEST(VectorStream, WriteAt)
+{
+    auto vecStream = GetVectorStream();
+    LexIO::Seek(vecStream, 8, LexIO::Whence::start);
+
+    const uint8_t data[] = {'X', 'Y', 'Z'};
+    EXPECT_EQ(3, vecStream.LexWriteAt(&data[0], sizeof(data), 0));
+    EXPECT_EQ(vecStream.Container()[0], 'X');
+    EXPECT_EQ(vecStream.Container()[2], 'Z');
+    EXPECT_EQ(8, LexIO::Tell(vecStream));
+
+    // Positional writes do not grow the container.
+    EXPECT_EQ(1, vecStream.LexWriteAt(&data[0], sizeof(data), TEST_TEXT_LENGTH - 1));
+    EXPECT_EQ(0, vecStream.LexWriteAt(&data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(TEST_TEXT_LENGTH, vecStream.Container().size());
+}
+
+TEST(VectorStream, ReadV)
+{
+    auto vecStream = GetVectorStream();
+
+    uint8_t first[4] = {0}, second[6] = {0};
+    const LexIO::MutableBufferView bufs[] = {{&first[0], 4}, {&second[0], 6}};
+    EXPECT_EQ(10, vecStream.LexReadV(&bufs[0], 2));
+    EXPECT_EQ(first[0], 'T');
+    EXPECT_EQ(second[0], 'q');
+    EXPECT_EQ(10, LexIO::Tell(vecStream));
+
+    // Reads stop short at EOF.
+    LexIO::Seek(vecStream, 2, LexIO::Whence::end);
+    EXPECT_EQ(2, vecStream.LexReadV(&bufs[0], 2));
+}
+
+TEST(VectorStream, WriteV)
+{
+    auto vecStream = GetVectorStream();
+    LexIO::Seek(vecStream, 4, LexIO::Whence::end);
+
+    const uint8_t first[] = {'X', 'Y'}, second[] = {'Z', 'Z', 'Y'};
+    const LexIO::BufferView bufs[] = {{&first[0], 2}, {&second[0], 3}};
+    EXPECT_EQ(5, vecStream.LexWriteV(&bufs[0], 2));
+    EXPECT_EQ(TEST_TEXT_LENGTH + 1, vecStream.Container().size());
+    EXPECT_EQ(TEST_TEXT_LENGTH + 1, LexIO::Tell(vecStream));
+    EXPECT_EQ('X', vecStream.Container()[TEST_TEXT_LENGTH - 4]);
+    EXPECT_EQ('Y', vecStream.Container()[TEST_TEXT_LENGTH]);
+}
+
+TEST(VectorStream, FulfillBufferedWriter)
+{
+    EXPECT_TRUE(LexIO::IsBufferedWriterV<LexIO::VectorStream>);
+}
+
+TEST(VectorStream, FulfillTry)
+{
+    EXPECT_TRUE(LexIO::IsTryReaderV<LexIO::VectorStream>);
+    EXPECT_TRUE(LexIO::IsTryBufferedReaderV<LexIO::VectorStream>);
+    EXPECT_TRUE(LexIO::IsTryWriterV<LexIO::VectorStream>);
+}
+
+TEST(VectorStream, SizeHint)
+{
+    auto vecStream = GetVectorStream();
+    EXPECT_TRUE(LexIO::IsSizeHintV<LexIO::VectorStream>);
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::SizeHint(vecStream));
+
+    // Filled but unconsumed data still counts as remaining.
+    LexIO::FillBuffer(vecStream, 8);
+    LexIO::ConsumeBuffer(vecStream, 3);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 3, LexIO::SizeHint(vecStream));
+
+    LexIO::Seek(vecStream, 10, LexIO::Whence::end);
+    EXPECT_EQ(10, LexIO::SizeHint(vecStream));
+
+    // Positions past the end have nothing left to read.
+    LexIO::Seek(vecStream, TEST_TEXT_LENGTH + 10, LexIO::Whence::start);
+    EXPECT_EQ(0, LexIO::SizeHint(vecStream));
+}
+
+TEST(VectorStream, ReserveCommit)
+{
+    auto vecStream = GetVectorStream();
+    LexIO::Seek(vecStream, 2, LexIO::Whence::end);
+
+    // Reserving past the end grows the container.
+    LexIO::MutableBufferView view = LexIO::Reserve(vecStream, 8);
+    ASSERT_GE(view.Size(), 8);
+    std::memcpy(view.Data(), "XYZZY", 5);
+
+    // Committing less than was reserved shrinks it back down.
+    LexIO::Commit(vecStream, 5);
+    EXPECT_EQ(TEST_TEXT_LENGTH + 3, vecStream.Container().size());
+    EXPECT_EQ(TEST_TEXT_LENGTH + 3, LexIO::Tell(vecStream));
+    EXPECT_EQ('X', vecStream.Container()[TEST_TEXT_LENGTH - 2]);
+    EXPECT_EQ('Y', vecStream.Container()[TEST_TEXT_LENGTH + 2]);
+
+    // Unused reservations inside the container don't change its size.
+    LexIO::Rewind(vecStream);
+    view = LexIO::Reserve(vecStream, 4);
+    view.Data()[0] = 'Q';
+    LexIO::Commit(vecStream, 1);
+    EXPECT_EQ(TEST_TEXT_LENGTH + 3, vecStream.Container().size());
+    EXPECT_EQ('Q', vecStream.Container()[0]);
+    EXPECT_EQ('h', vecStream.Container()[1]);
+
+    EXPECT_ANY_THROW(LexIO::Commit(vecStream, TEST_TEXT_LENGTH + 3));
+}
+
+TEST(VectorStream, ReserveTwice)
+{
+    LexIO::VectorStream vecStream;
+
+    // Only the size from before the first reservation counts.
+    LexIO::Reserve(vecStream, 8);
+    LexIO::MutableBufferView view = LexIO::Reserve(vecStream, 8);
+    std::memcpy(view.Data(), "XY", 2);
+    LexIO::Commit(vecStream, 2);
+    EXPECT_EQ(2, vecStream.Container().size());
+
+    // Each commit needs its own reservation.
+    LexIO::Write(vecStream, TEST_TEXT_DATA, 5);
+    EXPECT_THROW(LexIO::Commit(vecStream, 0), std::runtime_error);
+    EXPECT_EQ(7, vecStream.Container().size());
+}
@@ -41,6 +41,12 @@ TEST(ViewStream, FulfillSeekable)
     EXPECT_TRUE(LexIO::IsSeekableV<LexIO::ViewStream>);
 }
 
+TEST(ViewStream, FulfillPositional)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<LexIO::ViewStream>);
+    EXPECT_TRUE(LexIO::IsPositionalWriterV<LexIO::ViewStream>);
+}
+
 TEST(ViewStream, DefCtor)
 {
     auto viewStream = LexIO::ViewStream{};
@@ -382,6 +388,16 @@ TEST(ViewStream, Write)
     EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::Length(viewStream));
 }
 
+TEST(ViewStream, SizeHint)
+{
+    uint8_t buffer[TEST_TEXT_LENGTH] = {0};
+    auto viewStream = GetViewStream(buffer);
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::SizeHint(viewStream));
+    LexIO::Seek(viewStream, 4, LexIO::Whence::start);
+    EXPECT_EQ(TEST_TEXT_LENGTH - 4, LexIO::SizeHint(viewStream));
+}
+
 TEST(ViewStream, Flush)
 {
     uint8_t buffer[TEST_TEXT_LENGTH] = {0};
@@ -410,8 +426,38 @@ TEST(ViewStream, Seek_Negative)
     EXPECT_ANY_THROW(LexIO::Seek(viewStream, -1, LexIO::Whence::current));
 }
 
+TEST(ViewStream, ReadAt)
+{
+    uint8_t buffer[TEST_TEXT_LENGTH] = {0};
+    auto viewStream = GetViewStream(buffer);
+
+    uint8_t data[5] = {0};
+    EXPECT_EQ(5, viewStream.LexReadAt(&data[0], sizeof(data), 4));
+    EXPECT_EQ(data[0], 'q');
+    EXPECT_EQ(data[4], 'k');
+    EXPECT_EQ(2, viewStream.LexReadAt(&data[0], sizeof(data), TEST_TEXT_LENGTH - 2));
+    EXPECT_EQ(0, viewStream.LexReadAt(&data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(0, LexIO::Tell(viewStream));
+}
+
+TEST(ViewStream, WriteAt)
+{
+    uint8_t buffer[TEST_TEXT_LENGTH] = {0};
+    auto viewStream = GetViewStream(buffer);
+
+    const uint8_t data[] = {'X', 'Y', 'Z'};
+    EXPECT_EQ(3, viewStream.LexWriteAt(&data[0], sizeof(data), 4));
+    EXPECT_EQ(buffer[4], 'X');
+    EXPECT_EQ(buffer[6], 'Z');
+    EXPECT_EQ(1, viewStream.LexWriteAt(&data[0], sizeof(data), TEST_TEXT_LENGTH - 1));
+    EXPECT_EQ(buffer[TEST_TEXT_LENGTH - 1], 'X');
+    EXPECT_EQ(0, viewStream.LexWriteAt(&data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(0, LexIO::Tell(viewStream));
+}
+
 //******************************************************************************
 
+
 TEST(ConstViewStream, FulfillReader)
 {
     EXPECT_TRUE(LexIO::IsReaderV<LexIO::ConstViewStream>);
@@ -432,6 +478,12 @@ TEST(ConstViewStream, FulfillSeekable)
     EXPECT_TRUE(LexIO::IsSeekableV<LexIO::ConstViewStream>);
 }
 
+TEST(ConstViewStream, FulfillPositional)
+{
+    EXPECT_TRUE(LexIO::IsPositionalReaderV<LexIO::ConstViewStream>);
+    EXPECT_FALSE(LexIO::IsPositionalWriterV<LexIO::ConstViewStream>);
+}
+
 TEST(ConstViewStream, DefCtor)
 {
     auto viewStream = LexIO::ConstViewStream{};
@@ -712,6 +764,15 @@ TEST(ConstViewStream, ConsumeBufferTooLarge)
     EXPECT_ANY_THROW(LexIO::ConsumeBuffer(viewStream, 12));
 }
 
+TEST(ConstViewStream, SizeHint)
+{
+    auto viewStream = GetConstViewStream();
+
+    EXPECT_EQ(TEST_TEXT_LENGTH, LexIO::SizeHint(viewStream));
+    LexIO::Seek(viewStream, 4, LexIO::Whence::end);
+    EXPECT_EQ(4, LexIO::SizeHint(viewStream));
+}
+
 TEST(ConstViewStream, Seek)
 {
     auto viewStream = GetConstViewStream();
@@ -729,3 +790,15 @@ TEST(ConstViewStream, Seek_Negative)
 
     EXPECT_ANY_THROW(LexIO::Seek(viewStream, -1, LexIO::Whence::current));
 }
+
+TEST(ConstViewStream, ReadAt)
+{
+    auto viewStream = GetConstViewStream();
+
+    uint8_t data[5] = {0};
+    EXPECT_EQ(5, viewStream.LexReadAt(&data[0], sizeof(data), 16));
+    EXPECT_EQ(data[0], 'f');
+    EXPECT_EQ(data[4], 'j');
+    EXPECT_EQ(0, viewStream.LexReadAt(&data[0], sizeof(data), TEST_TEXT_LENGTH));
+    EXPECT_EQ(0, LexIO::Tell(viewStream));
+}